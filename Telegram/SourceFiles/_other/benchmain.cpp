@@ -0,0 +1,249 @@
+/*
+This file is part of Telegram Desktop,
+an unofficial desktop messaging app, see https://telegram.org
+
+Telegram Desktop is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+It is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+Full license: https://github.com/telegramdesktop/tdesktop/blob/master/LICENSE
+Copyright (c) 2014 John Preston, https://tdesktop.com
+*/
+#include "stdafx.h"
+#include "style.h"
+#include "gui/emoji_config.h"
+#include "benchmain.h"
+#include "mtpbenchmark.h"
+
+#include <iostream>
+#ifndef Q_OS_WIN
+#include <sys/resource.h>
+#endif
+
+uint64 getcpums() {
+#ifdef Q_OS_WIN
+	FILETIME creation, exit, kernel, user;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) return 0;
+
+	uint64 kernelTime = (uint64(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime, userTime = (uint64(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+	return (kernelTime + userTime) / 10000; // in 100 ns units
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+
+	return 1000 * uint64(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + uint64(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000;
+#endif
+}
+
+namespace {
+	void usage() {
+		std::cout << "Usage: Benchmark ids [count]\n";
+		std::cout << "       Benchmark crypto\n";
+		std::cout << "       Benchmark text <corpus file> (utf-8 message texts separated by empty lines)\n";
+		std::cout << "       Benchmark transport small|upload|download|mixed [count] [in flight]\n";
+		std::cout << "Results are written to log.txt\n";
+	}
+
+	template <typename Map>
+	uint64 benchmarkIdsRun(Map &ids, const QVector<mtpMsgId> &incoming, int32 &found) {
+		uint64 ms = getms();
+		for (int32 i = 0, l = incoming.size(); i < l; ++i) {
+			mtpMsgId id = incoming.at(i);
+			if (ids.constFind(id) == ids.cend()) {
+				ids.insert(id, (i & 0x01) ? true : false);
+			}
+			uint32 idsSize = ids.size();
+			while (idsSize-- > MTPIdsBufferSize) {
+				ids.erase(ids.begin());
+			}
+			if (ids.constFind(incoming.at(i / 2 + (l / 2) * (i & 0x01))) != ids.cend()) { // msgs_state_req lookups of older ids
+				++found;
+			}
+		}
+		return getms() - ms;
+	}
+
+	void benchmarkMsgIds(int32 count) { // compares mtpMsgIdsMap to QMap on the receive path
+		QVector<mtpMsgId> incoming;
+		incoming.reserve(count);
+		mtpMsgId id = msgid();
+		for (int32 i = 0; i < count; ++i) {
+			id += 4 * (1 + (rand() % 64));
+			if (i > 0 && !(i % 16)) { // resent duplicates and slightly reordered container messages
+				incoming.push_back(incoming.at(i - 1 - (rand() % qMin(i, 32))));
+			} else {
+				incoming.push_back(id);
+			}
+		}
+
+		QMap<mtpMsgId, bool> oldIds;
+		mtpMsgIdsMap<bool> newIds;
+		int32 oldFound = 0, newFound = 0;
+		uint64 oldMs = benchmarkIdsRun(oldIds, incoming, oldFound);
+		uint64 newMs = benchmarkIdsRun(newIds, incoming, newFound);
+		LOG(("MTP Benchmark: %1 msgIds, QMap %2ms, flat buffer %3ms, found %4 / %5").arg(count).arg(oldMs).arg(newMs).arg(oldFound).arg(newFound));
+	}
+
+	void textHeightsLog(const char *what, int32 texts, int32 calls, qint64 nsecs) {
+		LOG(("Text Benchmark: %1, %2 texts, %3 calls, %4 ms, %5 ns per call").arg(what).arg(texts).arg(calls).arg(nsecs / 1000000).arg(nsecs / qMax(calls, 1)));
+	}
+
+	bool benchmarkTextHeights(const QString &corpus) { // Text::countHeight() against the full blocks walk on real message texts
+		QFile f(corpus);
+		if (!f.open(QIODevice::ReadOnly)) {
+			LOG(("Text Benchmark Error: could not open %1").arg(corpus));
+			return false;
+		}
+		QStringList lines(QString::fromUtf8(f.readAll()).replace(qsl("\r\n"), qsl("\n")).split(qsl("\n\n"), QString::SkipEmptyParts));
+
+		TextParseOptions options = { TextParseLinks | TextParseMultiline | TextParseRichText, 0, 0, Qt::LayoutDirectionAuto }; // as for history messages
+		QString skipBlock(textcmdSkipBlock(st::msgDateFont->m.width(qsl("00:00")), st::msgDateFont->height - st::msgDateDelta.y()));
+		QVector<Text*> texts;
+		texts.reserve(lines.size());
+		for (int32 i = 0, l = lines.size(); i < l; ++i) {
+			QString text(lines.at(i).trimmed());
+			if (text.isEmpty()) continue;
+
+			texts.push_back(new Text(st::msgMinWidth));
+			texts.back()->setText(st::msgFont, text + skipBlock, options);
+		}
+		if (texts.isEmpty()) {
+			LOG(("Text Benchmark Error: no texts in %1").arg(corpus));
+			return false;
+		}
+
+		const int32 widthsCount = 16, rounds = 8, count = texts.size();
+		int32 widths[widthsCount];
+		for (int32 w = 0; w < widthsCount; ++w) { // resizing the window from the widest messages to the narrowest
+			widths[w] = st::msgMaxWidth - (st::msgMaxWidth - st::msgMinWidth) * w / (widthsCount - 1);
+		}
+
+		int32 check = 0, mismatches = 0;
+		for (int32 w = 0; w < widthsCount; ++w) {
+			for (int32 i = 0; i < count; ++i) {
+				if (texts[i]->countHeight(widths[w], false) != texts[i]->countHeightSlow(widths[w])) {
+					++mismatches;
+				}
+			}
+		}
+		if (mismatches) {
+			LOG(("Text Benchmark Error: %1 heights are different from the full blocks walk").arg(mismatches));
+		}
+
+		QElapsedTimer timer;
+		timer.start();
+		for (int32 r = 0; r < rounds; ++r) {
+			for (int32 w = 0; w < widthsCount; ++w) {
+				for (int32 i = 0; i < count; ++i) {
+					check ^= texts[i]->countHeightSlow(widths[w]);
+				}
+			}
+		}
+		textHeightsLog("full walk, new widths", count, rounds * widthsCount * count, timer.nsecsElapsed());
+
+		timer.start();
+		for (int32 r = 0; r < rounds; ++r) {
+			for (int32 w = 0; w < widthsCount; ++w) { // more widths than remembered, so each call walks the blocks
+				for (int32 i = 0; i < count; ++i) {
+					check ^= texts[i]->countHeight(widths[w]);
+				}
+			}
+		}
+		textHeightsLog("paragraph shortcuts, new widths", count, rounds * widthsCount * count, timer.nsecsElapsed());
+
+		timer.start();
+		for (int32 r = 0; r < rounds * widthsCount; ++r) {
+			for (int32 i = 0; i < count; ++i) {
+				check ^= texts[i]->countHeightSlow(widths[(r % 2) ? 0 : (widthsCount - 1)]);
+			}
+		}
+		textHeightsLog("full walk, two widths toggled", count, rounds * widthsCount * count, timer.nsecsElapsed());
+
+		timer.start();
+		for (int32 r = 0; r < rounds * widthsCount; ++r) {
+			for (int32 i = 0; i < count; ++i) {
+				check ^= texts[i]->countHeight(widths[(r % 2) ? 0 : (widthsCount - 1)]);
+			}
+		}
+		textHeightsLog("remembered heights, two widths toggled", count, rounds * widthsCount * count, timer.nsecsElapsed());
+
+		for (int32 i = 0; i < count; ++i) {
+			delete texts[i];
+		}
+		LOG(("Text Benchmark: done, check %1").arg(check));
+		return true;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	settingsParseArgs(argc, argv);
+	logsInit();
+	cForceWorkingDir(cWorkingDir() + qsl("benchmark/")); // keys and config of the stand-in dc are never mixed with the app data
+
+	QStringList args;
+	for (int32 i = 1; i < argc; ++i) {
+		if (argv[i][0] != '-') args.push_back(QString::fromLocal8Bit(argv[i])); // -debug and others are for settingsParseArgs()
+	}
+	QString name(args.isEmpty() ? QString() : args.at(0));
+
+	QApplication a(argc, argv);
+
+	if (name == qsl("ids")) {
+		LOG(("Running benchmark %1..").arg(args.join(' ')));
+		benchmarkMsgIds(qMax((args.size() > 1) ? args.at(1).toInt() : 4000000, 1));
+		logsClose();
+		return 0;
+	} else if (name == qsl("crypto")) {
+		LOG(("Running benchmark %1..").arg(args.join(' ')));
+		benchmarkCrypto();
+		logsClose();
+		return 0;
+	} else if (name == qsl("text") && args.size() > 1) {
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/DejaVuSans.ttf")); // as in Application, the texts are laid out with the app fonts
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Regular.ttf"));
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Bold.ttf"));
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Semibold.ttf"));
+		style::startManager();
+		initEmoji();
+
+		LOG(("Running benchmark %1..").arg(args.join(' ')));
+		bool result = benchmarkTextHeights(args.at(1));
+		style::stopManager();
+		logsClose();
+		return result ? 0 : 1;
+	}
+
+	QObject *taskImpl = 0;
+	if (name == qsl("transport") && args.size() > 1) {
+		static const char *mixes[] = { "small", "upload", "download", "mixed" };
+		for (int32 i = 0; i < 4; ++i) {
+			if (args.at(1) == QLatin1String(mixes[i])) {
+				int32 count = (args.size() > 2) ? args.at(2).toInt() : ((i == MTProtoBenchmark::MixUpload || i == MTProtoBenchmark::MixDownload) ? 1000 : 10000);
+				int32 inFlight = (args.size() > 3) ? args.at(3).toInt() : 32;
+				taskImpl = new MTProtoBenchmark(MTProtoBenchmark::Mix(i), count, inFlight);
+				break;
+			}
+		}
+	}
+	if (!taskImpl) {
+		usage();
+		logsClose();
+		return 1;
+	}
+
+	LOG(("Running benchmark %1..").arg(args.join(' ')));
+	QObject::connect(taskImpl, SIGNAL(finished()), &a, SLOT(quit()));
+	QTimer::singleShot(0, taskImpl, SLOT(run()));
+
+	int result = a.exec();
+
+	MTP::stop();
+	logsClose();
+	return result;
+}
@@ -0,0 +1,486 @@
+/*
+This file is part of Telegram Desktop,
+an unofficial desktop messaging app, see https://telegram.org
+
+Telegram Desktop is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+It is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+Full license: https://github.com/telegramdesktop/tdesktop/blob/master/LICENSE
+Copyright (c) 2014 John Preston, https://tdesktop.com
+*/
+#include "stdafx.h"
+#include "mtpbenchmark.h"
+#include "benchmain.h"
+
+namespace {
+	const int32 BenchmarkSessionDc = MTP::dld + MTPBenchmarkDc; // killed after each run, so that the next one connects with another protocol
+}
+
+MTPbenchmarkServer::MTPbenchmarkServer(QThread *thread, const mtpAuthKeyPtr &key) : _server(0), _key(key), _salt(MTP::nonce<uint64>()), _framing(0), _payload(0) {
+	moveToThread(thread);
+}
+
+void MTPbenchmarkServer::takeTraffic(uint64 &framing, uint64 &payload) {
+	QMutexLocker lock(&_trafficLock);
+	framing = _framing;
+	payload = _payload;
+	_framing = _payload = 0;
+}
+
+void MTPbenchmarkServer::start() {
+	_server = new QTcpServer(this);
+	connect(_server, SIGNAL(newConnection()), this, SLOT(onNewConnection()));
+	if (!_server->listen(QHostAddress::LocalHost)) {
+		LOG(("Benchmark Error: could not listen, %1").arg(_server->errorString()));
+		emit listening(0);
+		return;
+	}
+	emit listening(_server->serverPort());
+}
+
+void MTPbenchmarkServer::onNewConnection() {
+	while (QTcpSocket *sock = _server->nextPendingConnection()) {
+		sock->setParent(this);
+		_clients.insert(sock, Client());
+		connect(sock, SIGNAL(readyRead()), this, SLOT(onSocketRead()));
+		connect(sock, SIGNAL(disconnected()), this, SLOT(onSocketDisconnected()));
+	}
+}
+
+void MTPbenchmarkServer::onSocketDisconnected() {
+	QTcpSocket *sock = qobject_cast<QTcpSocket*>(sender());
+	if (!sock) return;
+
+	_clients.remove(sock);
+	sock->deleteLater();
+}
+
+void MTPbenchmarkServer::onSocketRead() {
+	QTcpSocket *sock = qobject_cast<QTcpSocket*>(sender());
+	Clients::iterator i = sock ? _clients.find(sock) : _clients.end();
+	if (i == _clients.end()) return;
+
+	Client &client(i.value());
+	client.read.append(sock->readAll());
+	if (!client.protocolKnown) {
+		if (client.read.isEmpty()) return;
+		if (uchar(client.read.at(0)) == MTPTcpAbridgedTag) {
+			client.protocol = MTProtoConnection::TcpAbridged;
+			client.read.remove(0, 1);
+		} else {
+			if (client.read.size() < int32(sizeof(mtpPrime))) return;
+			if (*(const uint32*)client.read.constData() == MTPTcpIntermediateTag) {
+				client.protocol = MTProtoConnection::TcpIntermediate;
+				client.read.remove(0, sizeof(mtpPrime));
+			}
+		}
+		client.protocolKnown = true;
+		QMutexLocker lock(&_trafficLock);
+		_framing += (client.protocol == MTProtoConnection::TcpAbridged) ? 1 : ((client.protocol == MTProtoConnection::TcpIntermediate) ? sizeof(mtpPrime) : 0);
+	}
+
+	while (true) {
+		uint32 header = sizeof(mtpPrime), len = 0, sizeMin = 16;
+		if (client.protocol == MTProtoConnection::TcpAbridged) {
+			if (client.read.isEmpty()) break;
+			uchar first = uchar(client.read.at(0));
+			if (first == 0x7f) {
+				if (client.read.size() < int32(sizeof(mtpPrime))) break;
+				len = ((*(const uint32*)client.read.constData()) >> 8) << 2;
+			} else {
+				header = 1;
+				len = uint32(first) << 2;
+			}
+			sizeMin = 24;
+		} else {
+			if (client.read.size() < int32(sizeof(mtpPrime))) break;
+			len = *(const uint32*)client.read.constData();
+			if (client.protocol == MTProtoConnection::TcpIntermediate) {
+				sizeMin = 24;
+			} else {
+				header = 0; // full packet len includes its header
+			}
+		}
+		if (len < sizeMin || len > MTPPacketSizeMax || (len & 0x03)) {
+			LOG(("Benchmark Error: bad packet len %1").arg(len));
+			sock->close();
+			return;
+		}
+		if (uint32(client.read.size()) < header + len) break;
+
+		mtpBuffer packet(len >> 2);
+		memcpy(packet.data(), client.read.constData() + header, len);
+		client.read.remove(0, header + len);
+
+		const mtpPrime *data(packet.constData());
+		uint32 dataSize = packet.size();
+		if (client.protocol == MTProtoConnection::TcpFull) {
+			if (packet[dataSize - 1] != hashCrc32(data, (dataSize - 1) * sizeof(mtpPrime))) {
+				LOG(("Benchmark Error: bad packet checksum"));
+				sock->close();
+				return;
+			}
+			header = 3 * sizeof(mtpPrime);
+			data += 2;
+			dataSize -= 3;
+		}
+		{
+			QMutexLocker lock(&_trafficLock);
+			_framing += header;
+			_payload += dataSize * sizeof(mtpPrime);
+		}
+
+		try {
+			handlePacket(sock, client, data, dataSize);
+		} catch (Exception &e) {
+			LOG(("Benchmark Error: exception while handling packet, %1").arg(e.what()));
+			sock->close();
+			return;
+		}
+	}
+}
+
+void MTPbenchmarkServer::handlePacket(QTcpSocket *sock, Client &client, const mtpPrime *data, uint32 dataSize) {
+	if (dataSize < 6) throw Exception("bad packet");
+
+	if (!data[0] && !data[1]) { // not encrypted, can only be a fake req_pq of the auto connection
+		const mtpPrime *from(data + 5), *end(data + dataSize);
+		MTPReq_pq req_pq(from, end);
+
+		MTPResPQ res_pq(MTP_resPQ(req_pq.vnonce, MTP::nonce<MTPint128>(), MTP_string(string()), MTPVector<MTPlong>(0)));
+		mtpBuffer answer;
+		answer.reserve(8 + (res_pq.size() >> 2));
+		answer.push_back(0); // tcp packet len
+		answer.push_back(0); // tcp packet num
+		answer.push_back(0);
+		answer.push_back(0);
+		uint64 msgId = (uint64(unixtime()) << 32) | 1;
+		answer.push_back(mtpPrime(msgId & 0xFFFFFFFFL));
+		answer.push_back(mtpPrime(msgId >> 32));
+		answer.push_back(res_pq.size());
+		res_pq.write(answer);
+		answer.push_back(0); // tcp crc32 hash
+		return sendPacket(sock, client, answer);
+	}
+
+	if (dataSize < 18 || ((dataSize - 6) & 0x03)) throw Exception("bad encrypted message size");
+	if (*(const uint64*)data != _key->keyId()) throw Exception("bad auth_key_id");
+
+	MTPint128 msgKey(*(const MTPint128*)(data + 2));
+	MTPint256 aesKey, aesIV;
+	_key->prepareAES(msgKey, aesKey, aesIV); // the client encrypts with send = true
+
+	mtpBuffer decrypted(dataSize - 6);
+	aesDecrypt(data + 6, decrypted.data(), decrypted.size() * sizeof(mtpPrime), &aesKey, &aesIV);
+
+	uint64 session = *(const uint64*)&decrypted[2], msgId = *(const uint64*)&decrypted[4];
+	uint32 msgLen = (uint32)decrypted[7];
+	if ((msgLen & 0x03) || msgLen + 8 * sizeof(mtpPrime) > decrypted.size() * sizeof(mtpPrime)) throw Exception("bad msg_len");
+
+	const mtpPrime *from(decrypted.constData() + 8), *end(from + (msgLen >> 2));
+	handleMessage(sock, client, session, msgId, from, end);
+}
+
+void MTPbenchmarkServer::handleMessage(QTcpSocket *sock, Client &client, uint64 session, uint64 msgId, const mtpPrime *from, const mtpPrime *end) {
+	if (from >= end) throw mtpErrorInsufficient();
+
+	mtpTypeId type = *from;
+	switch (type) {
+	case mtpc_msg_container: {
+		if (++from >= end) throw mtpErrorInsufficient();
+		uint32 count = (uint32)*(from++);
+		for (uint32 i = 0; i < count; ++i) {
+			if (from + 4 > end) throw mtpErrorInsufficient();
+			uint64 inMsgId = *(const uint64*)from;
+			uint32 bytes = (uint32)from[3];
+			const mtpPrime *inEnd(from + 4 + (bytes >> 2));
+			if (inEnd > end) throw mtpErrorInsufficient();
+			handleMessage(sock, client, session, inMsgId, from + 4, inEnd);
+			from = inEnd;
+		}
+	} return;
+
+	case mtpc_msgs_ack:
+	case mtpc_msgs_state_req: // every request is answered at once, so there is nothing to resend
+	return;
+
+	case mtpc_ping:
+	case mtpc_ping_delay_disconnect: {
+		++from;
+		MTPlong pingId(from, end);
+		mtpBuffer body;
+		MTPPong(MTP_pong(MTP_long(msgId), pingId)).write(body);
+		sendMessage(sock, client, session, body, false);
+	} return;
+	}
+
+	while (true) { // skip invokeWithLayer and initConnection wraps
+		bool wrap = false;
+		for (uint32 i = 0; i < mtpLayerMax; ++i) {
+			if (type == mtpLayers[i]) {
+				wrap = true;
+				++from;
+				break;
+			}
+		}
+		if (type == mtpc_initConnection) {
+			wrap = true;
+			++from;
+			MTPint::skip(from, end); // api_id
+			for (int32 i = 0; i < 4; ++i) { // device_model, system_version, app_version, lang_code
+				MTPstring::skip(from, end);
+			}
+		}
+		if (!wrap) break;
+
+		if (from >= end) throw mtpErrorInsufficient();
+		type = *from;
+	}
+
+	mtpBuffer body;
+	body.push_back(mtpc_rpc_result);
+	body.push_back(mtpPrime(msgId & 0xFFFFFFFFL));
+	body.push_back(mtpPrime(msgId >> 32));
+
+	++from;
+	switch (type) {
+	case mtpc_help_getNearestDc: {
+		MTPNearestDc(MTP_nearestDc(MTP_string(string()), MTP_int(MTPBenchmarkDc), MTP_int(MTPBenchmarkDc))).write(body);
+	} break;
+
+	case mtpc_upload_getFile: {
+		MTPupload_getFile request(from, end);
+		int32 limit = qMax(request.vlimit.v, 0);
+		MTPupload_File(MTP_upload_file(MTP_storage_filePartial(), MTP_int(0), MTP_string(QByteArray(limit, 0)))).write(body);
+	} break;
+
+	case mtpc_upload_saveFilePart:
+	case mtpc_upload_saveBigFilePart: {
+		MTPBool(MTP_boolTrue()).write(body);
+	} break;
+
+	default: {
+		MTPRpcError(MTP_rpc_error(MTP_int(400), MTP_string("BENCHMARK_METHOD_INVALID"))).write(body);
+	} break;
+	}
+	sendMessage(sock, client, session, body, true);
+}
+
+void MTPbenchmarkServer::sendMessage(QTcpSocket *sock, Client &client, uint64 session, const mtpBuffer &body, bool needAck) {
+	uint64 msgId = qMax((uint64(unixtime()) << 32) | 1, client.lastMsgId + 4); // server replies have msg_id % 4 == 1
+	client.lastMsgId = msgId;
+	uint32 seqNo = needAck ? (client.seqNo++ * 2 + 1) : (client.seqNo * 2);
+
+	uint32 messageSize = 8 + body.size(), fullSize = (messageSize + 3) & ~3; // padded to 16 bytes
+	mtpBuffer message(fullSize);
+	*(uint64*)&message[0] = _salt;
+	*(uint64*)&message[2] = session;
+	*(uint64*)&message[4] = msgId;
+	message[6] = seqNo;
+	message[7] = body.size() * sizeof(mtpPrime);
+	memcpy(&message[8], body.constData(), body.size() * sizeof(mtpPrime));
+	if (fullSize > messageSize) memset_rand(&message[messageSize], (fullSize - messageSize) * sizeof(mtpPrime));
+
+	uchar sha1Buffer[20];
+	MTPint128 msgKey(*(MTPint128*)(((uchar*)hashSha1(message.constData(), messageSize * sizeof(mtpPrime), sha1Buffer)) + 4));
+	MTPint256 aesKey, aesIV;
+	_key->prepareAES(msgKey, aesKey, aesIV, false);
+
+	mtpBuffer packet(9 + fullSize);
+	*(uint64*)&packet[2] = _key->keyId();
+	*(MTPint128*)&packet[4] = msgKey;
+	aesEncrypt(message.constData(), &packet[8], fullSize * sizeof(mtpPrime), &aesKey, &aesIV);
+	sendPacket(sock, client, packet);
+}
+
+void MTPbenchmarkServer::sendPacket(QTcpSocket *sock, Client &client, mtpBuffer &packet) {
+	const char *from = 0;
+	uint32 len = mtpTcpFramePacket(packet, client.protocol, client.packetNum, false, from), payload = (packet.size() - 3) * sizeof(mtpPrime);
+	{
+		QMutexLocker lock(&_trafficLock);
+		_framing += len - payload;
+		_payload += payload;
+	}
+	sock->write(from, len);
+}
+
+MTProtoBenchmark::MTProtoBenchmark(Mix mix, int32 count, int32 inFlight) : _mix(mix), _protocol(MTProtoConnection::TcpFull), _count(qMax(count, 1)), _inFlight(qMax(inFlight, 1)),
+_sent(0), _done(0), _failed(0), _warmedUp(false), _finished(false), _thread(0), _server(0), _key(new mtpAuthKey()), _bytes(0),
+_startedAt(0), _startedCpu(0), _startedAllocations(0) {
+	char key[256];
+	for (int32 i = 0; i < 256; i += 16) { // fixed test key, so that packets are the same from run to run
+		uchar sha1Buffer[20];
+		int32 part = i;
+		memcpy(key + i, hashSha1(&part, sizeof(part), sha1Buffer), 16);
+	}
+	_key->setKey(key);
+	_key->setDC(MTPBenchmarkDc);
+
+	_timeout.setSingleShot(true);
+	connect(&_timeout, SIGNAL(timeout()), this, SLOT(onFinish()));
+}
+
+void MTProtoBenchmark::run() {
+	_thread = new QThread();
+	_server = new MTPbenchmarkServer(_thread, _key);
+	connect(_thread, SIGNAL(started()), _server, SLOT(start()));
+	connect(_thread, SIGNAL(finished()), _server, SLOT(deleteLater()));
+	connect(_thread, SIGNAL(finished()), _thread, SLOT(deleteLater()));
+	connect(_server, SIGNAL(listening(quint16)), this, SLOT(onServerListening(quint16)), Qt::QueuedConnection);
+
+	_timeout.start(MTPBenchmarkTimeout);
+	_latencies.reserve(_count);
+	_timer.start();
+	_thread->start();
+}
+
+void MTProtoBenchmark::onServerListening(quint16 port) {
+	if (!port) return onFinish();
+
+	if (!MTP::localKey().created()) {
+		MTP::createLocalKey(QByteArray());
+	}
+	mtpSetBenchmarkDc(MTPBenchmarkDc, "127.0.0.1", port, _key); // before MTP::start(), so that nothing else is connected
+	MTP::setLayer(mtpLayerMax);
+	MTP::start();
+
+	startRun();
+}
+
+void MTProtoBenchmark::startRun() {
+	_sent = _done = _failed = 0;
+	_warmedUp = _finished = false;
+	_sentAt.clear();
+	_latencies.clear();
+	_bytes = 0;
+
+	MTP::setTcpProtocol(BenchmarkSessionDc, MTProtoConnection::TcpProtocol(_protocol));
+	sendNext(); // warm up request, connection and salt are received while it is sent
+}
+
+void MTProtoBenchmark::sendNext() {
+	Mix type = _mix;
+	if (type == MixMixed) {
+		int32 index = _sent % 8;
+		type = (index == 6) ? MixUpload : ((index == 7) ? MixDownload : MixSmall);
+	}
+	if (!_warmedUp) type = MixSmall;
+
+	mtpRequestId req = 0;
+	switch (type) {
+	case MixUpload: {
+		req = MTP::send(MTPupload_SaveFilePart(MTP_long(_sent), MTP_int(_sent), MTP_string(QByteArray(DocumentUploadPartSize2, 1))), rpcDone(&MTProtoBenchmark::saveFilePartDone), rpcFail(&MTProtoBenchmark::requestFail), BenchmarkSessionDc);
+		_bytes += DocumentUploadPartSize2;
+	} break;
+	case MixDownload: {
+		req = MTP::send(MTPupload_GetFile(MTP_inputFileLocation(MTP_long(_sent), MTP_int(_sent), MTP_long(0)), MTP_int(0), MTP_int(DocumentDownloadPartSizeMax)), rpcDone(&MTProtoBenchmark::getFileDone), rpcFail(&MTProtoBenchmark::requestFail), BenchmarkSessionDc);
+		_bytes += DocumentDownloadPartSizeMax;
+	} break;
+	default: {
+		req = MTP::send(MTPhelp_GetNearestDc(), rpcDone(&MTProtoBenchmark::nearestDcDone), rpcFail(&MTProtoBenchmark::requestFail), BenchmarkSessionDc);
+	} break;
+	}
+	if (_warmedUp) ++_sent;
+	_sentAt.insert(req, _timer.nsecsElapsed() / 1000);
+}
+
+void MTProtoBenchmark::nearestDcDone(const MTPNearestDc &result, mtpRequestId req) {
+	requestDone(req);
+}
+
+void MTProtoBenchmark::saveFilePartDone(const MTPBool &result, mtpRequestId req) {
+	requestDone(req);
+}
+
+void MTProtoBenchmark::getFileDone(const MTPupload_File &result, mtpRequestId req) {
+	requestDone(req);
+}
+
+bool MTProtoBenchmark::requestFail(const RPCError &error, mtpRequestId req) {
+	LOG(("MTP Benchmark Error: request failed, %1 %2").arg(error.code()).arg(error.type()));
+	++_failed;
+	requestDone(req);
+	return true;
+}
+
+void MTProtoBenchmark::requestDone(mtpRequestId req) {
+	if (_finished) return;
+
+	SentAt::iterator i = _sentAt.find(req);
+	if (i == _sentAt.end()) return;
+
+	qint64 now = _timer.nsecsElapsed() / 1000;
+	if (!_warmedUp) {
+		_sentAt.erase(i);
+		_warmedUp = true;
+		_bytes = 0;
+		_startedAt = now;
+		_startedCpu = getcpums();
+		_startedAllocations = mtpArenaScope::heapAllocations();
+
+		uint64 framing, payload;
+		_server->takeTraffic(framing, payload); // count only the measured requests
+		while (_sent < _inFlight && _sent < _count) {
+			sendNext();
+		}
+		return;
+	}
+
+	_latencies.push_back(now - i.value());
+	_sentAt.erase(i);
+	if (++_done >= _count) {
+		_finished = true;
+		QTimer::singleShot(0, this, SLOT(onFinish())); // not from the session receive loop, the session is killed there
+	} else if (_sent < _count) {
+		sendNext();
+	}
+}
+
+void MTProtoBenchmark::onFinish() {
+	if (!_thread) return;
+
+	bool timedOut = !_timeout.isActive();
+	_finished = true;
+	logRun();
+	MTP::killSession(BenchmarkSessionDc);
+
+	if (!timedOut && _done > 0 && ++_protocol <= MTProtoConnection::TcpIntermediate) {
+		return startRun();
+	}
+
+	_timeout.stop();
+	_thread->quit();
+	_thread = 0;
+	emit finished();
+}
+
+void MTProtoBenchmark::logRun() {
+	if (_done > 0) {
+		qint64 time = qMax(_timer.nsecsElapsed() / 1000 - _startedAt, qint64(1));
+		uint64 cpu = getcpums() - _startedCpu;
+		uint32 allocations = mtpArenaScope::heapAllocations() - _startedAllocations;
+		uint64 framing, payload;
+		_server->takeTraffic(framing, payload);
+
+		qSort(_latencies);
+		qint64 p50 = _latencies.at(_latencies.size() / 2), p99 = _latencies.at((_latencies.size() * 99) / 100);
+
+		const char *mixes[] = { "small", "upload", "download", "mixed" };
+		LOG(("MTP Benchmark: transport %1, mix %2, %3 requests (%4 failed), %5 in flight").arg(MTP::dctransport(BenchmarkSessionDc)).arg(mixes[_mix]).arg(_done).arg(_failed).arg(_inFlight));
+		LOG(("MTP Benchmark: %1 requests/s, %2 MB/s, round trip p50 %3us, p99 %4us").arg(float64(_done) * 1000000. / time, 0, 'f', 1).arg(float64(_bytes) / time, 0, 'f', 2).arg(p50).arg(p99));
+		LOG(("MTP Benchmark: %1us cpu per request, %2 mtp data heap allocations per request, stand-in server work included").arg(float64(cpu) * 1000. / _done, 0, 'f', 1).arg(float64(allocations) / _done, 0, 'f', 2));
+		LOG(("MTP Benchmark: framing %1 bytes per request, %2% of %3 bytes of packets").arg(float64(framing) / _done, 0, 'f', 1).arg(payload ? (float64(framing) * 100. / payload) : 0., 0, 'f', 3).arg(payload));
+		if (_bytes) {
+			LOG(("MTP Benchmark: %1ms cpu per MB of file parts").arg(float64(cpu) * 1024. * 1024. / _bytes, 0, 'f', 2));
+		}
+	} else {
+		LOG(("MTP Benchmark Error: no requests done"));
+	}
+}
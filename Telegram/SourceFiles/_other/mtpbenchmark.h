@@ -0,0 +1,132 @@
+/*
+This file is part of Telegram Desktop,
+an unofficial desktop messaging app, see https://telegram.org
+
+Telegram Desktop is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+It is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+Full license: https://github.com/telegramdesktop/tdesktop/blob/master/LICENSE
+Copyright (c) 2014 John Preston, https://tdesktop.com
+*/
+#pragma once
+
+#include <QtNetwork/QTcpServer>
+
+enum {
+	MTPBenchmarkDc = 999, // the stand-in server is the only dc of the benchmark process
+	MTPBenchmarkTimeout = 120000, // 2 minutes for the whole transport benchmark
+};
+
+class MTPbenchmarkServer : public QObject { // local stand-in for a DC, speaks all tcp protocols with one fixed auth key and answers benchmark requests
+	Q_OBJECT
+
+public:
+
+	MTPbenchmarkServer(QThread *thread, const mtpAuthKeyPtr &key);
+
+	void takeTraffic(uint64 &framing, uint64 &payload); // bytes of tcp framing and of mtproto packets since the last call, both directions
+
+signals:
+
+	void listening(quint16 port);
+
+public slots:
+
+	void start();
+	void onNewConnection();
+	void onSocketRead();
+	void onSocketDisconnected();
+
+private:
+
+	struct Client {
+		Client() : protocolKnown(false), protocol(MTProtoConnection::TcpFull), packetNum(0), lastMsgId(0), seqNo(0) {
+		}
+		QByteArray read;
+		bool protocolKnown;
+		MTProtoConnection::TcpProtocol protocol;
+		uint32 packetNum;
+		uint64 lastMsgId;
+		uint32 seqNo;
+	};
+	typedef QMap<QTcpSocket*, Client> Clients;
+
+	void handlePacket(QTcpSocket *sock, Client &client, const mtpPrime *data, uint32 dataSize);
+	void handleMessage(QTcpSocket *sock, Client &client, uint64 session, uint64 msgId, const mtpPrime *from, const mtpPrime *end);
+	void sendPacket(QTcpSocket *sock, Client &client, mtpBuffer &packet); // packet has place for len, num and crc32
+	void sendMessage(QTcpSocket *sock, Client &client, uint64 session, const mtpBuffer &body, bool needAck);
+
+	QTcpServer *_server;
+	Clients _clients;
+	mtpAuthKeyPtr _key;
+	uint64 _salt;
+
+	QMutex _trafficLock; // counters are taken from the main thread
+	uint64 _framing, _payload;
+
+};
+
+class MTProtoBenchmark : public QObject, public RPCSender { // runs requests through the stand-in server with each tcp protocol, result goes to log
+	Q_OBJECT
+
+public:
+
+	enum Mix {
+		MixSmall, // help.getNearestDc
+		MixUpload, // upload.saveFilePart with DocumentUploadPartSize2 bytes
+		MixDownload, // upload.getFile of DocumentDownloadPartSizeMax bytes
+		MixMixed, // 6 small requests for each upload and download part
+	};
+
+	MTProtoBenchmark(Mix mix, int32 count, int32 inFlight);
+
+signals:
+
+	void finished();
+
+public slots:
+
+	void run();
+	void onServerListening(quint16 port);
+	void onFinish();
+
+private:
+
+	void startRun();
+	void logRun();
+	void sendNext();
+	void nearestDcDone(const MTPNearestDc &result, mtpRequestId req);
+	void saveFilePartDone(const MTPBool &result, mtpRequestId req);
+	void getFileDone(const MTPupload_File &result, mtpRequestId req);
+	bool requestFail(const RPCError &error, mtpRequestId req);
+	void requestDone(mtpRequestId req);
+
+	Mix _mix;
+	int32 _protocol; // MTProtoConnection::TcpProtocol of the current run
+	int32 _count, _inFlight, _sent, _done, _failed;
+	bool _warmedUp, _finished;
+
+	QThread *_thread;
+	MTPbenchmarkServer *_server;
+	mtpAuthKeyPtr _key;
+
+	QElapsedTimer _timer;
+	typedef QMap<mtpRequestId, qint64> SentAt; // in microseconds
+	SentAt _sentAt;
+	QVector<qint64> _latencies;
+	uint64 _bytes;
+
+	qint64 _startedAt;
+	uint64 _startedCpu;
+	uint32 _startedAllocations;
+
+	QTimer _timeout;
+
+};
@@ -505,6 +505,12 @@ namespace App {
 	}
 
 	void feedMsgs(const MTPVector<MTPMessage> &msgs, bool newMsgs) {
+		QVector<MTPMessage> sorted;
+		sortMsgs(msgs, sorted);
+		histories().addToBack(sorted, newMsgs ? 1 : 0);
+	}
+
+	void sortMsgs(const MTPVector<MTPMessage> &msgs, QVector<MTPMessage> &result) {
 		const QVector<MTPMessage> &v(msgs.c_vector().v);
 		QMap<int32, int32> msgsIds;
 		for (int32 i = 0, l = v.size(); i < l; ++i) {
@@ -516,9 +522,35 @@ namespace App {
 			case mtpc_messageService: msgsIds.insert(msg.c_messageService().vid.v, i); break;
 			}
 		}
+		result.clear();
+		result.reserve(msgsIds.size());
 		for (QMap<int32, int32>::const_iterator i = msgsIds.cbegin(), e = msgsIds.cend(); i != e; ++i) {
-			histories().addToBack(v[*i], newMsgs ? 1 : 0);
+			result.push_back(v[*i]);
+		}
+	}
+
+	void feedMsgs(const MTPvectorView<MTPBoxedView<MTPmessageView> > &msgs, bool newMsgs) {
+		typedef MTPvectorView<MTPBoxedView<MTPmessageView> > MessagesView;
+		QMap<int32, MTPMessage> msgsById; // by id, the order feedMsgs adds them in
+		for (MessagesView::const_iterator i = msgs.cbegin(), e = msgs.cend(); i != e; ++i) {
+			MTPBoxedView<MTPmessageView> msg(*i);
+			MsgId msgId = idFromMessage(msg);
+			HistoryItem *existing = histItemById(msgId);
+			if (existing && existing->history()->loadedAtBottom()) continue; // History::addNewMessages would create and drop it
+
+			msgsById.insert(msgId, msg.read());
 		}
+		histories().addToBack(msgsById.values().toVector(), newMsgs ? 1 : 0);
+	}
+
+	MsgId idFromMessage(const MTPmessageView &msg) {
+		switch (msg.type()) {
+		case mtpc_message: return msg.c_message().vid().v;
+		case mtpc_messageEmpty: return msg.c_messageEmpty().vid().v;
+		case mtpc_messageForwarded: return msg.c_messageForwarded().vid().v;
+		case mtpc_messageService: return msg.c_messageService().vid().v;
+		}
+		return 0;
 	}
 
 	int32 maxMsgId() {
@@ -1570,6 +1602,9 @@ namespace App {
 				stream << quint32(dbiAskDownloadPath) << qint32(cAskDownloadPath());
 				stream << quint32(dbiDownloadPath) << (cAskDownloadPath() ? QString() : cDownloadPath());
 				stream << quint32(dbiCompressPastedImage) << qint32(cCompressPastedImage());
+				stream << quint32(dbiPrepareDcAuth) << qint32(cPrepareDcAuth());
+				stream << quint32(dbiHistoryLayoutBudget) << qint32(cHistoryLayoutBudget());
+				stream << quint32(dbiUploadBytesInFlight) << qint32(cUploadBytesInFlight());
 				stream << quint32(dbiEmojiTab) << qint32(cEmojiTab());
 
 				RecentEmojiPreload v;
@@ -1758,6 +1793,24 @@ namespace App {
 				cSetCompressPastedImage(v == 1);
 			} break;
 
+			case dbiPrepareDcAuth: {
+				qint32 v;
+				stream >> v;
+				cSetPrepareDcAuth(v == 1);
+			} break;
+
+			case dbiHistoryLayoutBudget: {
+				qint32 v;
+				stream >> v;
+				cSetHistoryLayoutBudget(qMax(v, 0));
+			} break;
+
+			case dbiUploadBytesInFlight: {
+				qint32 v;
+				stream >> v;
+				if (v > 0) cSetUploadBytesInFlight(v);
+			} break;
+
 			case dbiEmojiTab: {
 				qint32 v;
 				stream >> v;
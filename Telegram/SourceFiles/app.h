@@ -72,6 +72,9 @@ namespace App {
 	void feedParticipantAdd(const MTPDupdateChatParticipantAdd &d);
 	void feedParticipantDelete(const MTPDupdateChatParticipantDelete &d);
 	void feedMsgs(const MTPVector<MTPMessage> &msgs, bool newMsgs = false);
+	void sortMsgs(const MTPVector<MTPMessage> &msgs, QVector<MTPMessage> &result); // by id, the order feedMsgs adds them in
+	void feedMsgs(const MTPvectorView<MTPBoxedView<MTPmessageView> > &msgs, bool newMsgs = false); // materializes only the messages not loaded yet
+	MsgId idFromMessage(const MTPmessageView &msg);
 	void feedWereRead(const QVector<MTPint> &msgsIds);
 	void feedWereDeleted(const QVector<MTPint> &msgsIds);
 	void feedUserLinks(const MTPVector<MTPcontacts_Link> &links);
@@ -29,19 +29,40 @@ static const wchar_t *AppFile = L"Telegram";
 #include "settings.h"
 
 enum {
-	MTPShortBufferSize = 65535, // of ints, 256 kb
+	MTPShortBufferSize = 65535, // of ints, 256 kb, bigger received packets are not returned to the receive buffers pool
+	MTPReceiveBuffersPoolSize = 8, // how many received packet buffers each tcp connection keeps for reuse
 	MTPPacketSizeMax = 67108864, // 64 mb
 	MTPIdsBufferSize = 400, // received msgIds and wereAcked msgIds count stored
-	MTPCheckResendTimeout = 5000, // how much time passed from send till we resend request or check it's state, in ms
-	MTPCheckResendWaiting = 1000, // how much time to wait for some more requests, when resending request or checking it's state, in ms
+	MTPCheckResendTimeout = 5000, // how much time passed from send till we resend request or check it's state, in ms, until the first rtt sample
+	MTPCheckResendWaiting = 1000, // how much time to wait for some more requests, when resending request or checking it's state, in ms, at most
+	MTPResendTimeoutMin = 2000, // resend timeout derived from rtt estimate (srtt + 4 * rttvar) is kept in 2..60 seconds
+	MTPResendTimeoutMax = 60000,
+	MTPCheckRequestsIntervalMax = 10000, // sent requests are checked at least once in 10 seconds, even if no resend timeout ends
 	MTPResendThreshold = 1, // how much ints should message contain for us not to resend, but to check it's state
 	MTPContainerLives = 600, // container lives 10 minutes in haveSent map
+	MTPContainerSizeMax = 16384, // of bytes, requests are split to several containers if they don't fit
+	MTPContainerCountMax = 1020, // max messages count in one container
+	MTPArenaBlockSize = 16384, // of bytes, data of parsed MTP objects is allocated in blocks of this size
 	MTPMaxReceiveDelay = 64000, // 64 seconds
 	MTPConnectionOldTimeout = 192000, // 192 seconds
 	MTPTcpConnectionWaitTimeout = 3000, // 3 seconds waiting for tcp, until we accept http
+	MTPDcEndpointProbeInterval = 300000, // all endpoints of a dc are probed in parallel not more often than once in 5 minutes
+	MTPDcEndpointProbeTimeout = 10000, // probe not connected in 10 seconds counts as endpoint failure
+	MTPDcEndpointUnknownRtt = 1000, // rtt estimate in ms for the endpoints that were not probed yet
+	MTPDcEndpointFailurePenalty = 5000, // ms added to the endpoint rtt estimate for each failure in a row
+	MTPDcEndpointFailuresMax = 8, // failures in a row counted for the endpoint score, so a long broken endpoint can come back
 	MTPMillerRabinIterCount = 30, // 30 Miller-Rabin iterations for dh_prime primality check
+	MTPGoodPrimesCacheSize = 16, // dh_prime values that passed the primality check are not checked again
+	MTPFutureSaltsCount = 32, // how many future salts are asked with get_future_salts, each is valid for about an hour
+	MTPFutureSaltsRequestBefore = 3600, // ask for more future salts when the known ones end in less than an hour, in seconds
+	MTPFutureSaltsRequestRetry = 60000, // do not ask for future salts more often than once a minute, in ms
 
 	MTPEnumDCTimeout = 4000, // 4 seconds timeout for help_getConfig to work (them move to other dc)
+	MTPPrepareDcAuthDelay = 10000, // background auth preparing for other dcs starts 10 seconds after login
+	MTPPrepareDcAuthInterval = 5000, // 5 seconds pause between dcs in background auth preparing
+	MTPPrepareDcAuthTimeout = 60000, // background auth preparing of one dc is given up after 1 minute
+
+	MTPStatsDumpInterval = 10000, // MTP::stats() are written to file every 10 seconds, when dumping is enabled
 
 	MinReceiveDelay = 1000, // 1 seconds
 	MaxSelectedItems = 100,
@@ -201,7 +222,10 @@ enum {
 	LinkCropLimit = 360, // 360px link length max
 
 	DownloadPartSize = 32 * 1024, // 32kb for photo
-	DocumentDownloadPartSize = 128 * 1024, // 128kb for document
+	DocumentDownloadPartSize = 128 * 1024, // 128kb for document, first parts
+	DocumentDownloadPartSizeMax = 512 * 1024, // 512kb for document, when parts are downloaded fast
+	DownloadPartGrowTimeout = 500, // part downloaded in less than 0.5 secs lets the next parts be twice bigger
+	DownloadPartsInFlight = 4, // max 4 parts of one file downloaded at the same time
 	MaxUploadPhotoSize = 10 * 1024 * 1024, // 10mb photos max
     MaxUploadDocumentSize = 1500 * 1024 * 1024, // 1500mb documents max
     UseBigFilesFrom = 10 * 1024 * 1024, // mtp big files methods used for files greater than 10mb
@@ -214,11 +238,23 @@ enum {
     DocumentUploadPartSize2 = 128 * 1024, // 128kb for small document ( <= 375mb )
     DocumentUploadPartSize3 = 256 * 1024, // 256kb for medium document ( <= 750mb )
     DocumentUploadPartSize4 = 512 * 1024, // 512kb for large document ( <= 1500mb )
-    MaxUploadFileParallelSize = 512 * 1024, // max 512kb uploaded at the same time
+    MaxUploadFileParallelSize = 2 * 1024 * 1024, // default cUploadBytesInFlight(), max 2mb uploaded at the same time, shared by all the uploading files
+    UploadSessionsCount = 4, // file parts are sent through MTP::upl and 3 more upload sessions
+    UploadReadBufferSize = 4 * 1024 * 1024, // max 4mb of document parts read ahead by the uploader thread
     UploadRequestInterval = 500, // one part each half second, if not uploaded faster
 
 	MaxPhotosInMemory = 50, // try to clear some memory after 50 photos are created
 	NoUpdatesTimeout = 180 * 1000, // if nothing is received in 3 min we reconnect
+	DifferenceSliceMessages = 50, // getDifference messages are added to histories by 50 each event loop turn
+	DifferenceSliceUpdates = 100, // and other updates by 100
+	DifferencePartsMax = 2, // next differenceSlice is requested while less than 2 received ones wait to be applied
+
+	HistoryResizeBackgroundMsgs = 200, // on width change texts of histories with 200+ messages are counted in background, except near the scroll position
+	HistoryResizeCheckTimeout = 16, // background counting results are checked each 16ms
+	HistoryLayoutBudgetDefault = 8 * 1024 * 1024, // when message texts of a history take more than 8mb, the ones far from the scroll position are unloaded
+	HistoryLayoutCheckTimeout = 1000, // texts are unloaded 1 second after the last scroll
+
+	TextHeightsRemembered = 4, // Text::countHeight() results for the last 4 widths are kept in each text
 
 	MemoryForImageCache = 64 * 1024 * 1024, // after 64mb of unpacked images we try to clear some memory
 	NotifyWindowsCount = 3, // 3 desktop notifies at the same time
@@ -1106,50 +1106,46 @@ void DialogsWidget::unreadCountsReceived(const QVector<MTPDialog> &dialogs) {
 	if (App::wnd()) App::wnd()->psUpdateCounter();
 }
 
-void DialogsWidget::dialogsReceived(const MTPmessages_Dialogs &dialogs) {
-	const QVector<MTPDialog> *dlgList = 0;
+void DialogsWidget::dialogsReceived(const mtpPrime *from, const mtpPrime *end) { // read by views, so the top messages already loaded are not materialized
+	MTPBoxedView<MTPmessages_dialogsView> dialogs(from, end);
+	MTPvector<MTPDialog> dialogsVector;
 	switch (dialogs.type()) {
 	case mtpc_messages_dialogs: {
-		const MTPDmessages_dialogs &data(dialogs.c_messages_dialogs());
-		App::feedUsers(data.vusers);
-		App::feedChats(data.vchats);
-		App::feedMsgs(data.vmessages);
-		dlgList = &data.vdialogs.c_vector().v;
-		dlgCount = dlgList->size();
+		MTPDmessages_dialogsView data(dialogs.c_messages_dialogs());
+		App::feedUsers(data.vusers().read<MTPvector<MTPUser> >());
+		App::feedChats(data.vchats().read<MTPvector<MTPChat> >());
+		App::feedMsgs(data.vmessages());
+		dialogsVector = data.vdialogs().read<MTPvector<MTPDialog> >();
+		dlgCount = dialogsVector.c_vector().v.size();
 	} break;
 	case mtpc_messages_dialogsSlice: {
-		const MTPDmessages_dialogsSlice &data(dialogs.c_messages_dialogsSlice());
-		App::feedUsers(data.vusers);
-		App::feedChats(data.vchats);
-		App::feedMsgs(data.vmessages);
-		dlgList = &data.vdialogs.c_vector().v;
-		dlgCount = data.vcount.v;
+		MTPDmessages_dialogsSliceView data(dialogs.c_messages_dialogsSlice());
+		App::feedUsers(data.vusers().read<MTPvector<MTPUser> >());
+		App::feedChats(data.vchats().read<MTPvector<MTPChat> >());
+		App::feedMsgs(data.vmessages());
+		dialogsVector = data.vdialogs().read<MTPvector<MTPDialog> >();
+		dlgCount = data.vcount().v;
 	} break;
 	}
+	const QVector<MTPDialog> &dlgList(dialogsVector.c_vector().v);
 
-	unreadCountsReceived(*dlgList);
+	unreadCountsReceived(dlgList);
 
 	if (!contactsRequest) {
 		contactsRequest = MTP::send(MTPcontacts_GetContacts(MTP_string("")), rpcDone(&DialogsWidget::contactsReceived), rpcFail(&DialogsWidget::contactsFailed));
 	}
 
-	if (dlgList) {
-		list.dialogsReceived(*dlgList);
-		onListScroll();
+	list.dialogsReceived(dlgList);
+	onListScroll();
 
-		if (dlgList->size()) {
-			dlgOffset += dlgList->size();
-		} else {
-			dlgCount = dlgOffset;
-		}
+	if (dlgList.size()) {
+		dlgOffset += dlgList.size();
 	} else {
 		dlgCount = dlgOffset;
 	}
 
 	dlgPreloading = 0;
-	if (dlgList) {
-		loadDialogs();
-	}
+	loadDialogs();
 }
 
 bool DialogsWidget::dialogsFailed(const RPCError &e) {
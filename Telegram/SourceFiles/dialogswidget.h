@@ -137,7 +137,7 @@ class DialogsWidget : public QWidget, public Animated, public RPCSender {
 public:
 	DialogsWidget(MainWidget *parent);
 
-	void dialogsReceived(const MTPmessages_Dialogs &dialogs);
+	void dialogsReceived(const mtpPrime *from, const mtpPrime *end);
 	void contactsReceived(const MTPcontacts_Contacts &contacts);
 	void searchReceived(bool fromStart, const MTPmessages_Messages &result, mtpRequestId req);
 	bool addNewContact(int32 uid, bool show = true);
@@ -18,7 +18,92 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 #include "stdafx.h"
 #include "fileuploader.h"
 
-FileUploader::FileUploader() : sentSize(0), uploading(0) {
+FileUploaderReader::FileUploaderReader(FileUploader *uploader, QThread *thread) : QObject(0), uploader(uploader) {
+	moveToThread(thread);
+	connect(uploader, SIGNAL(needToRead()), this, SLOT(readParts()));
+	connect(this, SIGNAL(partsRead()), uploader, SLOT(sendNext()));
+}
+
+void FileUploaderReader::readFailed(MsgId msgId) {
+	{
+		QMutexLocker lock(uploader->readMutex());
+		FileUploader::ReadState &state(uploader->readState());
+		if (!state.cancelled.contains(msgId)) {
+			state.ready[msgId].failed = true;
+		}
+	}
+	files.pop_front();
+	emit partsRead();
+}
+
+void FileUploaderReader::readParts() {
+	while (true) {
+		{
+			QMutexLocker lock(uploader->readMutex());
+			FileUploader::ReadState &state(uploader->readState());
+			for (QList<FileUploader::ToRead>::const_iterator i = state.toRead.cbegin(), e = state.toRead.cend(); i != e; ++i) {
+				files.push_back(File(i->msgId, i->path, i->data, i->partSize, i->partsCount, i->needHash));
+			}
+			state.toRead.clear();
+			if (!state.cancelled.isEmpty()) {
+				for (Files::iterator i = files.begin(); i != files.end();) {
+					if (state.cancelled.contains(i->msgId)) {
+						i = files.erase(i);
+					} else {
+						++i;
+					}
+				}
+				state.cancelled.clear();
+			}
+			if (files.isEmpty() || state.readySize >= UploadReadBufferSize) return;
+		}
+
+		File &f(files.front());
+		QByteArray part;
+		if (f.data.isEmpty()) {
+			if (!f.file) {
+				f.file.reset(new QFile(f.path));
+				if (!f.file->open(QIODevice::ReadOnly)) {
+					readFailed(f.msgId);
+					continue;
+				}
+			}
+			part = f.file->read(f.partSize);
+		} else {
+			part = f.data.mid(f.partsRead * f.partSize, f.partSize);
+		}
+		if (part.size() > f.partSize || (part.size() < f.partSize && f.partsRead + 1 != f.partsCount)) {
+			readFailed(f.msgId);
+			continue;
+		}
+		if (f.needHash) {
+			f.hash.feed(part.constData(), part.size());
+		}
+
+		bool last = (++f.partsRead == f.partsCount);
+		{
+			QMutexLocker lock(uploader->readMutex());
+			FileUploader::ReadState &state(uploader->readState());
+			if (!state.cancelled.contains(f.msgId)) {
+				FileUploader::ReadyFile &ready(state.ready[f.msgId]);
+				ready.parts.insert(f.partsRead - 1, part);
+				state.readySize += part.size();
+				if (last && f.needHash) {
+					ready.md5.resize(32);
+					hashMd5Hex(f.hash.result(), ready.md5.data());
+				}
+			}
+		}
+		if (last) {
+			files.pop_front();
+		} else if (files.size() > 1) {
+			files.push_back(files.takeFirst());
+		}
+		emit partsRead();
+	}
+}
+
+FileUploader::FileUploader() : sentSize(0), nextSession(0), sendNextFrom(0), thread(0), reader(0) {
 	nextTimer.setSingleShot(true);
 	connect(&nextTimer, SIGNAL(timeout()), this, SLOT(sendNext()));
 }
@@ -39,118 +124,205 @@ void FileUploader::uploadMedia(MsgId msgId, const ReadyLocalMedia &media) {
 			document->modDate = QFileInfo(media.file).lastModified();
 		}
 	}
-	queue.insert(msgId, File(media));
+	Queue::iterator i = queue.insert(msgId, File(media));
+	if (media.type == ToPrepareDocument) {
+		{
+			QMutexLocker lock(readMutex());
+			read.toRead.push_back(ToRead(msgId, media.file, media.data, i->docPartSize, i->docPartsCount, i->docSize <= UseBigFilesFrom));
+		}
+		if (!thread) {
+			thread = new QThread();
+			reader = new FileUploaderReader(this, thread);
+			thread->start();
+		}
+		emit needToRead();
+	}
 	sendNext();
 }
 
-void FileUploader::currentFailed() {
-	Queue::iterator j = queue.find(uploading);
-	if (j != queue.end()) {
-		if (j->media.type == ToPreparePhoto) {
-			emit photoFailed(j.key());
-		} else if (j->media.type == ToPrepareDocument) {
-			DocumentData *doc = App::document(j->media.id);
-			if (doc->status == FileUploading) {
-				doc->status = FileFailed;
+QMutex *FileUploader::readMutex() {
+	return &readLock;
+}
+
+FileUploader::ReadState &FileUploader::readState() {
+	return read;
+}
+
+void FileUploader::cancelRead(MsgId msgId) {
+	if (!thread) return;
+	{
+		QMutexLocker lock(readMutex());
+		QMap<MsgId, ReadyFile>::iterator i = read.ready.find(msgId);
+		if (i != read.ready.end()) {
+			for (QMap<int32, QByteArray>::const_iterator j = i->parts.cbegin(), e = i->parts.cend(); j != e; ++j) {
+				read.readySize -= j.value().size();
 			}
-			emit documentFailed(j.key());
+			read.ready.erase(i);
 		}
-		queue.erase(j);
+		read.cancelled.insert(msgId);
 	}
+	emit needToRead();
+}
 
-	requestsSent.clear();
-	docRequestsSent.clear();
-	queue.remove(uploading);
-	uploading = 0;
-	sentSize = 0;
+void FileUploader::fileFailed(MsgId msgId) {
+	Queue::iterator j = queue.find(msgId);
+	if (j == queue.end()) return;
 
-	sendNext();
-}
+	ToPrepareMediaType type = j->media.type;
+	uint64 id = j->media.id;
+	queue.erase(j);
 
-void FileUploader::sendNext() {
-	if (sentSize >= MaxUploadFileParallelSize || queue.isEmpty()) return;
-
-	Queue::iterator i = uploading ? queue.find(uploading) : queue.begin();
-	if (!uploading) {
-		uploading = i.key();
-	} else if (i == queue.end()) {
-		i = queue.begin(); 
-		uploading = i.key();
-	}
-	if (i->media.parts.isEmpty()) {
-		if (i->docSentParts >= i->docPartsCount) {
-			if (requestsSent.isEmpty() && docRequestsSent.isEmpty()) {
-				if (i->media.type == ToPreparePhoto) {
-					emit photoReady(uploading, MTP_inputFile(MTP_long(i->media.id), MTP_int(i->partsCount), MTP_string(i->media.filename), MTP_string(i->media.jpeg_md5)));
-				} else if (i->media.type == ToPrepareDocument) {
-					QByteArray docMd5(32, Qt::Uninitialized);
-					hashMd5Hex(i->docHash.result(), docMd5.data());
-
-					MTPInputFile doc = (i->docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename)) : MTP_inputFile(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename), MTP_string(docMd5));
-					if (i->partsCount) {
-						emit thumbDocumentReady(uploading, doc, MTP_inputFile(MTP_long(i->media.jpeg_id), MTP_int(i->partsCount), MTP_string(i->media.filename), MTP_string(i->media.jpeg_md5)));
-					} else {
-						emit documentReady(uploading, doc);
-					}
-				}
-				queue.remove(uploading);
-				uploading = 0;
-				sendNext();
-			}
-			return;
+	for (SentRequests::iterator i = requestsSent.begin(); i != requestsSent.end();) {
+		if (i->msgId == msgId) {
+			MTP::cancel(i.key());
+			sentSize -= i->size;
+			i = requestsSent.erase(i);
+		} else {
+			++i;
 		}
+	}
+	cancelRead(msgId);
 
-		QByteArray toSend;
-		if (i->media.data.isEmpty()) {
-			if (!i->docFile) {
-				i->docFile.reset(new QFile(i->media.file));
-				if (!i->docFile->open(QIODevice::ReadOnly)) {
-					currentFailed();
-					return;
-				}
-			}
-			toSend = i->docFile->read(i->docPartSize);
-			if (i->docSize <= UseBigFilesFrom) {
-				i->docHash.feed(toSend.constData(), toSend.size());
-			}
-		} else {
-			toSend = i->media.data.mid(i->docSentParts * i->docPartSize, i->docPartSize);
-			if (i->media.type == ToPrepareDocument && i->docSentParts <= UseBigFilesFrom) {
-				i->docHash.feed(toSend.constData(), toSend.size());
-			}
+	if (type == ToPreparePhoto) {
+		emit photoFailed(msgId);
+	} else if (type == ToPrepareDocument) {
+		DocumentData *doc = App::document(id);
+		if (doc->status == FileUploading) {
+			doc->status = FileFailed;
+		}
+		emit documentFailed(msgId);
+	}
+
+	QTimer::singleShot(0, this, SLOT(sendNext())); // may be called from sendNext() through fileDone()
+}
+
+bool FileUploader::fileDone(Queue::iterator i) {
+	if (i->media.type == ToPrepareDocument) {
+		bool failed = false;
+		{
+			QMutexLocker lock(readMutex());
+			QMap<MsgId, ReadyFile>::const_iterator j = read.ready.constFind(i.key());
+			failed = (j != read.ready.cend()) && j->failed;
 		}
-		if (toSend.size() > i->docPartSize || (toSend.size() < i->docPartSize && i->docSentParts + 1 != i->docPartsCount)) {
-			currentFailed();
-			return;
+		if (failed) {
+			fileFailed(i.key());
+			return true;
 		}
-		mtpRequestId requestId;
-		if (i->docSize > UseBigFilesFrom) {
-			requestId = MTP::send(MTPupload_SaveBigFilePart(MTP_long(i->media.id), MTP_int(i->docSentParts), MTP_int(i->docPartsCount), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl);
+	}
+	if (!i->media.parts.isEmpty() || i->docSentParts < i->docPartsCount || i->sentRequests) return false;
+
+	MsgId msgId = i.key();
+	if (i->media.type == ToPreparePhoto) {
+		MTPInputFile photo = MTP_inputFile(MTP_long(i->media.id), MTP_int(i->partsCount), MTP_string(i->media.filename), MTP_string(i->media.jpeg_md5));
+		queue.erase(i);
+		emit photoReady(msgId, photo);
+	} else if (i->media.type == ToPrepareDocument) {
+		MTPInputFile doc = (i->docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename)) : MTP_inputFile(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename), MTP_string(i->docMd5));
+		if (i->partsCount) {
+			MTPInputFile thumb = MTP_inputFile(MTP_long(i->media.jpeg_id), MTP_int(i->partsCount), MTP_string(i->media.filename), MTP_string(i->media.jpeg_md5));
+			queue.erase(i);
+			cancelRead(msgId);
+			emit thumbDocumentReady(msgId, doc, thumb);
 		} else {
-			requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(i->media.id), MTP_int(i->docSentParts), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl);
+			queue.erase(i);
+			cancelRead(msgId);
+			emit documentReady(msgId, doc);
+		}
+	} else {
+		queue.erase(i);
+	}
+	return true;
+}
+
+bool FileUploader::sendPart(Queue::iterator i) {
+	QByteArray toSend;
+	int32 part = 0;
+	uint64 fileId = 0;
+	if (!i->media.parts.isEmpty()) {
+		LocalFileParts::iterator j = i->media.parts.begin();
+		part = j.key();
+		toSend = j.value();
+		fileId = i->media.jpeg_id;
+		i->media.parts.erase(j);
+	} else {
+		if (i->docSentParts >= i->docPartsCount) return false;
+		{
+			QMutexLocker lock(readMutex());
+			QMap<MsgId, ReadyFile>::iterator j = read.ready.find(i.key());
+			if (j == read.ready.end()) return false;
+
+			QMap<int32, QByteArray>::iterator k = j->parts.find(i->docSentParts);
+			if (k == j->parts.end()) return false;
+
+			toSend = k.value();
+			j->parts.erase(k);
+			read.readySize -= toSend.size();
+			if (i->docSentParts + 1 == i->docPartsCount) {
+				i->docMd5 = j->md5;
+			}
 		}
-		docRequestsSent.insert(requestId, i->docSentParts);
-		sentSize += i->docPartSize;
+		emit needToRead();
+
+		part = i->docSentParts++;
+		fileId = i->media.id;
+	}
+
+	int32 dc = MTP::uplSession(nextSession);
+	nextSession = (nextSession + 1) % UploadSessionsCount;
 
-		i->docSentParts++;
+	mtpRequestId requestId;
+	if (i->docSize > UseBigFilesFrom && fileId == i->media.id) {
+		requestId = MTP::send(MTPupload_SaveBigFilePart(MTP_long(fileId), MTP_int(part), MTP_int(i->docPartsCount), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), dc);
 	} else {
-		LocalFileParts::iterator part = i->media.parts.begin();
-	
-		mtpRequestId requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(i->media.jpeg_id), MTP_int(part.key()), MTP_string(part.value())), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl);
-		requestsSent.insert(requestId, part.value());
-		sentSize += part.value().size();
+		requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(fileId), MTP_int(part), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), dc);
+	}
+	requestsSent.insert(requestId, SentRequest(i.key(), toSend.size(), fileId == i->media.id));
+	sentSize += toSend.size();
+	++i->sentRequests;
+	return true;
+}
+
+void FileUploader::sendNext() {
+	bool sent = false;
+	for (Queue::iterator i = queue.begin(); i != queue.end();) {
+		if (fileDone(i)) { // signals were emitted, queue could be changed
+			i = queue.begin();
+			continue;
+		}
+		++i;
+	}
 
-		i->media.parts.erase(part);
+	int32 budget = cUploadBytesInFlight();
+	bool sentInPass = true;
+	while (sentInPass && sentSize < budget) { // one part of each file per pass, so that one big file does not take the whole budget
+		sentInPass = false;
+		Queue::iterator i = queue.lowerBound(sendNextFrom);
+		for (int32 k = 0, l = queue.size(); k < l && sentSize < budget; ++k, ++i) {
+			if (i == queue.end()) i = queue.begin();
+			if (sendPart(i)) {
+				sendNextFrom = i.key() + 1;
+				sentInPass = sent = true;
+			}
+		}
+	}
+	if (sent) {
+		nextTimer.start(UploadRequestInterval);
 	}
-	nextTimer.start(UploadRequestInterval);
 }
 
 void FileUploader::cancel(MsgId msgId) {
 	uploaded.remove(msgId);
-	if (uploading == msgId) {
-		currentFailed();
+
+	Queue::iterator i = queue.find(msgId);
+	if (i == queue.end()) return;
+
+	if (i->sentRequests || i->docSentParts || i->media.parts.size() != i->partsCount) {
+		fileFailed(msgId);
 	} else {
-		queue.remove(msgId);
+		if (i->media.type == ToPrepareDocument) {
+			cancelRead(msgId);
+		}
+		queue.erase(i);
 	}
 }
 
@@ -159,48 +331,53 @@ void FileUploader::confirm(MsgId msgId) {
 
 void FileUploader::clear() {
 	uploaded.clear();
+	if (thread) {
+		{
+			QMutexLocker lock(readMutex());
+			for (Queue::const_iterator i = queue.cbegin(), e = queue.cend(); i != e; ++i) {
+				read.cancelled.insert(i.key());
+			}
+			read.toRead.clear();
+			read.ready.clear();
+			read.readySize = 0;
+		}
+		emit needToRead();
+	}
 	queue.clear();
-	for (QMap<mtpRequestId, QByteArray>::const_iterator i = requestsSent.cbegin(), e = requestsSent.cend(); i != e; ++i) {
+	for (SentRequests::const_iterator i = requestsSent.cbegin(), e = requestsSent.cend(); i != e; ++i) {
 		MTP::cancel(i.key());
 	}
 	requestsSent.clear();
-	for (QMap<mtpRequestId, int32>::const_iterator i = docRequestsSent.cbegin(), e = docRequestsSent.cend(); i != e; ++i) {
-		MTP::cancel(i.key());
-	}
-	docRequestsSent.clear();
 	sentSize = 0;
 }
 
 void FileUploader::partLoaded(const MTPBool &result, mtpRequestId requestId) {
-	QMap<mtpRequestId, int32>::iterator j = docRequestsSent.end();
-	QMap<mtpRequestId, QByteArray>::iterator i = requestsSent.find(requestId);
-	if (i == requestsSent.cend()) {
-		j = docRequestsSent.find(requestId);
-	}
-	if (i != requestsSent.cend() || j != docRequestsSent.cend()) {
-		if (!result.v) { // failed to upload current file
-			currentFailed();
-			return;
-		} else {
-			Queue::const_iterator k = queue.constFind(uploading);
-			if (i != requestsSent.cend()) {
-				sentSize -= i.value().size();
-				requestsSent.erase(i);
-			} else {
-				sentSize -= k->docPartSize;
-				docRequestsSent.erase(j);
+	SentRequests::iterator i = requestsSent.find(requestId);
+	if (i != requestsSent.end()) {
+		MsgId msgId = i->msgId;
+		bool docPart = i->docPart;
+		sentSize -= i->size;
+		requestsSent.erase(i);
+
+		Queue::iterator k = queue.find(msgId);
+		if (k != queue.end()) {
+			--k->sentRequests;
+			if (!result.v) { // failed to upload this file
+				fileFailed(msgId);
+				return;
 			}
 			if (k->media.type == ToPreparePhoto) {
-				emit photoProgress(k.key());
+				emit photoProgress(msgId);
 			} else if (k->media.type == ToPrepareDocument) {
 				DocumentData *doc = App::document(k->media.id);
-				if (doc->status == FileUploading) {
-					doc->uploadOffset = (k->docSentParts - docRequestsSent.size()) * k->docPartSize;
+				if (doc->status == FileUploading && docPart) {
+					++k->docPartsDone;
+					doc->uploadOffset = k->docPartsDone * k->docPartSize;
 					if (doc->uploadOffset > doc->size) {
 						doc->uploadOffset = doc->size;
 					}
 				}
-				emit documentProgress(k.key());
+				emit documentProgress(msgId);
 			}
 		}
 	}
@@ -209,9 +386,23 @@ void FileUploader::partLoaded(const MTPBool &result, mtpRequestId requestId) {
 }
 
 bool FileUploader::partFailed(const RPCError &err, mtpRequestId requestId) {
-	if (requestsSent.constFind(requestId) != requestsSent.cend() || docRequestsSent.constFind(requestId) != docRequestsSent.cend()) { // failed to upload current file
-		currentFailed();
+	SentRequests::iterator i = requestsSent.find(requestId);
+	if (i != requestsSent.end()) { // failed to upload this file
+		MsgId msgId = i->msgId;
+		sentSize -= i->size;
+		requestsSent.erase(i);
+		fileFailed(msgId);
+	} else {
+		sendNext();
 	}
-	sendNext();
 	return true;
 }
+
+FileUploader::~FileUploader() {
+	if (thread) {
+		thread->quit();
+		thread->wait();
+		delete reader;
+		delete thread;
+	}
+}
@@ -19,6 +19,44 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 
 #include "localimageloader.h"
 
+class FileUploader;
+class FileUploaderReader : public QObject { // reads document parts and counts md5 in a separate thread
+	Q_OBJECT
+
+public:
+
+	FileUploaderReader(FileUploader *uploader, QThread *thread);
+
+public slots:
+
+	void readParts();
+
+signals:
+
+	void partsRead();
+
+private:
+
+	struct File {
+		File(MsgId msgId, const QString &path, const QByteArray &data, int32 partSize, int32 partsCount, bool needHash) :
+			msgId(msgId), path(path), data(data), partSize(partSize), partsCount(partsCount), partsRead(0), needHash(needHash) {
+		}
+		MsgId msgId;
+		QString path;
+		QByteArray data;
+		QSharedPointer<QFile> file;
+		int32 partSize, partsCount, partsRead;
+		bool needHash;
+		HashMd5 hash;
+	};
+	typedef QList<File> Files;
+	Files files; // read round robin, so that all the uploading files have some parts ready
+
+	FileUploader *uploader;
+	void readFailed(MsgId msgId);
+
+};
+
 class FileUploader : public QObject, public RPCSender {
 	Q_OBJECT
 
@@ -35,6 +73,36 @@ public:
 
 	void clear();
 
+	struct ToRead {
+		ToRead(MsgId msgId, const QString &path, const QByteArray &data, int32 partSize, int32 partsCount, bool needHash) :
+			msgId(msgId), path(path), data(data), partSize(partSize), partsCount(partsCount), needHash(needHash) {
+		}
+		MsgId msgId;
+		QString path;
+		QByteArray data;
+		int32 partSize, partsCount;
+		bool needHash;
+	};
+	struct ReadyFile {
+		ReadyFile() : failed(false) {
+		}
+		QMap<int32, QByteArray> parts;
+		QByteArray md5; // hex md5 of the whole file, set with the last part if needed
+		bool failed;
+	};
+	struct ReadState {
+		ReadState() : readySize(0) {
+		}
+		QList<ToRead> toRead;
+		QSet<MsgId> cancelled;
+		QMap<MsgId, ReadyFile> ready;
+		int32 readySize; // reader stops when it has UploadReadBufferSize bytes ready
+	};
+	QMutex *readMutex();
+	ReadState &readState();
+
+	~FileUploader();
+
 public slots:
 
 	void sendNext();
@@ -51,10 +119,12 @@ signals:
 	void photoFailed(MsgId msgId);
 	void documentFailed(MsgId msgId);
 
+	void needToRead();
+
 private:
 
 	struct File {
-		File(const ReadyLocalMedia &media) : media(media), docSentParts(0) {
+		File(const ReadyLocalMedia &media) : media(media), docSentParts(0), docPartsDone(0), sentRequests(0) {
 			partsCount = media.parts.size();
 			if (media.type == ToPrepareDocument) {
 				docSize = media.file.isEmpty() ? media.data.size() : media.filesize;
@@ -82,27 +152,44 @@ private:
 		ReadyLocalMedia media;
 		int32 partsCount;
 
-		QSharedPointer<QFile> docFile;
-		int32 docSentParts;
+		int32 docSentParts, docPartsDone;
 		int32 docSize;
 		int32 docPartSize;
 		int32 docPartsCount;
-		HashMd5 docHash;
+		QByteArray docMd5;
+
+		int32 sentRequests;
 	};
 	typedef QMap<MsgId, File> Queue;
 
 	void partLoaded(const MTPBool &result, mtpRequestId requestId);
 	bool partFailed(const RPCError &err, mtpRequestId requestId);
 
-	void currentFailed();
+	bool sendPart(Queue::iterator i); // returns false if the file has nothing to send right now
+	bool fileDone(Queue::iterator i); // returns true if the file was removed from the queue
+	void fileFailed(MsgId msgId);
+	void cancelRead(MsgId msgId);
 
-	QMap<mtpRequestId, QByteArray> requestsSent;
-	QMap<mtpRequestId, int32> docRequestsSent;
+	struct SentRequest {
+		SentRequest(MsgId msgId = 0, int32 size = 0, bool docPart = false) : msgId(msgId), size(size), docPart(docPart) {
+		}
+		MsgId msgId;
+		int32 size;
+		bool docPart; // not a thumb part
+	};
+	typedef QMap<mtpRequestId, SentRequest> SentRequests;
+	SentRequests requestsSent;
 	uint32 sentSize;
-	
-	MsgId uploading;
+	int32 nextSession;
+	MsgId sendNextFrom; // files get one part each in turn, starting from this msg id
+
 	Queue queue;
 	Queue uploaded;
 	QTimer nextTimer;
 
+	QMutex readLock;
+	ReadState read;
+	QThread *thread;
+	FileUploaderReader *reader;
+
 };
@@ -25,6 +25,14 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 
 namespace {
 
+	void textCopyGlyphs(QGlyphLayout to, const QGlyphLayout &from) { // to has from.numGlyphs allocated
+		memcpy(to.offsets, from.offsets, from.numGlyphs * sizeof(QFixedPoint));
+		memcpy(to.glyphs, from.glyphs, from.numGlyphs * sizeof(glyph_t));
+		memcpy(to.advances, from.advances, from.numGlyphs * sizeof(QFixed));
+		memcpy(to.justifications, from.justifications, from.numGlyphs * sizeof(QGlyphJustification));
+		memcpy(to.attributes, from.attributes, from.numGlyphs * sizeof(QGlyphAttributes));
+	}
+
 	inline bool chIsSpace(QChar ch, bool rich = false) {
 		return ch.isSpace() || (ch < 32 && !(rich && ch == TextCommand)) || (ch == QChar::ParagraphSeparator) || (ch == QChar::LineSeparator) || (ch == QChar::ObjectReplacementCharacter) || (ch == QChar::SoftHyphen) || (ch == QChar::CarriageReturn) || (ch == QChar::Tabulation);
 	}
@@ -650,6 +658,7 @@ public:
 		_t->_links.squeeze();
 		_t->_blocks.squeeze();
 		_t->_text.squeeze();
+		_t->compactBlocks();
 	}
 
 private:
@@ -791,6 +800,47 @@ void HashtagLink::onClick(Qt::MouseButton button) const {
 	}
 }
 
+struct TextDrawCacheItem { // one shaped script item or emoji of a drawn line
+	TextDrawCacheItem() : blockIndex(0), emoji(false), engine(0), numGlyphs(0) {
+	}
+
+	int32 blockIndex; // its pen is chosen again on each draw
+	QPointF pos; // relative to draw() left and top, baseline for text
+
+	bool emoji;
+	QRect emojiRect; // in App::emojis()
+
+	QFont font; // keeps the font engine alive
+	QFontEngine *engine;
+	QScriptItem si;
+	QByteArray glyphs; // QGlyphLayout arrays
+	int32 numGlyphs;
+	QFixed width;
+	QString chars;
+	QVector<unsigned short> logClusters;
+};
+
+struct TextDrawCacheLine {
+	TextDrawCacheLine(int32 top = 0, int32 height = 0) : top(top), height(height) {
+	}
+	int32 top, height;
+	QVector<TextDrawCacheItem> items;
+};
+
+struct TextDrawCache {
+	TextDrawCache() : width(-1), align(style::al_left), textStyle(0), dir(Qt::LayoutDirectionAuto) {
+	}
+
+	int32 width;
+	style::align align;
+	style::font font;
+	const style::textStyle *textStyle;
+	TextLinkPtr over, down; // link fonts depend on them
+	Qt::LayoutDirection dir;
+
+	QVector<TextDrawCacheLine> lines;
+};
+
 class TextPainter {
 public:
 
@@ -801,7 +851,7 @@ public:
 		return _blockEnd(t, i, e) - (*i)->from();
 	}
 
-	TextPainter(QPainter *p, const Text *t) : _p(p), _t(t), _elideLast(false), _str(0), _elideSavedBlock(0), _lnkResult(0), _inTextFlag(0), _getSymbol(0), _getSymbolAfter(0), _getSymbolUpon(0) {
+	TextPainter(QPainter *p, const Text *t) : _p(p), _t(t), _elideLast(false), _str(0), _elideSavedBlock(0), _lnkResult(0), _inTextFlag(0), _getSymbol(0), _getSymbolAfter(0), _getSymbolUpon(0), _cache(0) {
 	}
 
 	void initNextParagraph(Text::TextBlocks::const_iterator i) {
@@ -865,6 +915,64 @@ public:
 		}
 	}
 
+	void drawCached(int32 left, int32 top, int32 w, style::align align, int32 yFrom, int32 yTo) { // no selection, shaping is done once for each width
+		if (_t->_blocks.isEmpty()) return;
+		if (!_textStyle) _initDefault();
+
+		TextDrawCache *cache = _t->_drawCache;
+		bool hasLinks = !_t->_links.isEmpty();
+		Qt::LayoutDirection dir = (_t->_startDir == Qt::LayoutDirectionAuto) ? langDir() : _t->_startDir;
+		if (!cache || cache->width != w || cache->align != align || cache->font != _t->_font || cache->textStyle != _textStyle || cache->dir != dir || (hasLinks && (cache->over != _overLnk || cache->down != _downLnk))) {
+			if (!cache) cache = _t->_drawCache = new TextDrawCache();
+			cache->width = w;
+			cache->align = align;
+			cache->font = _t->_font;
+			cache->textStyle = _textStyle;
+			cache->over = hasLinks ? _overLnk : TextLinkPtr();
+			cache->down = hasLinks ? _downLnk : TextLinkPtr();
+			cache->dir = dir;
+			cache->lines.clear();
+
+			TextPainter recorder(0, _t);
+			recorder._cache = cache;
+			recorder.draw(0, 0, w, align, 0, -1);
+		}
+
+		_p->setFont(_t->_font->f);
+		_originalPen = _p->pen();
+
+		int32 from = yFrom + top, till = (yTo < 0) ? -1 : (yTo + top);
+		QRectF clip = _p->clipBoundingRect();
+		if (clip.width() > 0 || clip.height() > 0) {
+			if (from < clip.y()) from = clip.y();
+			if (till < 0 || till > clip.y() + clip.height()) till = clip.y() + clip.height();
+		}
+
+		QTextCharFormat format;
+		for (QVector<TextDrawCacheLine>::const_iterator i = cache->lines.cbegin(), e = cache->lines.cend(); i != e; ++i) {
+			if (till >= 0 && top + i->top >= till) break;
+			if (top + i->top + i->height <= from) continue;
+
+			for (QVector<TextDrawCacheItem>::const_iterator j = i->items.cbegin(), en = i->items.cend(); j != en; ++j) {
+				QPointF pos(left + j->pos.x(), top + j->pos.y());
+				if (j->emoji) {
+					_p->drawPixmap(pos, App::emojis(), j->emojiRect);
+					continue;
+				}
+
+				_p->setPen(blockPen(_t->_blocks[j->blockIndex]));
+
+				QFont font(j->font);
+				QTextItemInt gf(QGlyphLayout(const_cast<char*>(j->glyphs.constData()), j->numGlyphs), &font, j->chars.unicode(), j->chars.size(), j->engine, format);
+				gf.logClusters = j->logClusters.constData();
+				gf.width = j->width;
+				gf.justified = false;
+				gf.initWithScriptItem(j->si);
+				_p->drawTextItem(pos, gf);
+			}
+		}
+	}
+
 	void draw(int32 left, int32 top, int32 w, style::align align, int32 yFrom, int32 yTo, uint16 selectedFrom = 0, uint16 selectedTo = 0) {
 		if (_t->_blocks.isEmpty()) return;
 
@@ -1231,6 +1339,7 @@ public:
 		nextBlock = (++blockIndex < _blocksSize) ? _t->_blocks[blockIndex] : 0;
 
 		int32 textY = _y + _yDelta + _t->_font->ascent, emojiY = (_t->_font->height - st::emojiSize) / 2;
+		if (_cache) _cache->lines.push_back(TextDrawCacheLine(_y + _yDelta, _fontHeight));
 
 		eSetFont(currentBlock);
 		if (_p) _p->setPen(blockPen(currentBlock));
@@ -1301,6 +1410,17 @@ public:
 						*_getSymbolUpon = true;
 					}
 					return false;
+				} else if (_cache && _type == TextBlockEmoji) {
+					QFixed glyphX = x;
+					if (rtl) {
+						glyphX += (si.width - currentBlock->f_width());
+					}
+					TextDrawCacheItem item;
+					item.blockIndex = blockIndex - 1;
+					item.pos = QPointF((glyphX + int(st::emojiPadding)).toInt(), _y + _yDelta + emojiY);
+					item.emoji = true;
+					item.emojiRect = QRect(static_cast<EmojiBlock*>(currentBlock)->emoji->x, static_cast<EmojiBlock*>(currentBlock)->emoji->y, st::emojiImgSize, st::emojiImgSize);
+					_cache->lines.back().items.push_back(item);
 				} else if (_p && _type == TextBlockEmoji) {
 					QFixed glyphX = x;
 					if (rtl) {
@@ -1397,6 +1517,23 @@ public:
 				}
 				*_getSymbolUpon = true;
 				return false;
+			} else if (_cache) {
+				TextDrawCacheItem item;
+				item.blockIndex = blockIndex - 1;
+				item.pos = QPointF(x.toReal(), textY);
+				item.font = _e->fnt;
+				item.engine = engine.fontEngine(si);
+				item.si = si;
+				item.numGlyphs = glyphsEnd - glyphsStart;
+				item.glyphs.resize(item.numGlyphs * QGlyphLayout::SpaceNeeded);
+				textCopyGlyphs(QGlyphLayout(item.glyphs.data(), item.numGlyphs), glyphs.mid(glyphsStart, item.numGlyphs));
+				item.width = itemWidth;
+				item.chars = QString(engine.layoutData->string.unicode() + itemStart, itemEnd - itemStart);
+				item.logClusters.resize(itemEnd - itemStart);
+				for (int ch = 0, l = itemEnd - itemStart; ch < l; ++ch) {
+					item.logClusters[ch] = logClusters[itemStart - si.position + ch];
+				}
+				_cache->lines.back().items.push_back(item);
 			} else if (_p) {
 				QTextCharFormat format;
 				QTextItemInt gf(glyphs.mid(glyphsStart, glyphsEnd - glyphsStart),
@@ -2219,6 +2356,8 @@ private:
 	uint16 *_getSymbol;
 	bool *_getSymbolAfter, *_getSymbolUpon;
 
+	TextDrawCache *_cache; // recording pass of drawCached(), _p is 0 then
+
 };
 
 const TextParseOptions _defaultOptions = {
@@ -2235,10 +2374,10 @@ const TextParseOptions _textPlainOptions = {
 	Qt::LayoutDirectionAuto, // dir
 };
 
-Text::Text(int32 minResizeWidth) : _minResizeWidth(minResizeWidth), _maxWidth(0), _minHeight(0), _startDir(Qt::LayoutDirectionAuto) {
+Text::Text(int32 minResizeWidth) : _minResizeWidth(minResizeWidth), _maxWidth(0), _minHeight(0), _blocksData(0), _startDir(Qt::LayoutDirectionAuto), _drawCache(0) {
 }
 
-Text::Text(style::font font, const QString &text, const TextParseOptions &options, int32 minResizeWidth, bool richText) : _minResizeWidth(minResizeWidth) {
+Text::Text(style::font font, const QString &text, const TextParseOptions &options, int32 minResizeWidth, bool richText) : _minResizeWidth(minResizeWidth), _blocksData(0), _drawCache(0) {
 	if (richText) {
 		setRichText(font, text, options);
 	} else {
@@ -2259,6 +2398,7 @@ void Text::setText(style::font font, const QString &text, const TextParseOptions
 	int32 lineHeight = 0;
 	int32 result = 0, lastNewlineStart = 0;
 	QFixed _width = 0, last_rBearing = 0, last_rPadding = 0;
+	Paragraph paragraph = { 0, 0, 0, 0 };
 	for (TextBlocks::const_iterator i = _blocks.cbegin(), e = _blocks.cend(); i != e; ++i) {
 		ITextBlock *b = *i;
 		TextBlockType _btype = b->type();
@@ -2266,6 +2406,12 @@ void Text::setText(style::font font, const QString &text, const TextParseOptions
 		QFixed _rb = _blockRBearing(b);
 
 		if (_btype == TextBlockNewline) {
+			paragraph.blocksEnd = i - _blocks.cbegin();
+			paragraph.width = _width;
+			paragraph.lineHeight = lineHeight;
+			_paragraphs.push_back(paragraph);
+			paragraph.maxPrefix = 0;
+
 			if (!lineHeight) lineHeight = blockHeight;
 			Qt::LayoutDirection dir = options.dir;
 			if (dir == Qt::LayoutDirectionAuto) {
@@ -2292,12 +2438,19 @@ void Text::setText(style::font font, const QString &text, const TextParseOptions
 
 		_width += b->f_lpadding();
 		_width += last_rBearing + (last_rPadding + b->f_width() - _rb);
+		if (paragraph.maxPrefix < _width) paragraph.maxPrefix = _width;
 		lineHeight = qMax(lineHeight, blockHeight);
 
 		last_rBearing = _rb;
 		last_rPadding = b->f_rpadding();
 		continue;
 	}
+	if (!_paragraphs.isEmpty()) {
+		paragraph.blocksEnd = _blocks.size();
+		paragraph.width = _width;
+		paragraph.lineHeight = lineHeight;
+		_paragraphs.push_back(paragraph);
+	}
 	Qt::LayoutDirection dir = options.dir;
 	if (dir == Qt::LayoutDirectionAuto) {
 		dir = TextParser::stringDirection(_text, lastNewlineStart, _text.size());
@@ -2397,23 +2550,61 @@ void Text::setRichText(style::font font, const QString &text, TextParseOptions o
 void Text::setLink(uint16 lnkIndex, const TextLinkPtr &lnk) {
 	if (!lnkIndex || lnkIndex > _links.size()) return;
 	_links[lnkIndex - 1] = lnk;
+	clearDrawCache();
 }
 
 bool Text::hasLinks() const {
 	return !_links.isEmpty();
 }
 
-int32 Text::countHeight(int32 w) const {
+int32 Text::countHeight(int32 w, bool remember) const {
+	QFixed width = w;
+	if (width < _minResizeWidth) width = _minResizeWidth;
+	if (width >= _maxWidth) {
+		return _minHeight;
+	}
+	if (!remember) {
+		return countBlocksHeight(width, true);
+	}
+
+	Q_ASSERT(QThread::currentThread() == QCoreApplication::instance()->thread());
+	for (int32 i = 0; i < TextHeightsRemembered; ++i) {
+		if (_countedHeights.widths[i] == w) {
+			return _countedHeights.heights[i];
+		}
+	}
+
+	int32 result = countBlocksHeight(width, true);
+	_countedHeights.widths[_countedHeights.next] = w;
+	_countedHeights.heights[_countedHeights.next] = result;
+	_countedHeights.next = (_countedHeights.next + 1) % TextHeightsRemembered;
+	return result;
+}
+
+#ifdef TDESKTOP_BENCHMARK
+int32 Text::countHeightSlow(int32 w) const {
 	QFixed width = w;
 	if (width < _minResizeWidth) width = _minResizeWidth;
 	if (width >= _maxWidth) {
 		return _minHeight;
 	}
+	return countBlocksHeight(width, false);
+}
+#endif
 
+int32 Text::countBlocksHeight(QFixed width, bool skipParagraphs) const {
 	int32 result = 0, lineHeight = 0;
 	QFixed widthLeft = width, last_rBearing = 0, last_rPadding = 0;
 	bool longWordLine = true;
-	for (TextBlocks::const_iterator i = _blocks.cbegin(), e = _blocks.cend(); i != e; ++i) {
+
+	TextBlocks::const_iterator i = _blocks.cbegin(), e = _blocks.cend();
+	Paragraphs::const_iterator p = _paragraphs.cbegin(), pe = skipParagraphs ? _paragraphs.cend() : p; // paragraph of the next block
+	if (p != pe && p->maxPrefix <= width) {
+		lineHeight = p->lineHeight;
+		widthLeft = width - p->width;
+		i += p->blocksEnd;
+	}
+	for (; i != e; ++i) {
 		ITextBlock *b = *i;
 		TextBlockType _btype = b->type();
 		int32 blockHeight = _blockHeight(b, _font);
@@ -2428,6 +2619,11 @@ int32 Text::countHeight(int32 w) const {
 			widthLeft = width - (b->f_width() - last_rBearing);
 
 			longWordLine = true;
+			if (p != pe && ++p != pe && p->maxPrefix <= width) { // the whole paragraph fits in one line
+				lineHeight = p->lineHeight;
+				widthLeft = width - p->width;
+				i = _blocks.cbegin() + (p->blocksEnd - 1);
+			}
 			continue;
 		}
 		widthLeft -= b->f_lpadding();
@@ -2509,12 +2705,18 @@ int32 Text::countHeight(int32 w) const {
 
 void Text::replaceFont(style::font f) {
 	_font = f;
+	_countedHeights.clear();
+	clearDrawCache();
 }
 
 void Text::draw(QPainter &painter, int32 left, int32 top, int32 w, style::align align, int32 yFrom, int32 yTo, uint16 selectedFrom, uint16 selectedTo) const {
 //	painter.fillRect(QRect(left, top, w, countHeight(w)), QColor(0, 0, 0, 32)); // debug
 	TextPainter p(&painter, this);
-	p.draw(left, top, w, align, yFrom, yTo, selectedFrom, selectedTo);
+	if (selectedFrom < selectedTo) {
+		p.draw(left, top, w, align, yFrom, yTo, selectedFrom, selectedTo);
+	} else {
+		p.drawCached(left, top, w, align, yFrom, yTo);
+	}
 }
 
 void Text::drawElided(QPainter &painter, int32 left, int32 top, int32 w, int32 lines, style::align align, int32 yFrom, int32 yTo) const {
@@ -2622,14 +2824,101 @@ QString Text::original(uint16 selectedFrom, uint16 selectedTo, bool expandLinks)
 	return result;
 }
 
-void Text::clean() {
+QString Text::parsedSource() const {
+	QString result;
+	result.reserve(_text.size());
+
+	int32 lnkIndex = 0;
+	for (TextBlocks::const_iterator i = _blocks.cbegin(), e = _blocks.cend(); i != e; ++i) {
+		if ((*i)->type() == TextBlockSkip) continue;
+
+		int32 blockLnkIndex = (*i)->lnkIndex();
+		if (!blockLnkIndex) {
+			result += _text.midRef((*i)->from(), TextPainter::_blockLength(this, i, e));
+		} else if (blockLnkIndex != lnkIndex) { // link text may be elided, write the url it was parsed from
+			const TextLinkPtr &lnk(_links.at(blockLnkIndex - 1));
+			if (lnk) result += lnk->text();
+		}
+		lnkIndex = blockLnkIndex;
+	}
+	return result;
+}
+
+int32 Text::layoutSize() const {
+	int32 result = _text.capacity() * sizeof(QChar) + _blocks.capacity() * sizeof(ITextBlock*) + _links.size() * sizeof(TextLinkPtr) + _paragraphs.capacity() * sizeof(Paragraph);
+	for (TextBlocks::const_iterator i = _blocks.cbegin(), e = _blocks.cend(); i != e; ++i) {
+		switch ((*i)->type()) {
+		case TextBlockNewline: result += sizeof(NewlineBlock); break;
+		case TextBlockText: result += sizeof(TextBlock) + static_cast<TextBlock*>(*i)->_words.capacity() * sizeof(TextWord); break;
+		case TextBlockEmoji: result += sizeof(EmojiBlock); break;
+		case TextBlockSkip: result += sizeof(SkipBlock); break;
+		}
+	}
+	return result;
+}
+
+namespace {
+	inline int32 _textBlockSize(TextBlockType type) { // rounded up to keep the next block aligned in Text::_blocksData
+		int32 size = 0;
+		switch (type) {
+		case TextBlockNewline: size = sizeof(NewlineBlock); break;
+		case TextBlockText: size = sizeof(TextBlock); break;
+		case TextBlockEmoji: size = sizeof(EmojiBlock); break;
+		case TextBlockSkip: size = sizeof(SkipBlock); break;
+		}
+		return (size + sizeof(void*) - 1) & ~int32(sizeof(void*) - 1);
+	}
+}
+
+void Text::compactBlocks() {
+	if (_blocksData || _blocks.isEmpty()) return;
+
+	int32 size = 0;
+	for (TextBlocks::const_iterator i = _blocks.cbegin(), e = _blocks.cend(); i != e; ++i) {
+		size += _textBlockSize((*i)->type());
+	}
+
+	_blocksData = new char[size];
+	char *data = _blocksData;
 	for (TextBlocks::iterator i = _blocks.begin(), e = _blocks.end(); i != e; ++i) {
-		delete *i;
+		ITextBlock *b = *i;
+		TextBlockType type = b->type();
+		switch (type) {
+		case TextBlockNewline: *i = new (data) NewlineBlock(*static_cast<NewlineBlock*>(b)); break;
+		case TextBlockText: *i = new (data) TextBlock(*static_cast<TextBlock*>(b)); break;
+		case TextBlockEmoji: *i = new (data) EmojiBlock(*static_cast<EmojiBlock*>(b)); break;
+		case TextBlockSkip: *i = new (data) SkipBlock(*static_cast<SkipBlock*>(b)); break;
+		}
+		data += _textBlockSize(type);
+		delete b;
+	}
+}
+
+void Text::clean() {
+	if (_blocksData) {
+		for (TextBlocks::iterator i = _blocks.begin(), e = _blocks.end(); i != e; ++i) {
+			(*i)->~ITextBlock();
+		}
+		delete[] _blocksData;
+		_blocksData = 0;
+	} else {
+		for (TextBlocks::iterator i = _blocks.begin(), e = _blocks.end(); i != e; ++i) {
+			delete *i;
+		}
 	}
 	_blocks.clear();
+	_text = QString();
 	_links.clear();
+	_paragraphs.clear();
+	_countedHeights.clear();
 	_maxWidth = _minHeight = 0;
 	_startDir = Qt::LayoutDirectionAuto;
+	clearDrawCache();
+}
+
+void Text::clearDrawCache() {
+	delete _drawCache;
+	_drawCache = 0;
 }
 
 // COPIED FROM qtextlayout.cpp AND MODIFIED
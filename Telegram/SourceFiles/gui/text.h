@@ -369,13 +369,32 @@ enum TextSelectType {
 typedef QPair<QString, QString> TextCustomTag; // open str and close str
 typedef QMap<QChar, TextCustomTag> TextCustomTagsMap;
 
+struct TextCountedHeights { // last widths passed to Text::countHeight() with the results
+	TextCountedHeights() {
+		clear();
+	}
+	void clear() {
+		for (int32 i = 0; i < TextHeightsRemembered; ++i) {
+			widths[i] = -1;
+		}
+		next = 0;
+	}
+
+	int32 widths[TextHeightsRemembered], heights[TextHeightsRemembered];
+	int32 next;
+};
+
+struct TextDrawCache;
 class Text {
 public:
 
 	Text(int32 minResizeWidth = QFIXED_MAX);
 	Text(style::font font, const QString &text, const TextParseOptions &options = _defaultOptions, int32 minResizeWidth = QFIXED_MAX, bool richText = false);
 
-	int32 countHeight(int32 width) const;
+	int32 countHeight(int32 width, bool remember = true) const; // remember = false for counting outside of the GUI thread
+#ifdef TDESKTOP_BENCHMARK
+	int32 countHeightSlow(int32 width) const; // walks all the blocks without any shortcuts
+#endif
 	void setText(style::font font, const QString &text, const TextParseOptions &options = _defaultOptions);
 	void setRichText(style::font font, const QString &text, TextParseOptions options = _defaultOptions, const TextCustomTagsMap &custom = TextCustomTagsMap());
 
@@ -388,6 +407,10 @@ public:
 	int32 minHeight() const {
 		return _minHeight;
 	}
+	int32 layoutSize() const; // approximate memory taken by the parsed text, freed by clean()
+	int32 blocksCount() const {
+		return _blocks.size();
+	}
 
 	void replaceFont(style::font f); // does not recount anything, use at your own risk!
 
@@ -400,6 +423,7 @@ public:
 	uint32 adjustSelection(uint16 from, uint16 to, TextSelectType selectType) const;
 
 	QString original(uint16 selectedFrom = 0, uint16 selectedTo = 0xFFFF, bool expandLinks = true) const;
+	QString parsedSource() const; // links are written back as their urls, so setText() with the same options gives the same text again
 
 	bool lastDots(int32 dots, int32 maxdots = 3) { // hack for typing animation
 		if (_text.size() < maxdots) return false;
@@ -417,6 +441,7 @@ public:
 		for (int32 j = from + dots; j < to; ++j) {
 			_text[j] = QChar(' ');
 		}
+		clearDrawCache();
 		return true;
 	}
 
@@ -435,12 +460,28 @@ private:
 
 	typedef QVector<ITextBlock*> TextBlocks;
 	TextBlocks _blocks;
+	char *_blocksData; // parsed _blocks are moved here by compactBlocks(), 0 if they were new'ed one by one
+	void compactBlocks();
 
 	typedef QVector<TextLinkPtr> TextLinks;
 	TextLinks _links;
 
 	Qt::LayoutDirection _startDir;
 
+	struct Paragraph { // filled by setText() if there are newlines, countHeight() skips the paragraphs fitting in one line
+		int32 blocksEnd; // index of the next newline block
+		QFixed maxPrefix, width; // max and last sums of the block widths from the paragraph start
+		int32 lineHeight;
+	};
+	typedef QVector<Paragraph> Paragraphs;
+	Paragraphs _paragraphs;
+
+	mutable TextCountedHeights _countedHeights; // not locked, used by countHeight() in the GUI thread only
+	int32 countBlocksHeight(QFixed width, bool skipParagraphs) const;
+
+	mutable TextDrawCache *_drawCache; // shaped lines of the last width, filled by the first draw() without selection
+	void clearDrawCache();
+
 	friend class TextParser;
 	friend class TextPainter;
 
@@ -265,6 +265,43 @@ void stopGif() {
 	animated.stop();
 }
 
+void reportHistoryMemory() {
+	int32 messages = 0, texts = 0;
+	int64 itemsSize = 0, layoutsSize = 0, blocks = 0;
+	const Histories &histories(App::histories());
+	for (Histories::const_iterator h = histories.cbegin(), he = histories.cend(); h != he; ++h) {
+		for (History::const_iterator b = h.value()->cbegin(), be = h.value()->cend(); b != be; ++b) {
+			for (HistoryBlock::const_iterator i = (*b)->cbegin(), ie = (*b)->cend(); i != ie; ++i) {
+				HistoryItem *item = *i;
+				if (item->itemType() != HistoryItem::MsgType) continue;
+
+				++messages;
+				if (item->serviceMsg()) {
+					itemsSize += sizeof(HistoryServiceMsg);
+				} else if (dynamic_cast<HistoryForwarded*>(item)) {
+					itemsSize += sizeof(HistoryForwarded);
+				} else {
+					itemsSize += sizeof(HistoryMessage);
+				}
+				layoutsSize += item->layoutSize();
+				if (int32 itemBlocks = item->layoutBlocks()) {
+					blocks += itemBlocks;
+					++texts;
+				}
+			}
+		}
+	}
+	if (!messages) {
+		LOG(("History Memory: no loaded messages, open some chats first"));
+		return;
+	}
+
+	// each text had its blocks new'ed one by one and each message had a QDateTime with its own data, two pointers of allocator header are counted per allocation
+	int64 heapNow = texts, heapWas = blocks + messages, bytesNow = (itemsSize + layoutsSize) / messages, bytesSaved = (heapWas - heapNow) * 2 * int64(sizeof(void*)) / messages;
+	LOG(("History Memory: %1 messages, %2 bytes per message, %3 in items and %4 in text layouts").arg(messages).arg(bytesNow).arg(itemsSize / messages).arg(layoutsSize / messages));
+	LOG(("History Memory: %1 bytes per message before the text blocks and dates were packed, %2 heap allocations now, %3 before").arg(bytesNow + bytesSaved).arg(heapNow).arg(heapWas));
+}
+
 NotifySettings globalNotifyAll, globalNotifyUsers, globalNotifyChats;
 NotifySettingsPtr globalNotifyAllPtr = UnknownNotifySettings, globalNotifyUsersPtr = UnknownNotifySettings, globalNotifyChatsPtr = UnknownNotifySettings;
 
@@ -711,7 +748,7 @@ void DialogRow::paint(QPainter &p, int32 w, bool act, bool sel) const {
 		}
 	} else {
 		// draw date
-		QDateTime now(QDateTime::currentDateTime()), lastTime(last->date);
+		QDateTime now(QDateTime::currentDateTime()), lastTime(last->dateTime());
 		QDate nowDate(now.date()), lastDate(lastTime.date());
 		QString dt;
 		if (lastDate == nowDate) {
@@ -791,7 +828,7 @@ void FakeDialogRow::paint(QPainter &p, int32 w, bool act, bool sel) const {
 	}
 
 	// draw date
-	QDateTime now(QDateTime::currentDateTime()), lastTime(_item->date);
+	QDateTime now(QDateTime::currentDateTime()), lastTime(_item->dateTime());
 	QDate nowDate(now.date()), lastDate(lastTime.date());
 	QString dt;
 	if (lastDate == nowDate) {
@@ -851,6 +888,8 @@ History::History(const PeerId &peerId) : width(0), height(0)
 , posInDialogs(0)
 , typingText(st::dlgRichMinWidth)
 , myTyping(0)
+, _resizeJob(0)
+, _relayoutNeeded(false)
 {
 	for (int32 i = 0; i < OverviewCount; ++i) {
 		_overviewCount[i] = -1; // not loaded yet
@@ -1010,23 +1049,29 @@ Histories::Parent::iterator Histories::erase(Histories::Parent::iterator i) {
 	return Parent::erase(i);
 }
 
-HistoryItem *Histories::addToBack(const MTPmessage &msg, int msgState) {
-	PeerId from_id = 0, to_id = 0;
-	switch (msg.type()) {
-	case mtpc_message:
-		from_id = App::peerFromUser(msg.c_message().vfrom_id);
-		to_id = App::peerFromMTP(msg.c_message().vto_id);
-	break;
-	case mtpc_messageForwarded:
-		from_id = App::peerFromUser(msg.c_messageForwarded().vfrom_id);
-		to_id = App::peerFromMTP(msg.c_messageForwarded().vto_id);
-	break;
-	case mtpc_messageService:
-		from_id = App::peerFromUser(msg.c_messageService().vfrom_id);
-		to_id = App::peerFromMTP(msg.c_messageService().vto_id);
-	break;
+namespace {
+	PeerId peerFromMessage(const MTPmessage &msg) {
+		PeerId from_id = 0, to_id = 0;
+		switch (msg.type()) {
+		case mtpc_message:
+			from_id = App::peerFromUser(msg.c_message().vfrom_id);
+			to_id = App::peerFromMTP(msg.c_message().vto_id);
+		break;
+		case mtpc_messageForwarded:
+			from_id = App::peerFromUser(msg.c_messageForwarded().vfrom_id);
+			to_id = App::peerFromMTP(msg.c_messageForwarded().vto_id);
+		break;
+		case mtpc_messageService:
+			from_id = App::peerFromUser(msg.c_messageService().vfrom_id);
+			to_id = App::peerFromMTP(msg.c_messageService().vto_id);
+		break;
+		}
+		return (to_id == App::peerFromUser(MTP::authedId())) ? from_id : to_id;
 	}
-	PeerId peer = (to_id == App::peerFromUser(MTP::authedId())) ? from_id : to_id;
+}
+
+HistoryItem *Histories::addToBack(const MTPmessage &msg, int msgState) {
+	PeerId peer = peerFromMessage(msg);
 
 	if (!peer) return 0;
 
@@ -1050,6 +1095,31 @@ HistoryItem *Histories::addToBack(const MTPmessage &msg, int msgState) {
 	return h.value()->addToBack(msg, msgState > 0);
 }
 
+void Histories::addToBack(const QVector<MTPMessage> &msgs, int msgState) {
+	typedef QMap<int32, History*> HistoriesOrder;
+	typedef QHash<History*, QVector<MTPMessage> > MessagesByHistory;
+	HistoriesOrder order; // histories by the index of their last message, so that the dialogs are brought to top in the right order
+	MessagesByHistory byHistory;
+	QHash<History*, int32> lastIndex;
+	for (int32 i = 0, l = msgs.size(); i < l; ++i) {
+		PeerId peer = peerFromMessage(msgs[i]);
+		if (!peer) continue;
+
+		iterator h = find(peer);
+		if (h == end()) {
+			h = insert(peer, new History(peer));
+		}
+		byHistory[h.value()].push_back(msgs[i]);
+		lastIndex[h.value()] = i;
+	}
+	for (QHash<History*, int32>::const_iterator i = lastIndex.cbegin(), e = lastIndex.cend(); i != e; ++i) {
+		order.insert(i.value(), i.key());
+	}
+	for (HistoriesOrder::const_iterator i = order.cbegin(), e = order.cend(); i != e; ++i) {
+		i.value()->addNewMessages(byHistory.value(i.value()), msgState > 0);
+	}
+}
+
 /*
 HistoryItem *Histories::addToBack(const MTPgeoChatMessage &msg, bool newMsg) {
 	PeerId peer = 0;
@@ -1245,19 +1315,19 @@ void History::createInitialDateBlock(const QDateTime &date) {
 	push_front(dateBlock); // date block
 }
 
-HistoryItem *History::doAddToBack(HistoryBlock *to, bool newBlock, HistoryItem *adding, bool newMsg) {
+HistoryItem *History::doAddToBack(HistoryBlock *to, bool newBlock, HistoryItem *adding, bool newMsg, bool *overviewUpdated) {
 	if (!adding) {
 		if (newBlock) delete to;
 		return adding;
 	}
 
 	if (newBlock) {
-		createInitialDateBlock(adding->date);
+		createInitialDateBlock(adding->dateTime());
 
 		to->y = height;
 		push_back(to);
-	} else if (to->back()->date.date() != adding->date.date()) {
-		HistoryItem *dayItem = createDayServiceMsg(this, to, adding->date);
+	} else if (to->back()->dateTime().date() != adding->dateTime().date()) {
+		HistoryItem *dayItem = createDayServiceMsg(this, to, adding->dateTime());
 		to->push_back(dayItem);
 		dayItem->y = to->height;
 		if (width) {
@@ -1286,13 +1356,48 @@ HistoryItem *History::doAddToBack(HistoryBlock *to, bool newBlock, HistoryItem *
 				_overview[t].push_back(adding->id);
 				_overviewIds[t].insert(adding->id, NullType());
 				if (_overviewCount[t] > 0) ++_overviewCount[t];
-				if (App::wnd()) App::wnd()->mediaOverviewUpdated(peer);
+				if (overviewUpdated) {
+					*overviewUpdated = true;
+				} else if (App::wnd()) {
+					App::wnd()->mediaOverviewUpdated(peer);
+				}
 			}
 		}
 	}
 	return adding;
 }
 
+void History::addNewMessages(const QVector<MTPMessage> &msgs, bool newMsg) {
+	QVector<HistoryItem*> added;
+	added.reserve(msgs.size());
+	if (!loadedAtBottom()) {
+		for (QVector<MTPMessage>::const_iterator i = msgs.cbegin(), e = msgs.cend(); i != e; ++i) {
+			HistoryItem *item = addToHistory(*i);
+			if (item) {
+				last = item;
+				added.push_back(item);
+			}
+		}
+	} else {
+		bool overviewUpdated = false;
+		for (QVector<MTPMessage>::const_iterator i = msgs.cbegin(), e = msgs.cend(); i != e; ++i) {
+			HistoryBlock *to = 0;
+			bool newBlock = isEmpty();
+			if (newBlock) {
+				to = new HistoryBlock(this);
+			} else {
+				to = back();
+			}
+			HistoryItem *item = doAddToBack(to, newBlock, createItem(to, *i, newMsg), false, &overviewUpdated);
+			if (item) added.push_back(item);
+		}
+		if (overviewUpdated && App::wnd()) App::wnd()->mediaOverviewUpdated(peer);
+	}
+	if (newMsg && !added.isEmpty()) {
+		newItemsAdded(added);
+	}
+}
+
 void History::newItemAdded(HistoryItem *item) {
 	App::checkImageCacheSize();
 	if (item->from()) {
@@ -1318,6 +1423,42 @@ void History::newItemAdded(HistoryItem *item) {
 	}
 }
 
+void History::newItemsAdded(const QVector<HistoryItem*> &items) {
+	App::checkImageCacheSize();
+
+	uint64 ms = getms();
+	bool typingUpdated = false;
+	QVector<MsgId> unreadIds;
+	for (QVector<HistoryItem*>::const_iterator i = items.cbegin(), e = items.cend(); i != e; ++i) {
+		HistoryItem *item = *i;
+		if (item->from()) {
+			TypingUsers::iterator j = typing.find(item->from());
+			if (j != typing.end()) {
+				j.value() = ms;
+				typingUpdated = true;
+			}
+		}
+		if (item->out()) {
+			if (unreadBar) unreadBar->destroy();
+		} else if (item->unread()) {
+			notifies.push_back(item);
+			unreadIds.push_back(item->id);
+		}
+	}
+	if (typingUpdated) {
+		updateTyping(ms, 0, true);
+		App::main()->topBar()->update();
+	}
+	if (!unreadIds.isEmpty()) {
+		App::main()->newUnreadMsgs(this, unreadIds);
+	}
+	if (dialogs.isEmpty()) {
+		App::main()->createDialogAtTop(this, unreadCount);
+	} else {
+		emit App::main()->dialogToTop(dialogs);
+	}
+}
+
 void History::addToFront(const QVector<MTPMessage> &slice) {
 	if (slice.isEmpty()) {
 		oldLoaded = true;
@@ -1337,8 +1478,8 @@ void History::addToFront(const QVector<MTPMessage> &slice) {
 	for (QVector<MTPmessage>::const_iterator i = slice.cend() - 1, e = slice.cbegin(); ; --i) {
 		HistoryItem *adding = createItem(block, *i, false);
 		if (adding) {
-			if (prev && prev->date.date() != adding->date.date()) {
-				HistoryItem *dayItem = createDayServiceMsg(this, block, adding->date);
+			if (prev && prev->dateTime().date() != adding->dateTime().date()) {
+				HistoryItem *dayItem = createDayServiceMsg(this, block, adding->dateTime());
 				block->push_back(dayItem);
 				dayItem->y = block->height;
 				block->height += dayItem->resize(width);
@@ -1351,8 +1492,8 @@ void History::addToFront(const QVector<MTPMessage> &slice) {
 		}
 		if (i == e) break;
 	}
-	if (till && prev && prev->date.date() != till->date.date()) {
-		HistoryItem *dayItem = createDayServiceMsg(this, block, till->date);
+	if (till && prev && prev->dateTime().date() != till->dateTime().date()) {
+		HistoryItem *dayItem = createDayServiceMsg(this, block, till->dateTime());
 		block->push_back(dayItem);
 		dayItem->y = block->height;
 		block->height += dayItem->resize(width);
@@ -1394,7 +1535,7 @@ void History::addToFront(const QVector<MTPMessage> &slice) {
 	}
 	if (!isEmpty()) {
 		HistoryBlock *dateBlock = new HistoryBlock(this);
-		HistoryItem *dayItem = createDayServiceMsg(this, dateBlock, front()->front()->date);
+		HistoryItem *dayItem = createDayServiceMsg(this, dateBlock, front()->front()->dateTime());
 		dateBlock->push_back(dayItem);
 		int32 dh = dayItem->resize(width);
 		dateBlock->height = dh;
@@ -1417,6 +1558,26 @@ void History::addToFront(const QVector<MTPMessage> &slice) {
 	}
 }
 
+void History::addToFront(const MTPvectorView<MTPBoxedView<MTPmessageView> > &slice) {
+	typedef MTPvectorView<MTPBoxedView<MTPmessageView> > MessagesView;
+	if (!slice.count()) {
+		oldLoaded = true;
+		return;
+	}
+
+	QVector<MTPMessage> adding; // createItem() would drop the messages that are already loaded
+	adding.reserve(slice.count());
+	for (MessagesView::const_iterator i = slice.cbegin(), e = slice.cend(); i != e; ++i) {
+		MTPBoxedView<MTPmessageView> msg(*i);
+		if (App::histItemById(App::idFromMessage(msg))) continue;
+
+		adding.push_back(msg.read());
+	}
+	if (!adding.isEmpty()) {
+		addToFront(adding);
+	}
+}
+
 void History::addToBack(const QVector<MTPMessage> &slice) {
 	if (slice.isEmpty()) {
 		newLoaded = true;
@@ -1434,8 +1595,8 @@ void History::addToBack(const QVector<MTPMessage> &slice) {
 		--i;
 		HistoryItem *adding = createItem(block, *i, false);
 		if (adding) {
-			if (prev && prev->date.date() != adding->date.date()) {
-				HistoryItem *dayItem = createDayServiceMsg(this, block, adding->date);
+			if (prev && prev->dateTime().date() != adding->dateTime().date()) {
+				HistoryItem *dayItem = createDayServiceMsg(this, block, adding->dateTime());
 				prev->block()->push_back(dayItem);
 				dayItem->y = prev->block()->height;
 				prev->block()->height += dayItem->resize(width);
@@ -1485,7 +1646,7 @@ void History::addToBack(const QVector<MTPMessage> &slice) {
 	}
 	if (wasEmpty && !isEmpty()) {
 		HistoryBlock *dateBlock = new HistoryBlock(this);
-		HistoryItem *dayItem = createDayServiceMsg(this, dateBlock, front()->front()->date);
+		HistoryItem *dayItem = createDayServiceMsg(this, dateBlock, front()->front()->dateTime());
 		dateBlock->push_back(dayItem);
 		int32 dh = dayItem->resize(width);
 		dateBlock->height = dh;
@@ -1587,7 +1748,7 @@ void History::addUnreadBar() {
 	int32 j = indexOf(block);
 	if (i < 0 || j < 0) return;
 
-	HistoryUnreadBar *bar = new HistoryUnreadBar(this, block, unreadCount, showFrom->date);
+	HistoryUnreadBar *bar = new HistoryUnreadBar(this, block, unreadCount, showFrom->dateTime());
 	block->insert(i, bar);
 	unreadBar = bar;
 
@@ -1689,17 +1850,96 @@ MsgId History::maxMsgId() const {
 	return 0;
 }
 
-int32 History::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText) {
-	if (width != newWidth || dontRecountText) {
+enum HistoryResizeTextState {
+	HistoryResizeTextWaiting,
+	HistoryResizeTextCounting,
+	HistoryResizeTextCounted,
+	HistoryResizeTextDropped, // item was deleted before its text was counted
+};
+
+struct HistoryResizeText {
+	HistoryResizeText(HistoryItem *item = 0, const Text *text = 0, int32 width = 0) : item(item), text(text), width(width), height(0), state(HistoryResizeTextWaiting) {
+	}
+	HistoryItem *item; // only in GUI thread, 0 if the item was deleted
+	const Text *text;
+	int32 width, height;
+	QAtomicInt state; // set by a task when it takes the text and by History::resizeItemDeleted()
+};
+
+struct HistoryResizeJob { // texts of a history counted in QThreadPool after its width change
+	HistoryResizeJob() : tasks(0) {
+	}
+	void start();
+
+	QVector<HistoryResizeText> texts;
+	int32 tasks;
+	QSemaphore done; // released by each finished task
+	QAtomicInt cancelled;
+};
+
+namespace {
+	class HistoryResizeTask : public QRunnable { // Text::countHeight() without remembering only reads the text blocks, so items are not touched here
+	public:
+		HistoryResizeTask(HistoryResizeJob *job, HistoryResizeText *from, HistoryResizeText *till) : _job(job), _from(from), _till(till) {
+		}
+
+		void run() {
+			for (HistoryResizeText *i = _from; i != _till && !_job->cancelled.load(); ++i) {
+				if (!i->state.testAndSetAcquire(HistoryResizeTextWaiting, HistoryResizeTextCounting)) continue; // item was deleted
+
+				i->height = i->text->countHeight(i->width, false);
+				i->state.storeRelease(HistoryResizeTextCounted);
+			}
+			_job->done.release();
+		}
+
+	private:
+		HistoryResizeJob *_job;
+		HistoryResizeText *_from, *_till;
+	};
+}
+
+void HistoryResizeJob::start() {
+	int32 count = texts.size();
+	tasks = qMin(qMax(QThread::idealThreadCount(), 1), count);
+
+	HistoryResizeText *data = texts.data();
+	for (int32 i = 0; i < tasks; ++i) {
+		QThreadPool::globalInstance()->start(new HistoryResizeTask(this, data + (count * i) / tasks, data + (count * (i + 1)) / tasks));
+	}
+}
+
+int32 History::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText, int32 syncHeight) {
+	if (_resizeJob) {
+		if (width != newWidth) {
+			finishResize(false);
+		} else if (!resizeCounting()) {
+			finishResize();
+		}
+	}
+	if (width != newWidth || dontRecountText || _relayoutNeeded) {
+		if (_relayoutNeeded) { // all items get their new heights
+			dontRecountText = _relayoutNeeded = false;
+		}
+
+		HistoryResizeJob *job = 0;
+		int32 syncFrom = 0, syncTill = 0;
+		if (syncHeight > 0 && ytransform && width != newWidth && !dontRecountText && msgCount >= HistoryResizeBackgroundMsgs) {
+			job = new HistoryResizeJob();
+			syncFrom = qMin(*ytransform, qMax(height - syncHeight, 0)) - syncHeight; // the visible screen and one more around it in old coords
+			syncTill = syncFrom + 3 * syncHeight;
+		}
+
 		int32 y = 0;
 		for (iterator i = begin(), e = end(); i != e; ++i) {
 			HistoryBlock *block = *i;
 			bool updTransform = ytransform && (*ytransform >= block->y) && (*ytransform < block->y + block->height);
 			if (updTransform) *ytransform -= block->y;
+			int32 oldY = block->y;
 			if (block->y != y) {
 				block->y = y;
 			}
-			y += block->geomResize(newWidth, ytransform, dontRecountText);
+			y += block->geomResize(newWidth, ytransform, dontRecountText, job, syncFrom - oldY, syncTill - oldY);
 			if (updTransform) {
 				*ytransform += block->y;
 				ytransform = 0;
@@ -1707,11 +1947,115 @@ int32 History::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountTex
 		}
 		width = newWidth;
 		height = y;
+
+		if (job) {
+			if (job->texts.isEmpty()) {
+				delete job;
+			} else {
+				_resizeJob = job;
+				_resizeJob->start();
+			}
+		}
 	}
 	return height;
 }
 
+bool History::resizePending() const {
+	return _resizeJob || _relayoutNeeded;
+}
+
+bool History::resizeCounting() const {
+	return _resizeJob && _resizeJob->done.available() < _resizeJob->tasks;
+}
+
+void History::finishResize(bool apply) {
+	if (!_resizeJob) return;
+
+	if (!apply) _resizeJob->cancelled.store(1);
+	_resizeJob->done.acquire(_resizeJob->tasks);
+	if (apply) {
+		for (QVector<HistoryResizeText>::const_iterator i = _resizeJob->texts.cbegin(), e = _resizeJob->texts.cend(); i != e; ++i) {
+			if (i->item) i->item->resizeTextCounted(i->width, i->height);
+		}
+		_relayoutNeeded = true;
+	}
+	delete _resizeJob;
+	_resizeJob = 0;
+}
+
+void History::resizeItemDeleted(HistoryItem *item) {
+	if (!_resizeJob) return;
+
+	HistoryResizeText *i = _resizeJob->texts.data(), *e = i + _resizeJob->texts.size();
+	for (; i != e; ++i) {
+		if (i->item != item) continue;
+
+		if (!i->state.testAndSetAcquire(HistoryResizeTextWaiting, HistoryResizeTextDropped)) {
+			while (i->state.loadAcquire() == HistoryResizeTextCounting) { // only this text is waited for, not the whole job
+				QThread::yieldCurrentThread();
+			}
+		}
+		i->item = 0;
+	}
+}
+
+bool History::loadLayouts(int32 from, int32 till) {
+	bool changed = false;
+	for (const_iterator i = cbegin(), e = cend(); i != e; ++i) {
+		HistoryBlock *block = *i;
+		if (block->y >= till) break;
+		if (block->y + block->height <= from) continue;
+
+		for (HistoryBlock::const_iterator j = block->cbegin(), en = block->cend(); j != en; ++j) {
+			HistoryItem *item = *j;
+			int32 itemY = block->y + item->y;
+			if (itemY >= till) break;
+			if (itemY + item->height() <= from) continue;
+
+			if (item->loadLayout()) changed = true;
+		}
+	}
+	if (changed) _relayoutNeeded = true;
+	return changed;
+}
+
+void History::unloadLayouts(int32 from, int32 till) {
+	int32 budget = cHistoryLayoutBudget();
+	if (budget <= 0 || _resizeJob) return; // background job holds pointers to the texts
+
+	int32 total = 0, keepFrom = from - (till - from), keepTill = till + (till - from);
+	QVector<QPair<int32, HistoryItem*> > far;
+	for (const_iterator i = cbegin(), e = cend(); i != e; ++i) {
+		HistoryBlock *block = *i;
+		for (HistoryBlock::const_iterator j = block->cbegin(), en = block->cend(); j != en; ++j) {
+			HistoryItem *item = *j;
+			int32 size = item->layoutSize();
+			if (!size) continue;
+
+			total += size;
+			int32 itemY = block->y + item->y;
+			if (itemY >= keepTill) {
+				far.push_back(qMakePair(itemY - till, item));
+			} else if (itemY + item->height() <= keepFrom) {
+				far.push_back(qMakePair(from - itemY - item->height(), item));
+			}
+		}
+	}
+	if (total <= budget) return;
+
+	qSort(far); // farthest are unloaded first
+	int32 was = total, unloaded = 0;
+	for (int32 i = far.size(); i > 0 && total > budget;) {
+		HistoryItem *item = far.at(--i).second;
+		total -= item->layoutSize();
+		item->unloadLayout();
+		++unloaded;
+	}
+	DEBUG_LOG(("History Info: unloaded %1 message texts, layouts took %2 bytes, now %3 bytes").arg(unloaded).arg(was).arg(total));
+}
+
 void History::clear(bool leaveItems) {
+	if (!leaveItems) finishResize(false); // all the items are deleted, no need to drop them one by one
 	if (unreadBar) {
 		unreadBar->destroy();
 	}
@@ -1773,14 +2117,21 @@ void History::removeBlock(HistoryBlock *block) {
 	delete block;
 }
 
-int32 HistoryBlock::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText) {
+int32 HistoryBlock::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText, HistoryResizeJob *job, int32 syncFrom, int32 syncTill) {
 	int32 y = 0;
 	for (iterator i = begin(), e = end(); i != e; ++i) {
 		HistoryItem *item = *i;
 		bool updTransform = ytransform && (*ytransform >= item->y) && (*ytransform < item->y + item->height());
 		if (updTransform) *ytransform -= item->y;
+		int32 textWidth = 0;
+		const Text *text = (job && (item->y + item->height() <= syncFrom || item->y >= syncTill)) ? item->resizeText(newWidth, textWidth) : 0;
 		item->y = y;
-		y += item->resize(newWidth, dontRecountText);
+		if (text) { // the old text height is used until the job is finished
+			y += item->resize(newWidth, true);
+			job->texts.push_back(HistoryResizeText(item, text, textWidth));
+		} else {
+			y += item->resize(newWidth, dontRecountText);
+		}
 		if (updTransform) {
 			*ytransform += item->y;
 			ytransform = 0;
@@ -1856,7 +2207,7 @@ void HistoryBlock::removeItem(HistoryItem *item) {
 				} else if ((*prevBlock)[prevBlock->size() - 1]->itemType() == HistoryItem::DateType) {
 					(*prevBlock)[prevBlock->size() - 1]->destroy();
 					if (nextItem && myIndex == 1) { // destroy next date (for creating initial then)
-						initialDateTime = nextItem->date;
+						initialDateTime = nextItem->dateTime();
 						createInitialDate = true;
 						nextItem->destroy();
 					}
@@ -1933,14 +2284,15 @@ ItemAnimations &itemAnimations() {
 
 HistoryItem::HistoryItem(History *history, HistoryBlock *block, MsgId msgId, bool out, bool unread, QDateTime msgDate, int32 from) : y(0)
 , id(msgId)
-, date(msgDate)
+, date(msgDate.toTime_t())
+, _fromVersion(0)
 , _from(App::user(from))
-, _fromVersion(_from->nameVersion)
 , _history(history)
 , _block(block)
 , _out(out)
 , _unread(unread)
 {
+	_fromVersion = _from->nameVersion;
 }
 
 void HistoryItem::markRead() {
@@ -3020,6 +3372,7 @@ HistoryMessage::HistoryMessage(History *history, HistoryBlock *block, const MTPD
 , _textWidth(0)
 , _textHeight(0)
 , _media(0)
+, _textUnloaded(false)
 {
 	QString text(textClean(qs(msg.vmessage)));
 	initMedia(msg.vmedia, text);
@@ -3044,6 +3397,7 @@ HistoryMessage::HistoryMessage(History *history, HistoryBlock *block, MsgId msgI
 , _textWidth(0)
 , _textHeight(0)
 , _media(0)
+, _textUnloaded(false)
 {
 	QString text(msg);
 	initMedia(media, text);
@@ -3056,6 +3410,7 @@ HistoryMessage::HistoryMessage(History *history, HistoryBlock *block, MsgId msgI
 , _textWidth(0)
 , _textHeight(0)
 , _media(0)
+, _textUnloaded(false)
 {
 	QString text(msg);
 	if (fromMedia) {
@@ -3111,7 +3466,7 @@ void HistoryMessage::initMedia(const MTPMessageMedia &media, QString &currentTex
 }
 
 void HistoryMessage::initDimensions(const QString &text) {
-	_time = date.toString(qsl("hh:mm"));
+	_time = dateTime().toString(qsl("hh:mm"));
 	_timeWidth = st::msgDateFont->m.width(_time);
 	if (!_media) {
 		_timeWidth += st::msgDateSpace + (out() ? st::msgDateCheckSpace + st::msgCheckRect.pxWidth() : 0) - st::msgDateDelta.x();
@@ -3126,6 +3481,7 @@ void HistoryMessage::initDimensions(const HistoryItem *parent) {
 		_maxw = _media->maxWidth();
 		_minh = _media->height();
 	} else {
+		loadText();
 		_maxw = _text.maxWidth();
 		_minh = _text.minHeight();
 		_maxw += st::msgPadding.left() + st::msgPadding.right();
@@ -3144,6 +3500,7 @@ bool HistoryMessage::uploading() const {
 }
 
 QString HistoryMessage::selectedText(uint32 selection) const {
+	loadText();
 	if (_media && selection == FullItemSel) {
 		return _text.original(0, 0xFFFF) + '[' + _media->inDialogsText() + ']';
 	}
@@ -3248,6 +3605,7 @@ void HistoryMessage::drawMessageText(QPainter &p, const QRect &trect, uint32 sel
 	p.setFont(st::msgFont->f);
 	uint16 selectedFrom = (selection == FullItemSel) ? 0 : (selection >> 16) & 0xFFFF;
 	uint16 selectedTo = (selection == FullItemSel) ? 0 : selection & 0xFFFF;
+	loadText();
 	_text.draw(p, trect.x(), trect.y(), trect.width(), Qt::AlignLeft, 0, -1, selectedFrom, selectedTo);
 
 	textstyleRestore();
@@ -3266,7 +3624,7 @@ int32 HistoryMessage::resize(int32 width, bool dontRecountText, const HistoryIte
 			width = st::msgMaxWidth;
 		}
 		int32 nwidth = qMax(width - st::msgPadding.left() - st::msgPadding.right(), 0);
-		if (nwidth != _textWidth) {
+		if (nwidth != _textWidth && !_textUnloaded) { // unloaded text keeps the old height until loadLayout()
 			_textWidth = nwidth;
 			_textHeight = _text.countHeight(nwidth);
 		}
@@ -3284,6 +3642,52 @@ int32 HistoryMessage::resize(int32 width, bool dontRecountText, const HistoryIte
 	return _height;
 }
 
+const Text *HistoryMessage::resizeText(int32 width, int32 &textWidth) const {
+	if (_media || _textUnloaded) return 0;
+
+	width -= st::msgMargin.left() + st::msgMargin.right();
+	textWidth = qMax(qMin(width, int32(st::msgMaxWidth)) - st::msgPadding.left() - st::msgPadding.right(), 1); // same as in resize()
+	return (textWidth == _textWidth || textWidth >= _text.maxWidth()) ? 0 : &_text;
+}
+
+void HistoryMessage::resizeTextCounted(int32 textWidth, int32 textHeight) {
+	_textWidth = textWidth;
+	_textHeight = textHeight;
+}
+
+int32 HistoryMessage::layoutSize() const {
+	return (_media || _textUnloaded) ? 0 : _text.layoutSize();
+}
+
+int32 HistoryMessage::layoutBlocks() const {
+	return (_media || _textUnloaded) ? 0 : _text.blocksCount();
+}
+
+void HistoryMessage::unloadLayout() {
+	if (_media || _textUnloaded) return;
+
+	_source = _text.parsedSource();
+	_text.clean();
+	_textUnloaded = true;
+}
+
+bool HistoryMessage::loadLayout() {
+	if (!_textUnloaded) return false;
+
+	loadText();
+	int32 was = _height;
+	if (_history->width) resize(_history->width);
+	return _height != was;
+}
+
+void HistoryMessage::loadText() const {
+	if (!_textUnloaded) return;
+
+	_text.setText(st::msgFont, _source + textcmdSkipBlock(_timeWidth, st::msgDateFont->height - st::msgDateDelta.y()), _historyTextOptions);
+	_source = QString();
+	_textUnloaded = false;
+}
+
 bool HistoryMessage::hasPoint(int32 x, int32 y) const {
 	int32 left = _out ? st::msgMargin.right() : st::msgMargin.left(), width = _history->width - st::msgMargin.left() - st::msgMargin.right(), mwidth = st::msgMaxWidth;
 	if (_media && _media->maxWidth() > mwidth) mwidth = _media->maxWidth();
@@ -3346,6 +3750,7 @@ void HistoryMessage::getState(TextLinkPtr &lnk, bool &inText, int32 x, int32 y)
 		r.setTop(r.top() + st::msgNameFont->height);
 	}
 	QRect trect(r.marginsAdded(-st::msgPadding));
+	loadText();
 	_text.getState(lnk, inText, x - trect.x(), y - trect.y(), trect.width());
 }
 
@@ -3376,12 +3781,14 @@ void HistoryMessage::getSymbol(uint16 &symbol, bool &after, bool &upon, int32 x,
 		r.setTop(r.top() + st::msgNameFont->height);
 	}
 	QRect trect(r.marginsAdded(-st::msgPadding));
+	loadText();
 	_text.getSymbol(symbol, after, upon, x - trect.x(), y - trect.y(), trect.width());
 }
 
 void HistoryMessage::drawInDialog(QPainter &p, const QRect &r, bool act, const HistoryItem *&cacheFor, Text &cache) const {
 	if (cacheFor != this) {
 		cacheFor = this;
+		loadText();
 		QString msg(_media ? _media->inDialogsText() : _text.original(0, 0xFFFF, false));
 		if (_history->peer->chat || out()) {
 			TextCustomTagsMap custom;
@@ -3405,6 +3812,7 @@ QString HistoryMessage::notificationHeader() const {
 }
 
 QString HistoryMessage::notificationText() const {
+	loadText();
     QString msg(_media ? _media->inDialogsText() : _text.original(0, 0xFFFF, false));
     if (msg.size() > 0xFF) msg = msg.mid(0, 0xFF) + qsl("..");
 // subtitle used
@@ -3415,6 +3823,7 @@ QString HistoryMessage::notificationText() const {
 }
 
 HistoryMessage::~HistoryMessage() {
+	_history->resizeItemDeleted(this); // _text may be counted in background
 	if (_media) {
 		_media->unregItem(this);
 	}
@@ -3422,22 +3831,22 @@ HistoryMessage::~HistoryMessage() {
 }
 
 HistoryForwarded::HistoryForwarded(History *history, HistoryBlock *block, const MTPDmessageForwarded &msg) : HistoryMessage(history, block, msg.vid.v, msg.vout.v, msg.vunread.v, ::date(msg.vdate), msg.vfrom_id.v, textClean(qs(msg.vmessage)), msg.vmedia)
-, fwdDate(::date(msg.vfwd_date))
+, fwdDate(fromServerTime(msg.vfwd_date))
+, fwdFromVersion(0)
 , fwdFrom(App::user(msg.vfwd_from_id.v))
-, fwdFromName(4096)
-, fwdFromVersion(fwdFrom->nameVersion)
 , fromWidth(st::msgServiceFont->m.width(lang(lng_forwarded_from)))
 {
+	fwdFromVersion = fwdFrom->nameVersion;
 	fwdNameUpdated();
 }
 
 HistoryForwarded::HistoryForwarded(History *history, HistoryBlock *block, MsgId id, HistoryMessage *msg) : HistoryMessage(history, block, id, true, true, ::date(unixtime()), MTP::authedId(), msg->HistoryMessage::selectedText(FullItemSel), msg->getMedia())
 , fwdDate(dynamic_cast<HistoryForwarded*>(msg) ? dynamic_cast<HistoryForwarded*>(msg)->dateForwarded() : msg->date)
+, fwdFromVersion(0)
 , fwdFrom(dynamic_cast<HistoryForwarded*>(msg) ? dynamic_cast<HistoryForwarded*>(msg)->fromForwarded() : msg->from())
-, fwdFromName(4096)
-, fwdFromVersion(fwdFrom->nameVersion)
 , fromWidth(st::msgServiceFont->m.width(lang(lng_forwarded_from)))
 {
+	fwdFromVersion = fwdFrom->nameVersion;
 	fwdNameUpdated();
 }
 
@@ -3451,8 +3860,7 @@ QString HistoryForwarded::selectedText(uint32 selection) const {
 
 void HistoryForwarded::fwdNameUpdated() const {
 	if (_media) return;
-	fwdFromName.setText(st::msgServiceNameFont, App::peerName(fwdFrom), _textNameOptions);
-	int32 _namew = fromWidth + fwdFromName.maxWidth() + st::msgPadding.left() + st::msgPadding.right();
+	int32 _namew = fromWidth + fwdFrom->nameText.maxWidth() + st::msgPadding.left() + st::msgPadding.right();
 	if (_namew > _maxw) _maxw = _namew;
 }
 
@@ -3475,7 +3883,7 @@ void HistoryForwarded::drawMessageText(QPainter &p, const QRect &trect, uint32 s
 		p.drawText(trect.x(), trect.y() + h1 + serviceFont->ascent, lang(lng_forwarded_from));
 
 		p.setFont(serviceName->f);
-		fwdFromName.drawElided(p, trect.x() + fromWidth, trect.y() + h1, trect.width() - fromWidth);
+		fwdFrom->nameText.drawElided(p, trect.x() + fromWidth, trect.y() + h1, trect.width() - fromWidth);
 	} else {
 		p.drawText(trect.x(), trect.y() + h1 + serviceFont->ascent, serviceFont->m.elidedText(lang(lng_forwarded_from), Qt::ElideRight, trect.width()));
 	}
@@ -3554,7 +3962,7 @@ void HistoryForwarded::getState(TextLinkPtr &lnk, bool &inText, int32 x, int32 y
 
 		int32 h1 = 0, h2 = st::msgServiceNameFont->height;
 		if (y >= trect.top() + h1 && y < trect.top() + (h1 + h2)) {
-			if (x >= trect.left() + fromWidth && x < trect.right() && x < trect.left() + fromWidth + fwdFromName.maxWidth()) {
+			if (x >= trect.left() + fromWidth && x < trect.right() && x < trect.left() + fromWidth + fwdFrom->nameText.maxWidth()) {
 				lnk = fwdFrom->lnk;
 			}
 			return;
@@ -3773,6 +4181,18 @@ int32 HistoryServiceMsg::resize(int32 width, bool dontRecountText, const History
 	return _height;
 }
 
+const Text *HistoryServiceMsg::resizeText(int32 width, int32 &textWidth) const {
+	width -= st::msgServiceMargin.left() + st::msgServiceMargin.left(); // two small margins
+	if (width < st::msgServicePadding.left() + st::msgServicePadding.right() + 1) width = st::msgServicePadding.left() + st::msgServicePadding.right() + 1;
+	textWidth = qMax(width - st::msgPadding.left() - st::msgPadding.right(), 0);
+	return (textWidth == _textWidth || textWidth >= _text.maxWidth()) ? 0 : &_text;
+}
+
+void HistoryServiceMsg::resizeTextCounted(int32 textWidth, int32 textHeight) {
+	_textWidth = textWidth;
+	_textHeight = textHeight;
+}
+
 bool HistoryServiceMsg::hasPoint(int32 x, int32 y) const {
 	int32 left = st::msgServiceMargin.left(), width = _history->width - st::msgServiceMargin.left() - st::msgServiceMargin.left(), height = _height - st::msgServiceMargin.top() - st::msgServiceMargin.bottom(); // two small margins
 	if (width < 1) return false;
@@ -3838,6 +4258,7 @@ HistoryMedia *HistoryServiceMsg::getMedia(bool inOverview) const {
 }
 
 HistoryServiceMsg::~HistoryServiceMsg() {
+	_history->resizeItemDeleted(this); // _text may be counted in background
 	delete _media;
 }
 
@@ -25,6 +25,7 @@ typedef uint64 DocumentId;
 typedef int32 MsgId;
 
 void historyInit();
+void reportHistoryMemory(); // bytes taken by all loaded messages, result goes to log
 
 class HistoryItem;
 
@@ -561,6 +562,7 @@ struct Histories : public QHash<PeerId, History*> {
 	}
 
 	HistoryItem *addToBack(const MTPmessage &msg, int msgState = 1); // 1 - new message, 0 - not new message, -1 - searched message
+	void addToBack(const QVector<MTPMessage> &msgs, int msgState = 1); // sorted by id, grouped by peer and added by History::addNewMessages, msgState is 1 or 0
 //	HistoryItem *addToBack(const MTPgeoChatMessage &msg, bool newMsg = true);
 
 	typedef QMap<History*, uint64> TypingHistories; // when typing in this history started
@@ -648,6 +650,7 @@ inline MTPMessagesFilter typeToMediaFilter(MediaOverviewType &type) {
 class HistoryMedia;
 class HistoryMessage;
 class HistoryUnreadBar;
+struct HistoryResizeJob;
 struct History : public QList<HistoryBlock*> {
 	History(const PeerId &peerId);
 
@@ -658,6 +661,7 @@ struct History : public QList<HistoryBlock*> {
 	void removeBlock(HistoryBlock *block);
 
 	~History() {
+		finishResize(false);
 		clear();
 	}
 
@@ -670,11 +674,14 @@ struct History : public QList<HistoryBlock*> {
 	HistoryItem *addToBackForwarded(MsgId id, HistoryMessage *item);
 //	HistoryItem *addToBack(const MTPgeoChatMessage &msg, bool newMsg = true);
 	void addToFront(const QVector<MTPMessage> &slice);
+	void addToFront(const MTPvectorView<MTPBoxedView<MTPmessageView> > &slice); // skips the messages already loaded without materializing them
 	void addToBack(const QVector<MTPMessage> &slice);
 	void createInitialDateBlock(const QDateTime &date);
-	HistoryItem *doAddToBack(HistoryBlock *to, bool newBlock, HistoryItem *adding, bool newMsg);
+	HistoryItem *doAddToBack(HistoryBlock *to, bool newBlock, HistoryItem *adding, bool newMsg, bool *overviewUpdated = 0); // mediaOverviewUpdated() is left to the caller if overviewUpdated is passed
+	void addNewMessages(const QVector<MTPMessage> &msgs, bool newMsg); // sorted by id, all for this history
 
 	void newItemAdded(HistoryItem *item);
+	void newItemsAdded(const QVector<HistoryItem*> &items); // one dialog and unread counter update for all the items
 
 	void inboxRead(bool byThisInstance = false);
 	void outboxRead();
@@ -698,7 +705,15 @@ struct History : public QList<HistoryBlock*> {
 	MsgId minMsgId() const;
 	MsgId maxMsgId() const;
 
-	int32 geomResize(int32 newWidth, int32 *ytransform = 0, bool dontRecountText = false); // return new size
+	int32 geomResize(int32 newWidth, int32 *ytransform = 0, bool dontRecountText = false, int32 syncHeight = 0); // return new size, if syncHeight > 0 texts farther than syncHeight from *ytransform are counted in background
+	bool resizePending() const; // geomResize() with the same width must be called to apply the background counting
+	bool resizeCounting() const;
+	void finishResize(bool apply = true); // waits for the background counting, apply = false drops outdated results
+	void resizeItemDeleted(HistoryItem *item); // drops the item texts from the background counting, waits only if one is being counted now
+
+	bool loadLayouts(int32 from, int32 till); // loads unloaded items in [from, till) of history coords, true if their heights were changed
+	void unloadLayouts(int32 from, int32 till); // unloads items far from [from, till) while the history takes more than cHistoryLayoutBudget()
+
 	int32 width, height, msgCount, unreadCount;
 	int32 inboxReadTill, outboxReadTill;
 	HistoryItem *showFrom;
@@ -779,6 +794,9 @@ struct History : public QList<HistoryBlock*> {
 	MediaOverviewIds _overviewIds[OverviewCount];
 	int32 _overviewCount[OverviewCount]; // -1 - not loaded, 0 - all loaded, > 0 - count, but not all loaded
 
+	HistoryResizeJob *_resizeJob;
+	bool _relayoutNeeded; // item heights were changed outside of geomResize(), their y are not updated yet
+
 	static const int32 ScrollMax = INT_MAX;
 };
 
@@ -1072,7 +1090,7 @@ struct HistoryBlock : public QVector<HistoryItem*> {
 	}
 	void removeItem(HistoryItem *item);
 
-	int32 geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText); // return new size
+	int32 geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText, HistoryResizeJob *job = 0, int32 syncFrom = 0, int32 syncTill = 0); // return new size, texts of items outside [syncFrom, syncTill) are added to job
 	int32 y, height;
 	History *history;
 };
@@ -1186,6 +1204,22 @@ public:
 	}
 	virtual void updateMedia(const MTPMessageMedia &media) {
 	}
+	virtual const Text *resizeText(int32 width, int32 &textWidth) const { // text which height resize(width) would count, 0 if it is cheap
+		return 0;
+	}
+	virtual void resizeTextCounted(int32 textWidth, int32 textHeight) { // result of resizeText()->countHeight(textWidth)
+	}
+	virtual int32 layoutSize() const { // memory freed by unloadLayout()
+		return 0;
+	}
+	virtual void unloadLayout() { // keeps only what is needed to load it back, height is not changed
+	}
+	virtual bool loadLayout() { // true if the height was changed
+		return false;
+	}
+	virtual int32 layoutBlocks() const { // text blocks in the loaded layout
+		return 0;
+	}
 
 	virtual QString selectedText(uint32 selection) const {
 		return qsl("[-]");
@@ -1199,7 +1233,10 @@ public:
 	void markRead();
 
 	int32 y, id;
-	QDateTime date;
+	int32 date; // unix time
+	QDateTime dateTime() const {
+		return ::date(date);
+	}
 
 	virtual HistoryMedia *getMedia(bool inOverview = false) const {
 		return 0;
@@ -1218,11 +1255,12 @@ public:
 
 protected:
 
+	mutable int32 _fromVersion; // fills the gap after date
 	UserData *_from;
-	mutable int32 _fromVersion;
 	History *_history;
 	HistoryBlock *_block;
-	bool _out, _unread;
+	bool _out : 1;
+	bool _unread : 1;
 
 };
 
@@ -1455,10 +1493,17 @@ public:
 	virtual void drawMessageText(QPainter &p, const QRect &trect, uint32 selection) const;
 
 	int32 resize(int32 width, bool dontRecountText = false, const HistoryItem *parent = 0);
+	const Text *resizeText(int32 width, int32 &textWidth) const;
+	void resizeTextCounted(int32 textWidth, int32 textHeight);
+	int32 layoutSize() const;
+	void unloadLayout();
+	bool loadLayout();
+	int32 layoutBlocks() const;
 	bool hasPoint(int32 x, int32 y) const;
 	void getState(TextLinkPtr &lnk, bool &inText, int32 x, int32 y) const;
 	void getSymbol(uint16 &symbol, bool &after, bool &upon, int32 x, int32 y) const;
 	uint32 adjustSelection(uint16 from, uint16 to, TextSelectType type) const {
+		loadText();
 		return _text.adjustSelection(from, to, type);
 	}
 
@@ -1487,13 +1532,17 @@ public:
 
 protected:
 
-	Text _text;
+	void loadText() const; // parses _source back if the text was unloaded
+
+	mutable Text _text;
+	mutable QString _source; // original of the unloaded _text
 
 	int32 _textWidth, _textHeight;
 
 	HistoryMedia *_media;
 	QString _time;
 	int32 _timeWidth;
+	mutable bool _textUnloaded;
 
 };
 
@@ -1512,7 +1561,7 @@ public:
 	void getState(TextLinkPtr &lnk, bool &inText, int32 x, int32 y) const;
 	void getSymbol(uint16 &symbol, bool &after, bool &upon, int32 x, int32 y) const;
 
-	QDateTime dateForwarded() const {
+	int32 dateForwarded() const {
 		return fwdDate;
 	}
 	UserData *fromForwarded() const {
@@ -1522,10 +1571,9 @@ public:
 
 protected:
 
-	QDateTime fwdDate;
-	UserData *fwdFrom;
-	mutable Text fwdFromName;
+	int32 fwdDate;
 	mutable int32 fwdFromVersion;
+	UserData *fwdFrom; // its nameText is drawn, not copied to each forwarded message
 	int32 fromWidth;
 
 };
@@ -1541,6 +1589,8 @@ public:
 
 	void draw(QPainter &p, uint32 selection) const;
 	int32 resize(int32 width, bool dontRecountText = false, const HistoryItem *parent = 0);
+	const Text *resizeText(int32 width, int32 &textWidth) const;
+	void resizeTextCounted(int32 textWidth, int32 textHeight);
 	bool hasPoint(int32 x, int32 y) const;
 	void getState(TextLinkPtr &lnk, bool &inText, int32 x, int32 y) const;
 	void getSymbol(uint16 &symbol, bool &after, bool &upon, int32 x, int32 y) const;
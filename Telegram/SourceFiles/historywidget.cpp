@@ -68,8 +68,9 @@ HistoryList::HistoryList(HistoryWidget *historyWidget, ScrollArea *scroll, Histo
 	setMouseTracking(true);
 }
 
-void HistoryList::messagesReceived(const QVector<MTPMessage> &messages) {
-	hist->addToFront(messages);
+void HistoryList::messagesReceived(const mtpBuffer &messages) { // serialized vector of messages
+	const mtpPrime *from = messages.constData();
+	hist->addToFront(MTPvectorView<MTPBoxedView<MTPmessageView> >(from, from + messages.size()));
 }
 
 void HistoryList::messagesReceivedDown(const QVector<MTPMessage> &messages) {
@@ -853,7 +854,7 @@ QString HistoryList::getSelectedText() const {
 	QMap<int32, QString> texts;
 	for (SelectedItems::const_iterator i = _selected.cbegin(), e = _selected.cend(); i != e; ++i) {
 		HistoryItem *item = i.key();
-		QString text, sel = item->selectedText(FullItemSel), time = item->date.toString(timeFormat);
+		QString text, sel = item->selectedText(FullItemSel), time = item->dateTime().toString(timeFormat);
 		int32 size = item->from()->name.size() + time.size() + sel.size();
 		text.reserve(size);
 		texts.insert(item->y + item->block()->y, text.append(item->from()->name).append(time).append(sel));
@@ -883,7 +884,7 @@ void HistoryList::keyPressEvent(QKeyEvent *e) {
 
 int32 HistoryList::recountHeight(bool dontRecountText) {
 	int32 st = hist->lastScrollTop;
-	hist->geomResize(scrollArea->width(), &st, dontRecountText);
+	hist->geomResize(scrollArea->width(), &st, dontRecountText, scrollArea->height());
 	return st;
 }
 
@@ -1563,6 +1564,11 @@ HistoryWidget::HistoryWidget(QWidget *parent) : QWidget(parent)
 	_animActiveTimer.setSingleShot(false);
 	connect(&_animActiveTimer, SIGNAL(timeout()), this, SLOT(onAnimActiveStep()));
 
+	_resizeCheckTimer.setSingleShot(true);
+	connect(&_resizeCheckTimer, SIGNAL(timeout()), this, SLOT(onResizeCheck()));
+	_layoutCheckTimer.setSingleShot(true);
+	connect(&_layoutCheckTimer, SIGNAL(timeout()), this, SLOT(onLayoutCheck()));
+
 	_scroll.hide();
 	_scroll.move(0, 0);
 
@@ -1892,6 +1898,12 @@ void HistoryWidget::updateControlsVisibility() {
 }
 
 void HistoryWidget::newUnreadMsg(History *history, MsgId msgId) {
+	newUnreadMsgs(history, QVector<MsgId>(1, msgId));
+}
+
+void HistoryWidget::newUnreadMsgs(History *history, const QVector<MsgId> &msgIds) {
+	if (msgIds.isEmpty()) return;
+
 	if (App::wnd()->historyIsActive()) {
 		if (hist == history && hist->readyForWork()) {
 			historyWasRead();
@@ -1900,9 +1912,11 @@ void HistoryWidget::newUnreadMsg(History *history, MsgId msgId) {
 			}
 		} else {
 			if (hist != history) {
-				App::wnd()->notifySchedule(history, msgId);
+				for (QVector<MsgId>::const_iterator i = msgIds.cbegin(), e = msgIds.cend(); i != e; ++i) {
+					App::wnd()->notifySchedule(history, *i);
+				}
 			}
-			history->setUnreadCount(history->unreadCount + 1);
+			history->setUnreadCount(history->unreadCount + msgIds.size());
 		}
 	} else {
 		if (hist == history && hist->readyForWork()) {
@@ -1910,8 +1924,10 @@ void HistoryWidget::newUnreadMsg(History *history, MsgId msgId) {
 				if (history->unreadBar) history->unreadBar->destroy();
 			}
 		}
-		App::wnd()->notifySchedule(history, msgId);
-		history->setUnreadCount(history->unreadCount + 1);
+		for (QVector<MsgId>::const_iterator i = msgIds.cbegin(), e = msgIds.cend(); i != e; ++i) {
+			App::wnd()->notifySchedule(history, *i);
+		}
+		history->setUnreadCount(history->unreadCount + msgIds.size());
 		history->lastWidth = 0;
 	}
 }
@@ -1939,7 +1955,7 @@ bool HistoryWidget::messagesFailed(const RPCError &e, mtpRequestId requestId) {
 	return true;
 }
 
-void HistoryWidget::messagesReceived(const MTPmessages_Messages &messages, mtpRequestId requestId) {
+void HistoryWidget::messagesReceived(const mtpPrime *from, const mtpPrime *end, mtpRequestId requestId) { // messages for the front are kept serialized and read by views
 	if (!hist) {
 		histPreloading = histPreloadingDown = _loadingAroundRequest = 0;
 		return;
@@ -1947,25 +1963,28 @@ void HistoryWidget::messagesReceived(const MTPmessages_Messages &messages, mtpRe
 
 	PeerId peer = 0;
 	int32 count = 0;
-	const QVector<MTPMessage> *histList = 0;
+	mtpBuffer histList;
+	MTPBoxedView<MTPmessages_messagesView> messages(from, end);
 	switch (messages.type()) {
 	case mtpc_messages_messages: {
-		const MTPDmessages_messages &data(messages.c_messages_messages());
-		App::feedUsers(data.vusers);
-		App::feedChats(data.vchats);
-		histList = &data.vmessages.c_vector().v;
-		count = histList->size();
+		MTPDmessages_messagesView data(messages.c_messages_messages());
+		App::feedUsers(data.vusers().read<MTPvector<MTPUser> >());
+		App::feedChats(data.vchats().read<MTPvector<MTPChat> >());
+		data.vmessages().copyTo(histList);
+		count = histList.at(0);
 	} break;
 	case mtpc_messages_messagesSlice: {
-		const MTPDmessages_messagesSlice &data(messages.c_messages_messagesSlice());
-		App::feedUsers(data.vusers);
-		App::feedChats(data.vchats);
-		histList = &data.vmessages.c_vector().v;
-		count = data.vcount.v;
+		MTPDmessages_messagesSliceView data(messages.c_messages_messagesSlice());
+		App::feedUsers(data.vusers().read<MTPvector<MTPUser> >());
+		App::feedChats(data.vchats().read<MTPvector<MTPChat> >());
+		data.vmessages().copyTo(histList);
+		count = data.vcount().v;
 	} break;
 	}
-	if (histList && !histList->isEmpty()) {
-		const MTPmessage &msg(histList->front());
+	const mtpPrime *listFrom = histList.constData();
+	MTPvectorView<MTPBoxedView<MTPmessageView> > histMessages(listFrom, listFrom + histList.size());
+	if (histMessages.count()) {
+		MTPMessage msg((*histMessages.cbegin()).read());
 		PeerId from_id(0), to_id(0);
 		switch (msg.type()) {
 		case mtpc_message:
@@ -1995,7 +2014,7 @@ void HistoryWidget::messagesReceived(const MTPmessages_Messages &messages, mtpRe
 			_loadingAroundRequest = 0;
 			hist->loadAround(_loadingAroundId);
 			if (hist->isEmpty()) {
-				addMessagesToFront(*histList);
+				addMessagesToFront(histList);
 			}
 			if (histPreloading) MTP::cancel(histPreloading);
 			if (histPreloadingDown) MTP::cancel(histPreloadingDown);
@@ -2007,38 +2026,20 @@ void HistoryWidget::messagesReceived(const MTPmessages_Messages &messages, mtpRe
 
 	if (peer && peer != histPeer->id) return;
 
-	if (histList) {
-		if (!hist->minMsgId() || histList->isEmpty()) {
-			if (down) {
-				addMessagesToBack(*histList);
-				histPreloadDown.clear();
-			} else {
-				addMessagesToFront(*histList);
-				histPreload.clear();
-			}
+	if (!hist->minMsgId() || !histMessages.count()) {
+		if (down) {
+			addMessagesToBack(histMessages.read<MTPvector<MTPMessage> >().c_vector().v);
+			histPreloadDown.clear();
 		} else {
-			if (down) {
-				histPreloadDown = *histList;
-			} else {
-				histPreload = *histList;
-			}
+			addMessagesToFront(histList);
+			histPreload.clear();
 		}
 	} else {
 		if (down) {
-			addMessagesToBack(QVector<MTPMessage>());
+			histPreloadDown = histMessages.read<MTPvector<MTPMessage> >().c_vector().v;
 		} else {
-			addMessagesToFront(QVector<MTPMessage>());
-		}
-		if (!hist->readyForWork()) {
-			if (hist->activeMsgId) {
-				hist->activeMsgId = 0;
-			}
-			if (!hist->readyForWork()) {
-				hist->setUnreadCount(hist->msgCount);
-			}
+			histPreload = histList;
 		}
-		checkUnreadLoaded(true);
-		return;
 	}
 
 	if (down && hist->loadedAtBottom() && histPreloadDown.size()) {
@@ -2156,6 +2157,12 @@ void HistoryWidget::onListScroll() {
 		return;
 	}
 
+	int32 top = _scroll.scrollTop() - (_list->height() - hist->height - st::historyPadding); // in history coords
+	if (hist->loadLayouts(top - _scroll.height(), top + 2 * _scroll.height())) {
+		updateListSize(); // loaded texts got their real heights
+	}
+	_layoutCheckTimer.start(HistoryLayoutCheckTimeout);
+
 	if (hist->readyForWork() && (_scroll.scrollTop() + PreloadHeightsCount * _scroll.height() > _scroll.scrollTopMax())) {
 		loadMessagesDown();
 	}
@@ -2972,6 +2979,9 @@ void HistoryWidget::updateListSize(int32 addToY, bool initial, bool loadedDown,
 		hist->lastScrollTop = _scroll.scrollTop();
 	}
 	int32 newSt = _list->recountHeight(!!resizedItem);
+	if (hist->resizePending()) {
+		_resizeCheckTimer.start(HistoryResizeCheckTimeout);
+	}
 	bool washidden = _scroll.isHidden();
 	if (washidden) {
 		_scroll.show();
@@ -3030,7 +3040,7 @@ void HistoryWidget::updateListSize(int32 addToY, bool initial, bool loadedDown,
 	_scroll.scrollToY(toY);
 }
 
-void HistoryWidget::addMessagesToFront(const QVector<MTPMessage> &messages) {
+void HistoryWidget::addMessagesToFront(const mtpBuffer &messages) {
 	int32 oldH = hist->height;
 	_list->messagesReceived(messages);
 	updateListSize(hist->height - oldH);
@@ -3209,6 +3219,23 @@ void HistoryWidget::onAnimActiveStep() {
 	App::main()->msgUpdated(histPeer->id, item);
 }
 
+void HistoryWidget::onResizeCheck() {
+	if (!hist || !hist->resizePending()) return;
+
+	if (hist->resizeCounting()) {
+		_resizeCheckTimer.start(HistoryResizeCheckTimeout);
+	} else {
+		updateListSize(); // moves the items counted in background keeping the scroll position
+	}
+}
+
+void HistoryWidget::onLayoutCheck() {
+	if (!hist || !_list || histPreloading) return;
+
+	int32 top = _scroll.scrollTop() - (_list->height() - hist->height - st::historyPadding);
+	hist->unloadLayouts(top, top + _scroll.height());
+}
+
 uint64 HistoryWidget::animActiveTime() const {
 	return _animActiveTimer.isActive() ? (getms() - _animActiveStart) : 0;
 }
@@ -37,7 +37,7 @@ public:
 
 	HistoryList(HistoryWidget *historyWidget, ScrollArea *scroll, History *history);
 
-	void messagesReceived(const QVector<MTPMessage> &messages);
+	void messagesReceived(const mtpBuffer &messages);
 	void messagesReceivedDown(const QVector<MTPMessage> &messages);
 
 	bool event(QEvent *e); // calls touchEvent when necessary
@@ -248,7 +248,7 @@ public:
 
 	HistoryWidget(QWidget *parent);
 
-	void messagesReceived(const MTPmessages_Messages &messages, mtpRequestId requestId);
+	void messagesReceived(const mtpPrime *from, const mtpPrime *end, mtpRequestId requestId);
 
 	void windowShown();
 	bool isActive() const;
@@ -277,6 +277,7 @@ public:
 
 	void msgUpdated(PeerId peer, const HistoryItem *msg);
 	void newUnreadMsg(History *history, MsgId msgId);
+	void newUnreadMsgs(History *history, const QVector<MsgId> &msgIds); // unread counter and read request are updated once
 	void historyToDown(History *history);
 	void historyWasRead(bool force = true);
 
@@ -387,12 +388,14 @@ public slots:
 	void onClearSelected();
 
 	void onAnimActiveStep();
+	void onResizeCheck();
+	void onLayoutCheck();
 
 private:
 
 	bool messagesFailed(const RPCError &error, mtpRequestId requestId);
 	void updateListSize(int32 addToY = 0, bool initial = false, bool loadedDown = false, HistoryItem *resizedItem = 0);
-	void addMessagesToFront(const QVector<MTPMessage> &messages);
+	void addMessagesToFront(const mtpBuffer &messages);
 	void addMessagesToBack(const QVector<MTPMessage> &messages);
 	void chatLoaded(const MTPmessages_ChatFull &res);
 
@@ -406,7 +409,8 @@ private:
 	History *_activeHist;
 	MTPinputPeer histInputPeer;
 	mtpRequestId histPreloading, histPreloadingDown;
-	QVector<MTPMessage> histPreload, histPreloadDown;
+	mtpBuffer histPreload; // serialized vector of messages, read by views when added to front
+	QVector<MTPMessage> histPreloadDown;
 
 	int32 _loadingAroundId;
 	mtpRequestId _loadingAroundRequest;
@@ -457,5 +461,8 @@ private:
 	QTimer _animActiveTimer;
 	float64 _animActiveStart;
 
+	QTimer _resizeCheckTimer;
+	QTimer _layoutCheckTimer;
+
 };
 
@@ -25,7 +25,50 @@ namespace {
 	int32 part = -1;
 	QChar zero('0');
 
-	QMutex debugLogMutex, mainLogMutex;
+	QMutex mainLogMutex;
+
+	static const int32 DebugLogFileSizeMax = 64 * 1024 * 1024; // bigger debug log files are moved to .old.txt and started again
+	static const int32 DebugLogFlushInterval = 100; // ms between the writer thread batches
+
+	enum DebugLogKind {
+		DebugLogMain,
+		DebugLogTcp,
+		DebugLogMtp,
+	};
+	struct DebugLogRecord {
+		DebugLogRecord(DebugLogKind kind = DebugLogMain, const QString &text = QString()) : kind(kind), text(text) {
+		}
+		DebugLogKind kind;
+		QString text;
+	};
+	mtpLockFreeQueue<DebugLogRecord> debugLogQueue; // pushed from any thread, popped by the writer thread only
+
+	void debugLogWriteQueued();
+
+	class _DebugLogWriter : public QThread {
+	public:
+		_DebugLogWriter() : _stopping(0) {
+		}
+		void stop() { // writes all the queued records before returning
+			_stopping.storeRelease(1);
+			wait();
+		}
+
+	protected:
+		void run() {
+			while (true) {
+				bool stopping = _stopping.loadAcquire();
+				debugLogWriteQueued();
+				if (stopping) break;
+
+				msleep(DebugLogFlushInterval);
+			}
+		}
+
+	private:
+		QAtomicInt _stopping;
+	};
+	QAtomicPointer<_DebugLogWriter> debugLogWriter; // checked from any thread before pushing a record
 
 	class _StreamCreator {
 	public:
@@ -35,7 +78,7 @@ namespace {
 	};
 
 	QString debugLogEntryStart() {
-		static uint32 logEntry = 0;
+		static QAtomicInt logEntry(0);
 
 		QDateTime tm(QDateTime::currentDateTime());
 
@@ -43,12 +86,121 @@ namespace {
 		MTPThread *mtpThread = dynamic_cast<MTPThread*>(thread);
 		uint32 threadId = mtpThread ? mtpThread->getThreadId() : 0;
 		
-		return QString("[%1 %2-%3]").arg(tm.toString("hh:mm:ss.zzz")).arg(QString("%1").arg(threadId, 2, 10, zero)).arg(++logEntry, 7, 10, zero);
+		return QString("[%1 %2-%3]").arg(tm.toString("hh:mm:ss.zzz")).arg(QString("%1").arg(threadId, 2, 10, zero)).arg(logEntry.fetchAndAddRelaxed(1) + 1, 7, 10, zero);
+	}
+
+	void debugLogOpen(QFile &file, QTextStream *&stream, const QString &name, int32 dayIndex, bool allowAppend = true) {
+		if (stream) {
+			delete stream;
+			stream = 0;
+			file.close();
+		}
+		file.setFileName(name);
+		QIODevice::OpenMode mode = QIODevice::WriteOnly | QIODevice::Text;
+		if (allowAppend && file.exists()) {
+			if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+				if (QString::fromUtf8(file.readLine()).toInt() == dayIndex) {
+					mode |= QIODevice::Append;
+				}
+				file.close();
+			}
+		}
+		if (!file.open(mode)) {
+			QDir dir(QDir::current());
+			dir.mkdir(cWorkingDir() + qsl("DebugLogs"));
+			file.open(mode);
+		}
+		if (file.isOpen()) {
+			stream = new QTextStream();
+			stream->setDevice(&file);
+			stream->setCodec("UTF-8");
+			(*stream) << ((mode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
+			stream->flush();
+		}
 	}
+
+	void debugLogSwitchPart() { // new files each 15 minutes, writer thread only after logsInitDebug()
+		time_t t = time(NULL);
+		struct tm tm;
+		mylocaltime(&tm, &t);
+
+		static const int switchEach = 15; // minutes
+		int32 newPart = (tm.tm_min + tm.tm_hour * 60) / switchEach;
+		if (newPart == part) return;
+
+		part = newPart;
+
+		int32 dayIndex = (tm.tm_year + 1900) * 10000 + (tm.tm_mon + 1) * 100 + tm.tm_mday;
+		QString logPostfix = QString("_%4_%5").arg((part * switchEach) / 60, 2, 10, zero).arg((part * switchEach) % 60, 2, 10, zero);
+
+		debugLogOpen(debugLog, debugLogStream, cWorkingDir() + qsl("DebugLogs/log") + logPostfix + qsl(".txt"), dayIndex);
+		debugLogOpen(tcpLog, tcpLogStream, cWorkingDir() + qsl("DebugLogs/tcp") + logPostfix + qsl(".txt"), dayIndex);
+		debugLogOpen(mtpLog, mtpLogStream, cWorkingDir() + qsl("DebugLogs/mtp") + logPostfix + qsl(".txt"), dayIndex);
+	}
+
+	void debugLogRotate(QFile &file, QTextStream *&stream) { // writer thread only
+		if (!stream || file.size() < DebugLogFileSizeMax) return;
+
+		QString name(file.fileName()), old(name.endsWith(qsl(".txt")) ? (name.mid(0, name.size() - 4) + qsl(".old.txt")) : (name + qsl(".old")));
+		int32 dayIndex = 0;
+
+		delete stream;
+		stream = 0;
+		file.close();
+
+		QFile head(name);
+		if (head.open(QIODevice::ReadOnly | QIODevice::Text)) {
+			dayIndex = QString::fromUtf8(head.readLine()).toInt();
+			head.close();
+		}
+		QFile::remove(old);
+		QFile::rename(name, old);
+		debugLogOpen(file, stream, name, dayIndex, false);
+	}
+
+	void debugLogWriteQueued() { // writer thread only
+		debugLogSwitchPart();
+
+		bool written[3] = { false, false, false };
+		DebugLogRecord record;
+		while (debugLogQueue.pop(record)) {
+			QTextStream *stream = (record.kind == DebugLogTcp) ? tcpLogStream : ((record.kind == DebugLogMtp) ? mtpLogStream : debugLogStream);
+			if (!stream) continue;
+
+			(*stream) << record.text;
+			written[record.kind] = true;
+
+			if (record.kind == DebugLogMain) {
+#ifdef Q_OS_WIN
+				OutputDebugString(reinterpret_cast<const wchar_t *>(record.text.utf16()));
+#elif defined Q_OS_MAC
+				objc_outputDebugString(record.text);
+#elif defined Q_OS_LINUX && defined _DEBUG
+				std::cout << record.text.toUtf8().constData();
+#endif
+			}
+		}
+		if (written[DebugLogMain]) {
+			debugLogStream->flush();
+			debugLogRotate(debugLog, debugLogStream);
+		}
+		if (written[DebugLogTcp]) {
+			tcpLogStream->flush();
+			debugLogRotate(tcpLog, tcpLogStream);
+		}
+		if (written[DebugLogMtp]) {
+			mtpLogStream->flush();
+			debugLogRotate(mtpLog, mtpLogStream);
+		}
+	}
+}
+
+bool debugLogEnabled() {
+	return cDebug() && debugLogWriter.loadAcquire();
 }
 
 void debugLogWrite(const char *file, int32 line, const QString &v) {
-	if (!cDebug() || !debugLogStream) return;
+	if (!debugLogEnabled()) return;
 
 	const char *last = strstr(file, "/"), *found = 0;
 	while (last) {
@@ -64,48 +216,19 @@ void debugLogWrite(const char *file, int32 line, const QString &v) {
 		file = found + 1;
 	}
 
-	{
-		QMutexLocker lock(&debugLogMutex);
-
-		logsInitDebug(); // maybe need to reopen new file
-
-		QString msg(QString("%1 %2 (%3 : %4)\n").arg(debugLogEntryStart()).arg(v).arg(file).arg(line));
-		(*debugLogStream) << msg;
-		debugLogStream->flush();
-#ifdef Q_OS_WIN
-		OutputDebugString(reinterpret_cast<const wchar_t *>(msg.utf16()));
-#elif defined Q_OS_MAC
-        objc_outputDebugString(msg);
-#elif defined Q_OS_LINUX && defined _DEBUG
-        std::cout << msg.toUtf8().constData();
-#endif
-	}
+	debugLogQueue.push(DebugLogRecord(DebugLogMain, QString("%1 %2 (%3 : %4)\n").arg(debugLogEntryStart()).arg(v).arg(file).arg(line)));
 }
 
 void tcpLogWrite(const QString &v) {
-	if (!cDebug() || !tcpLogStream) return;
+	if (!debugLogEnabled()) return;
 
-	{
-		QMutexLocker lock(&debugLogMutex);
-
-		logsInitDebug(); // maybe need to reopen new file
-
-		(*tcpLogStream) << QString("%1 %2\n").arg(debugLogEntryStart()).arg(v);
-		tcpLogStream->flush();
-	}
+	debugLogQueue.push(DebugLogRecord(DebugLogTcp, QString("%1 %2\n").arg(debugLogEntryStart()).arg(v)));
 }
 
 void mtpLogWrite(int32 dc, const QString &v) {
-	if (!cDebug() || !mtpLogStream) return;
-
-	{
-		QMutexLocker lock(&debugLogMutex);
+	if (!debugLogEnabled()) return;
 
-		logsInitDebug(); // maybe need to reopen new file
-
-		(*mtpLogStream) << QString("%1 (dc:%2) %3\n").arg(debugLogEntryStart()).arg(dc).arg(v);
-		mtpLogStream->flush();
-	}
+	debugLogQueue.push(DebugLogRecord(DebugLogMtp, QString("%1 (dc:%2) %3\n").arg(debugLogEntryStart()).arg(dc).arg(v)));
 }
 
 void logWrite(const QString &v) {
@@ -225,110 +348,35 @@ void logsInit() {
 }
 
 void logsInitDebug() {
-	time_t t = time(NULL);
-	struct tm tm;
-	mylocaltime(&tm, &t);
-
-	static const int switchEach = 15; // minutes
-	int32 newPart = (tm.tm_min + tm.tm_hour * 60) / switchEach;
-	if (newPart == part) return;
+	if (debugLogWriter.loadAcquire()) return;
 
-	part = newPart;
+	debugLogSwitchPart();
 
-	int32 dayIndex = (tm.tm_year + 1900) * 10000 + (tm.tm_mon + 1) * 100 + tm.tm_mday;
-	QString logPostfix = QString("_%4_%5").arg((part * switchEach) / 60, 2, 10, zero).arg((part * switchEach) % 60, 2, 10, zero);
+	_DebugLogWriter *writer = new _DebugLogWriter();
+	writer->start(QThread::LowPriority);
+	debugLogWriter.storeRelease(writer);
+}
 
+void logsClose() {
+	if (_DebugLogWriter *writer = debugLogWriter.fetchAndStoreOrdered(0)) { // MTP::stop() is called before, so connection threads do not log any more
+		writer->stop();
+		delete writer;
+	}
 	if (debugLogStream) {
 		delete debugLogStream;
 		debugLogStream = 0;
 		debugLog.close();
 	}
-	debugLog.setFileName(cWorkingDir() + qsl("DebugLogs/log") + logPostfix + qsl(".txt"));
-	QIODevice::OpenMode debugLogMode = QIODevice::WriteOnly | QIODevice::Text;
-	if (debugLog.exists()) {
-		if (debugLog.open(QIODevice::ReadOnly | QIODevice::Text)) {
-			if (QString::fromUtf8(debugLog.readLine()).toInt() == dayIndex) {
-				debugLogMode |= QIODevice::Append;
-			}
-			debugLog.close();
-		}
-	}
-	if (!debugLog.open(debugLogMode)) {
-		QDir dir(QDir::current());
-		dir.mkdir(cWorkingDir() + qsl("DebugLogs"));
-		debugLog.open(debugLogMode);
-	}
-	if (debugLog.isOpen()) {
-		debugLogStream = new QTextStream();
-		debugLogStream->setDevice(&debugLog);
-		debugLogStream->setCodec("UTF-8");
-		(*debugLogStream) << ((debugLogMode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
-		debugLogStream->flush();
-	}
 	if (tcpLogStream) {
 		delete tcpLogStream;
 		tcpLogStream = 0;
 		tcpLog.close();
 	}
-	tcpLog.setFileName(cWorkingDir() + qsl("DebugLogs/tcp") + logPostfix + qsl(".txt"));
-	QIODevice::OpenMode tcpLogMode = QIODevice::WriteOnly | QIODevice::Text;
-	if (tcpLog.exists()) {
-		if (tcpLog.open(QIODevice::ReadOnly | QIODevice::Text)) {
-			if (QString::fromUtf8(tcpLog.readLine()).toInt() == dayIndex) {
-				tcpLogMode |= QIODevice::Append;
-			}
-			tcpLog.close();
-		}
-	}
-	if (tcpLog.open(tcpLogMode)) {
-		tcpLogStream = new QTextStream();
-		tcpLogStream->setDevice(&tcpLog);
-		tcpLogStream->setCodec("UTF-8");
-		(*tcpLogStream) << ((tcpLogMode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
-		tcpLogStream->flush();
-	}
 	if (mtpLogStream) {
 		delete mtpLogStream;
 		mtpLogStream = 0;
 		mtpLog.close();
 	}
-	mtpLog.setFileName(cWorkingDir() + qsl("DebugLogs/mtp") + logPostfix + qsl(".txt"));
-	QIODevice::OpenMode mtpLogMode = QIODevice::WriteOnly | QIODevice::Text;
-	if (mtpLog.exists()) {
-		if (mtpLog.open(QIODevice::ReadOnly | QIODevice::Text)) {
-			if (QString::fromUtf8(mtpLog.readLine()).toInt() == dayIndex) {
-				mtpLogMode |= QIODevice::Append;
-			}
-			mtpLog.close();
-		}
-	}
-	if (mtpLog.open(mtpLogMode)) {
-		mtpLogStream = new QTextStream();
-		mtpLogStream->setDevice(&mtpLog);
-		mtpLogStream->setCodec("UTF-8");
-		(*mtpLogStream) << ((mtpLogMode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
-		mtpLogStream->flush();
-	}
-}
-
-void logsClose() {
-	if (cDebug()) {
-		if (debugLogStream) {
-			delete debugLogStream;
-			debugLogStream = 0;
-			debugLog.close();
-		}
-		if (tcpLogStream) {
-			delete tcpLogStream;
-			tcpLogStream = 0;
-			tcpLog.close();
-		}
-		if (mtpLogStream) {
-			delete mtpLogStream;
-			mtpLogStream = 0;
-			mtpLog.close();
-		}
-	}
 	if (mainLogStream) {
 		delete mainLogStream;
 		mainLogStream = 0;
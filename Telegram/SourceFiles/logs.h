@@ -27,16 +27,16 @@ struct DebugLogMemoryBuffer {
 	DebugLogMemoryBuffer(const void *ptr, uint32 size) : p(ptr), s(size) {
 	}
 	QString str() const {
-		QString result;
+		if (!s) return QString();
+
+		QString result(s * 3 - 1, QChar(' '));
 		const uchar *buf((const uchar*)p);
 		const char *hex = "0123456789ABCDEF";
-		result.reserve(s * 3);
-		for (uint32 i = 0; i < s; ++i) {
-			result += hex[(buf[i] >> 4)];
-			result += hex[buf[i] & 0x0F];
-			result += ' ';
+		QChar *to = result.data();
+		for (uint32 i = 0; i < s; ++i, to += 3) {
+			to[0] = QLatin1Char(hex[(buf[i] >> 4)]);
+			to[1] = QLatin1Char(hex[buf[i] & 0x0F]);
 		}
-		result.chop(1);
 		return result;
 	}
 
@@ -48,16 +48,18 @@ inline DebugLogMemoryBuffer mb(const void *ptr, uint32 size) {
 	return DebugLogMemoryBuffer(ptr, size);
 }
 
-void debugLogWrite(const char *file, int32 line, const QString &v);
-#define DEBUG_LOG(msg) (debugLogWrite(__FILE__, __LINE__, QString msg))
+bool debugLogEnabled(); // the message arguments are not evaluated at all when debug logs are off
+
+void debugLogWrite(const char *file, int32 line, const QString &v); // queued, written by the log writer thread
+#define DEBUG_LOG(msg) (debugLogEnabled() ? debugLogWrite(__FILE__, __LINE__, QString msg) : void(0))
 //usage DEBUG_LOG(("log: %1 %2").arg(1).arg(2))
 
 void tcpLogWrite(const QString &v);
-#define TCP_LOG(msg) (tcpLogWrite(QString msg))
+#define TCP_LOG(msg) (debugLogEnabled() ? tcpLogWrite(QString msg) : void(0))
 //usage TCP_LOG(("log: %1 %2").arg(1).arg(2))
 
 void mtpLogWrite(int32 dc, const QString &v);
-#define MTP_LOG(dc, msg) (mtpLogWrite(dc, QString msg))
+#define MTP_LOG(dc, msg) (debugLogEnabled() ? mtpLogWrite(dc, QString msg) : void(0))
 //usage MTP_LOG(dc, ("log: %1 %2").arg(1).arg(2))
 
 #else
@@ -275,7 +275,8 @@ MainWidget *TopBarWidget::main() {
 
 MainWidget::MainWidget(Window *window) : QWidget(window), failedObjId(0), _dialogsWidth(st::dlgMinWidth),
 dialogs(this), history(this), profile(0), overview(0), _topBar(this), hider(0), _mediaType(this), _mediaTypeMask(0),
-	updPts(0), updDate(0), updQts(0), updSeq(0), updInited(false), onlineRequest(0) {
+	updPts(0), updDate(0), updQts(0), updSeq(0), updInited(false),
+	_diffStateWaiting(false), _diffStateFull(false), _diffRequestWaiting(false), onlineRequest(0) {
 	setGeometry(QRect(0, st::titleHeight, App::wnd()->width(), App::wnd()->height() - st::titleHeight));
 
 	connect(window, SIGNAL(resized(const QSize &)), this, SLOT(onParentResize(const QSize &)));
@@ -284,6 +285,8 @@ dialogs(this), history(this), profile(0), overview(0), _topBar(this), hider(0),
 	connect(&history, SIGNAL(cancelled()), &dialogs, SLOT(activate()));
 	connect(this, SIGNAL(peerPhotoChanged(PeerData *)), this, SIGNAL(dialogsUpdated()));
 	connect(&noUpdatesTimer, SIGNAL(timeout()), this, SLOT(getDifference()));
+	_diffSliceTimer.setSingleShot(true);
+	connect(&_diffSliceTimer, SIGNAL(timeout()), this, SLOT(onDifferenceSlice()));
 	connect(&onlineTimer, SIGNAL(timeout()), this, SLOT(setOnline()));
 	connect(&onlineUpdater, SIGNAL(timeout()), this, SLOT(updateOnlineDisplay()));
 	connect(this, SIGNAL(peerUpdated(PeerData*)), &history, SLOT(peerUpdated(PeerData*)));
@@ -1422,6 +1425,10 @@ void MainWidget::newUnreadMsg(History *hist, MsgId msgId) {
 	history.newUnreadMsg(hist, msgId);
 }
 
+void MainWidget::newUnreadMsgs(History *hist, const QVector<MsgId> &msgIds) {
+	history.newUnreadMsgs(hist, msgIds);
+}
+
 void MainWidget::historyWasRead() {
 	history.historyWasRead(false);
 }
@@ -1635,11 +1642,7 @@ void MainWidget::gotDifference(const MTPupdates_Difference &diff) {
 	switch (diff.type()) {
 	case mtpc_updates_differenceEmpty: {
 		const MTPDupdates_differenceEmpty &d(diff.c_updates_differenceEmpty());
-		updSetState(updPts, d.vdate.v, updQts, d.vseq.v);
-
-		MTP::setGlobalDoneHandler(rpcDone(&MainWidget::updateReceived));
-		noUpdatesTimer.start(NoUpdatesTimeout);
-		updInited = true;
+		feedDifferenceState(MTP_updates_state(MTP_int(updPts), MTP_int(updQts), d.vdate, d.vseq, MTP_int(0)), false);
 	} break;
 	case mtpc_updates_differenceSlice: {
 		const MTPDupdates_differenceSlice &d(diff.c_updates_differenceSlice());
@@ -1648,15 +1651,18 @@ void MainWidget::gotDifference(const MTPupdates_Difference &diff) {
 		const MTPDupdates_state &s(d.vintermediate_state.c_updates_state());
 		updSetState(s.vpts.v, s.vdate.v, s.vqts.v, s.vseq.v);
 
-		updInited = true;
-
-		getDifference();
+		if (_diffParts.size() < DifferencePartsMax) { // request the next slice while this one is being applied
+			updInited = true;
+			getDifference();
+		} else {
+			_diffRequestWaiting = true;
+		}
 	} break;
 	case mtpc_updates_difference: {
 		const MTPDupdates_difference &d(diff.c_updates_difference());
 		feedDifference(d.vusers, d.vchats, d.vnew_messages, d.vother_updates);
 
-		gotState(d.vstate);
+		feedDifferenceState(d.vstate, true);
 	} break;
 	};
 }
@@ -1671,9 +1677,64 @@ void MainWidget::feedDifference(const MTPVector<MTPUser> &users, const MTPVector
 	App::feedUsers(users);
 	App::feedChats(chats);
 	feedMessageIds(other);
-	App::feedMsgs(msgs, true);
-	feedUpdates(other, true);
+
+	DifferencePart part;
+	App::sortMsgs(msgs, part.msgs);
+	part.other = other.c_vector().v;
+	if (part.msgs.isEmpty() && part.other.isEmpty()) return;
+
+	_diffParts.push_back(part);
+	if (!_diffSliceTimer.isActive()) _diffSliceTimer.start(0);
+}
+
+void MainWidget::feedDifferenceState(const MTPupdates_State &state, bool full) {
+	if (!_diffParts.isEmpty()) { // live updates must not be applied before the older difference messages
+		_diffState = state;
+		_diffStateFull = full;
+		_diffStateWaiting = true;
+		return;
+	}
+
+	if (full) return gotState(state);
+
+	const MTPDupdates_state &d(state.c_updates_state());
+	updSetState(d.vpts.v, d.vdate.v, d.vqts.v, d.vseq.v);
+
+	MTP::setGlobalDoneHandler(rpcDone(&MainWidget::updateReceived));
+	noUpdatesTimer.start(NoUpdatesTimeout);
+	updInited = true;
+}
+
+void MainWidget::onDifferenceSlice() {
+	if (_diffParts.isEmpty()) return;
+
+	DifferencePart &part(_diffParts.front());
+	if (part.msgsFed < part.msgs.size()) {
+		int32 count = qMin(int32(DifferenceSliceMessages), part.msgs.size() - part.msgsFed);
+		App::feedMsgs(MTP_vector<MTPMessage>(part.msgs.mid(part.msgsFed, count)), true);
+		part.msgsFed += count;
+	} else {
+		int32 count = qMin(int32(DifferenceSliceUpdates), part.other.size() - part.otherFed);
+		feedUpdates(MTP_vector<MTPUpdate>(part.other.mid(part.otherFed, count)), true);
+		part.otherFed += count;
+	}
 	history.peerMessagesUpdated();
+
+	if (part.msgsFed >= part.msgs.size() && part.otherFed >= part.other.size()) {
+		_diffParts.pop_front();
+		if (_diffRequestWaiting && _diffParts.size() < DifferencePartsMax) {
+			_diffRequestWaiting = false;
+			updInited = true;
+			getDifference();
+		}
+	}
+
+	if (!_diffParts.isEmpty()) {
+		_diffSliceTimer.start(0);
+	} else if (_diffStateWaiting) {
+		_diffStateWaiting = false;
+		feedDifferenceState(_diffState, _diffStateFull);
+	}
 }
 
 bool MainWidget::failDifference(const RPCError &e) {
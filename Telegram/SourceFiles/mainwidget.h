@@ -198,6 +198,7 @@ public:
 	void dialogsToUp();
 	void dialogsClear(); // after showing peer history
 	void newUnreadMsg(History *history, MsgId msgId);
+	void newUnreadMsgs(History *history, const QVector<MsgId> &msgIds);
 	void updUpdated(int32 pts, int32 date, int32 qts, int32 seq);
 	void historyWasRead();
 
@@ -323,6 +324,8 @@ public slots:
 
 	void onUpdateNotifySettings();
 
+	void onDifferenceSlice();
+
 	void onPhotosSelect();
 	void onVideosSelect();
 	void onDocumentsSelect();
@@ -340,6 +343,7 @@ private:
 	void gotDifference(const MTPupdates_Difference &diff);
 	bool failDifference(const RPCError &e);
 	void feedDifference(const MTPVector<MTPUser> &users, const MTPVector<MTPChat> &chats, const MTPVector<MTPMessage> &msgs, const MTPVector<MTPUpdate> &other);
+	void feedDifferenceState(const MTPupdates_State &state, bool full);
 	void gotState(const MTPupdates_State &state);
 	void updSetState(int32 pts, int32 date, int32 qts, int32 seq);
 
@@ -379,6 +383,19 @@ private:
 	bool updInited;
 	QTimer noUpdatesTimer;
 
+	struct DifferencePart {
+		DifferencePart() : msgsFed(0), otherFed(0) {
+		}
+		QVector<MTPMessage> msgs; // sorted by id
+		QVector<MTPUpdate> other;
+		int32 msgsFed, otherFed;
+	};
+	typedef QList<DifferencePart> DifferenceParts;
+	DifferenceParts _diffParts; // received difference, added to histories by bounded slices
+	QTimer _diffSliceTimer;
+	MTPupdates_State _diffState; // applied when all the parts are fed
+	bool _diffStateWaiting, _diffStateFull, _diffRequestWaiting;
+
 	mtpRequestId onlineRequest;
 	QTimer onlineTimer;
 	QTimer onlineUpdater;
@@ -35,6 +35,9 @@ inlineMethods = '';
 textSerialize = '';
 forwards = '';
 forwTypedefs = '';
+viewForwards = '';
+viewsText = '';
+viewInlineMethods = '';
 out = open('mtpScheme.h', 'w')
 out.write('/*\n');
 out.write('Created from \'/SourceFiles/mtproto/scheme.tl\' by \'/SourceFiles/mtproto/generate.py\' script\n\n');
@@ -571,6 +574,106 @@ for restype in typesList:
   inlineMethods += creatorsText;
   typesText += 'typedef MTPBoxed<MTP' + restype + '> MTP' + resType + ';\n'; # boxed type definition
 
+# lazy views: type of the view, that reads a field of the given type
+def viewType(ptype):
+  vtypeget = re.match(r'^([Vv])ector<MTP([A-Za-z0-9_]+)>$', ptype);
+  if (vtypeget):
+    result = 'MTPvectorView<' + viewType(vtypeget.group(2)) + ' >';
+    if (vtypeget.group(1) == 'V'):
+      result = 'MTPBoxedView<' + result + ' >';
+    return result;
+  if (ptype in ['int', 'long', 'int128', 'int256', 'double', 'string', 'bytes', 'bool']):
+    return 'MTP' + ptype;
+  if (ptype in ['Int', 'Long', 'Int128', 'Int256', 'Double', 'String', 'Bytes', 'Bool']):
+    return 'MTPBoxedView<MTP' + ptype[0:1].lower() + ptype[1:] + '>';
+  if (re.match(r'^[A-Z]', ptype) or ptype.find('_') >= 0 and re.match(r'^[a-z]+_[A-Z]', ptype)):
+    return 'MTPBoxedView<MTP' + boxed[ptype] + 'View>';
+  return 'MTP' + ptype + 'View';
+
+for restype in typesList:
+  v = typesDict[restype];
+  withType = (len(v) > 1);
+
+  viewForwards += 'class MTP' + restype + 'View;\n';
+
+  getters = '';
+  skipText = '';
+  for data in v:
+    name = data[0];
+    prmsList = data[2];
+    prms = data[3];
+
+    skipLines = '';
+    for paramName in prmsList:
+      skipLines += ('\t\t\t' if withType else '\t') + viewType(prms[paramName]) + '::skip(from, end);\n';
+    if (withType):
+      skipText += '\t\tcase mtpc_' + name + ':' + ('\n' + skipLines + '\t\t' if skipLines else ' ') + 'break;\n';
+    else:
+      skipText += skipLines;
+
+    if (not len(prms)):
+      continue;
+
+    viewForwards += 'class MTPD' + name + 'View;\n';
+
+    viewsText += '\nclass MTPD' + name + 'View {\n'; # data view class
+    viewsText += 'public:\n';
+    viewsText += '\tMTPD' + name + 'View(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTP' + restype + 'View\n\t}\n\n';
+    skipPrev = '';
+    for paramName in prmsList:
+      paramView = viewType(prms[paramName]);
+      viewsText += '\t' + paramView + ' v' + paramName + '() const;\n';
+      viewInlineMethods += '\ninline ' + paramView + ' MTPD' + name + 'View::v' + paramName + '() const {\n';
+      viewInlineMethods += '\tconst mtpPrime *from = _from, *end = _end;\n';
+      viewInlineMethods += skipPrev;
+      viewInlineMethods += '\treturn ' + paramView + '(from, end);\n';
+      viewInlineMethods += '}\n';
+      skipPrev += '\t' + paramView + '::skip(from, end);\n';
+    viewsText += '\nprivate:\n';
+    viewsText += '\tconst mtpPrime *_from, *_end;\n';
+    viewsText += '};\n';
+
+    getters += '\tMTPD' + name + 'View c_' + name + '() const;\n';
+    viewInlineMethods += '\ninline MTPD' + name + 'View MTP' + restype + 'View::c_' + name + '() const {\n';
+    if (withType):
+      viewInlineMethods += '\tif (_type != mtpc_' + name + ') throw mtpErrorWrongTypeId(_type, mtpc_' + name + ');\n';
+    viewInlineMethods += '\treturn MTPD' + name + 'View(_from, _end);\n';
+    viewInlineMethods += '}\n';
+
+  consDefault = '' if withType else (' = mtpc_' + v[0][0]);
+
+  viewsText += '\nclass MTP' + restype + 'View { // fields of MTP' + restype + ' are read on access\n'; # type view class
+  viewsText += 'public:\n';
+  viewsText += '\tMTP' + restype + 'View(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons' + consDefault + ') : _from(from), _type(cons) {\n';
+  viewsText += '\t\tskip(from, end, cons);\n';
+  viewsText += '\t\t_end = from;\n';
+  viewsText += '\t}\n\n';
+  if (getters):
+    viewsText += getters + '\n';
+  viewsText += '\tmtpTypeId type() const {\n\t\treturn _type;\n\t}\n';
+  viewsText += '\tMTP' + restype + ' read() const; // materializes the value, for the consumers that need it whole\n';
+  viewsText += '\tstatic void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons' + consDefault + ');\n';
+  viewsText += '\nprivate:\n';
+  viewsText += '\tconst mtpPrime *_from, *_end;\n';
+  viewsText += '\tmtpTypeId _type;\n';
+  viewsText += '};\n';
+
+  viewInlineMethods += '\ninline MTP' + restype + ' MTP' + restype + 'View::read() const {\n';
+  viewInlineMethods += '\tconst mtpPrime *from = _from;\n';
+  viewInlineMethods += '\treturn MTP' + restype + '(from, _end, _type);\n';
+  viewInlineMethods += '}\n';
+
+  viewInlineMethods += '\ninline void MTP' + restype + 'View::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {\n';
+  if (withType):
+    viewInlineMethods += '\tswitch (cons) {\n';
+    viewInlineMethods += skipText;
+    viewInlineMethods += '\t\tdefault: throw mtpErrorUnexpected(cons, "MTP' + restype + 'View");\n';
+    viewInlineMethods += '\t}\n';
+  else:
+    viewInlineMethods += '\tif (cons != mtpc_' + v[0][0] + ') throw mtpErrorUnexpected(cons, "MTP' + restype + 'View");\n';
+    viewInlineMethods += skipText;
+  viewInlineMethods += '}\n';
+
 textSerializeFull = '\ninline QString mtpTextSerialize(const mtpPrime *&from, const mtpPrime *end, mtpPrime cons, uint32 level, mtpPrime vcons) {\n';
 textSerializeFull += '\tQString add = QString(" ").repeated(level * 2);\n\n';
 textSerializeFull += '\tconst mtpPrime *start = from;\n';
@@ -601,6 +704,9 @@ out.write('\n// Type classes definitions\n' + typesText);
 out.write('\n// Type constructors with data\n' + dataTexts);
 out.write('\n// RPC methods\n' + funcsText);
 out.write('\n// Inline methods definition\n' + inlineMethods);
+out.write('\n// Lazy views forward declarations\n' + viewForwards);
+out.write('\n// Lazy views of types, fields are read on access\n' + viewsText);
+out.write('\n// Lazy views inline methods definition\n' + viewInlineMethods);
 out.write('\n// Human-readable text serialization\n#if (defined _DEBUG || defined _WITH_DEBUG)\n' + textSerializeFull + '\n#endif\n');
 
 print('Done, written {0} constructors, {1} functions.'.format(consts, funcs));
@@ -40,6 +40,10 @@ namespace {
 	typedef QMap<mtpRequestId, mtpRequest> RequestMap;
 	RequestMap requestMap;
 
+	typedef QMap<mtpRequestId, RPCResponseParser> ResponseParsers; // used from connection threads
+	ResponseParsers responseParsers;
+	QMutex responseParsersLock;
+
 	typedef QPair<mtpRequestId, uint64> DelayedRequest;
 	typedef QList<DelayedRequest> DelayedRequestsList;
 	DelayedRequestsList delayedRequests;
@@ -54,6 +58,53 @@ namespace {
 	QMutex toClearLock;
 	RPCCallbackClears toClear;
 
+	typedef QMap<int32, MTProtoConnection::TcpProtocol> TcpProtocols; // used from connection threads
+	TcpProtocols tcpProtocols;
+	QMutex tcpProtocolsLock;
+
+	MTP::StatsByDc statsByDc; // updated from connection and session threads
+	QMutex statsLock;
+	bool statsDumpEnabled = false, statsDumpScheduled = false;
+
+	MTP::Stats &statsFor(int32 dc, mtpTypeId method, MTP::Stats *&total) { // statsLock must be locked
+		MTP::DcStats &dcStats(statsByDc[dc]);
+		total = &dcStats.total;
+		return dcStats.methods[method];
+	}
+
+	QJsonObject statsHistogramJson(const MTP::StatsHistogram &histogram) {
+		QJsonObject result;
+		result.insert(qsl("count"), double(histogram.count));
+		result.insert(qsl("sum"), double(histogram.sum));
+		result.insert(qsl("max"), double(histogram.max));
+		result.insert(qsl("p50"), double(histogram.percentile(0.5)));
+		result.insert(qsl("p90"), double(histogram.percentile(0.9)));
+		result.insert(qsl("p99"), double(histogram.percentile(0.99)));
+
+		int32 used = MTP::StatsHistogram::BucketsCount;
+		while (used > 0 && !histogram.buckets[used - 1]) --used;
+
+		QJsonArray buckets;
+		for (int32 i = 0; i < used; ++i) {
+			buckets.append(double(histogram.buckets[i]));
+		}
+		result.insert(qsl("buckets"), buckets);
+		return result;
+	}
+
+	QJsonObject statsJson(const MTP::Stats &stats) {
+		QJsonObject result;
+		result.insert(qsl("sent"), double(stats.sent));
+		result.insert(qsl("resent"), double(stats.resent));
+		result.insert(qsl("bytes_out"), double(stats.bytesOut));
+		result.insert(qsl("bytes_in"), double(stats.bytesIn));
+		result.insert(qsl("queue_us"), statsHistogramJson(stats.queueTime));
+		result.insert(qsl("rtt_us"), statsHistogramJson(stats.rtt));
+		result.insert(qsl("dispatch_us"), statsHistogramJson(stats.dispatchTime));
+		result.insert(qsl("callback_us"), statsHistogramJson(stats.callbackTime));
+		return result;
+	}
+
 	RPCResponseHandler globalHandler;
 	MTPStateChangedHandler stateChangedHandler = 0;
 	MTPSessionResetHandler sessionResetHandler = 0;
@@ -132,6 +183,40 @@ namespace {
 		return true;
 	}
 
+	typedef QList<int32> DcAuthToPrepare;
+	DcAuthToPrepare dcAuthToPrepare;
+	int32 dcAuthPreparingId = 0; // read from connection threads
+	QMutex dcAuthPreparingLock;
+	mtpRequestId dcAuthPreparingRequest = 0; // export or import request in flight
+	uint64 dcAuthPreparingTill = 0; // getms() when the preparing of the current dc is given up
+
+	void prepareDcAuthNext() {
+		{
+			QMutexLocker locker(&dcAuthPreparingLock);
+			dcAuthPreparingId = 0;
+		}
+		dcAuthPreparingRequest = 0;
+		if (resender) {
+			QTimer::singleShot(MTPPrepareDcAuthInterval, resender, SLOT(prepareDcAuth()));
+		}
+	}
+
+	void prepareImportDone(const MTPauth_Authorization &result) {
+		DEBUG_LOG(("MTP Info: auth prepared for dc %1").arg(MTP::dcAuthPreparing()));
+		prepareDcAuthNext();
+	}
+
+	bool prepareFail(const RPCError &error) {
+		LOG(("MTP Error: could not prepare auth for dc %1, error: %2").arg(MTP::dcAuthPreparing()).arg(error.type()));
+		prepareDcAuthNext();
+		return true;
+	}
+
+	void prepareExportDone(const MTPauth_ExportedAuthorization &result) {
+		const MTPDauth_exportedAuthorization &data(result.c_auth_exportedAuthorization());
+		dcAuthPreparingRequest = MTP::send(MTPauth_ImportAuthorization(data.vid, data.vbytes), rpcDone(prepareImportDone), rpcFail(prepareFail), MTP::dld + MTP::dcAuthPreparing());
+	}
+
 	bool onErrorDefault(mtpRequestId requestId, const RPCError &error) {
 		const QString &err(error.type());
 		bool badGuestDC = (error.code() == 400) && (err == qsl("FILE_ID_INVALID"));
@@ -285,10 +370,25 @@ namespace _mtp_internal {
 		if (parser.onDone || parser.onFail) {
 			parserMap.insert(res, parser);
 			requestMap.insert(res, request);
+			if (parser.onDone && parser.onDone->parser()) {
+				QMutexLocker locker(&responseParsersLock);
+				responseParsers.insert(res, parser.onDone->parser());
+			}
 		}
 		return res;
 	}
 
+	RPCResponseParser responseParser(mtpRequestId requestId) {
+		QMutexLocker locker(&responseParsersLock);
+		ResponseParsers::const_iterator i = responseParsers.constFind(requestId);
+		return (i == responseParsers.cend()) ? 0 : i.value();
+	}
+
+	void removeResponseParser(mtpRequestId requestId) {
+		QMutexLocker locker(&responseParsersLock);
+		responseParsers.remove(requestId);
+	}
+
 	void replaceRequest(mtpRequest &newRequest, const mtpRequest &oldRequest) {
 		newRequest->requestId = oldRequest->requestId;
 		RequestMap::iterator i = requestMap.find(oldRequest->requestId);
@@ -306,6 +406,7 @@ namespace _mtp_internal {
 			parserMap.erase(i);
 		}
 		requestMap.remove(requestId);
+		removeResponseParser(requestId);
 		_mtp_internal::unregisterRequest(requestId);
 	}
 
@@ -346,7 +447,7 @@ namespace _mtp_internal {
 		}
 	}
 
-	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) {
+	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end, const RPCParsedResponsePtr &parsed) {
 		ParserMap::iterator i = parserMap.find(requestId);
 		if (i != parserMap.cend()) {
 			RPCResponseHandler h(i.value());
@@ -363,8 +464,12 @@ namespace _mtp_internal {
 						parserMap.insert(requestId, h);
 						return;
 					}
-				} else {
-					if (h.onDone) (*h.onDone)(requestId, from, end);
+				} else if (h.onDone) {
+					if (parsed) {
+						(*h.onDone)(requestId, *parsed);
+					} else {
+						(*h.onDone)(requestId, from, end);
+					}
 				}
 			} catch (Exception &e) {
 				if (!rpcErrorOccured(requestId, h, rpcClientError("RESPONSE_PARSE_FAILED", QString("exception text: ") + e.what()))) {
@@ -373,12 +478,57 @@ namespace _mtp_internal {
 				}
 			}
 			requestMap.remove(requestId);
+			removeResponseParser(requestId);
 		} else {
 			DEBUG_LOG(("RPC Info: parser not found for %1").arg(requestId));
 		}
 		unregisterRequest(requestId);
 	}
 
+	void statsSent(int32 dc, mtpTypeId method, uint32 bytes, uint64 usQueued) {
+		QMutexLocker lock(&statsLock);
+		MTP::Stats *total = 0;
+		MTP::Stats &stats(statsFor(dc, method, total));
+		++stats.sent;
+		++total->sent;
+		stats.bytesOut += bytes;
+		total->bytesOut += bytes;
+		stats.queueTime.add(usQueued);
+		total->queueTime.add(usQueued);
+	}
+
+	void statsResent(int32 dc, mtpTypeId method) {
+		QMutexLocker lock(&statsLock);
+		MTP::Stats *total = 0;
+		MTP::Stats &stats(statsFor(dc, method, total));
+		++stats.resent;
+		++total->resent;
+	}
+
+	void statsReceived(int32 dc, mtpTypeId method, uint32 bytes, uint64 usRtt, uint64 usDispatch, uint64 usCallback) {
+		QMutexLocker lock(&statsLock);
+		MTP::Stats *total = 0;
+		MTP::Stats &stats(statsFor(dc, method, total));
+		stats.bytesIn += bytes;
+		total->bytesIn += bytes;
+		if (usRtt) {
+			stats.rtt.add(usRtt);
+			total->rtt.add(usRtt);
+		}
+		stats.dispatchTime.add(usDispatch);
+		total->dispatchTime.add(usDispatch);
+		stats.callbackTime.add(usCallback);
+		total->callbackTime.add(usCallback);
+	}
+
+	mtpTypeId requestStatsInfo(mtpRequestId requestId, uint64 &usSent) {
+		RequestMap::const_iterator i = requestMap.constFind(requestId);
+		if (i == requestMap.cend()) return 0;
+
+		usSent = i.value()->usSent;
+		return mtpRequestData::methodType(i.value());
+	}
+
 	void globalCallback(const mtpPrime *from, const mtpPrime *end) {
 		if (globalHandler.onDone) (*globalHandler.onDone)(0, from, end); // some updates were received
 	}
@@ -430,6 +580,74 @@ namespace _mtp_internal {
 			QTimer::singleShot(delayedRequests.front().second - now, this, SLOT(checkDelayed()));
 		}
 	}
+
+	void RequestResender::dumpStats() {
+		statsDumpScheduled = false;
+		if (!statsDumpEnabled) return;
+
+		MTP::StatsByDc stats(MTP::stats());
+		QJsonArray dcs;
+		for (MTP::StatsByDc::const_iterator i = stats.cbegin(), e = stats.cend(); i != e; ++i) {
+			QJsonArray methods;
+			for (MTP::MethodStats::const_iterator j = i.value().methods.cbegin(), end = i.value().methods.cend(); j != end; ++j) {
+				QJsonObject method(statsJson(j.value()));
+				method.insert(qsl("method"), QString("0x%1").arg(j.key(), 8, 16, QChar('0')));
+				methods.append(method);
+			}
+			QJsonObject dc;
+			dc.insert(qsl("dc"), i.key());
+			dc.insert(qsl("total"), statsJson(i.value().total));
+			dc.insert(qsl("methods"), methods);
+			dcs.append(dc);
+		}
+		QJsonObject root;
+		root.insert(qsl("time"), unixtime());
+		root.insert(qsl("dcs"), dcs);
+
+		QSaveFile file(cWorkingDir() + qsl("mtp_stats.json"));
+		if (file.open(QIODevice::WriteOnly)) {
+			file.write(QJsonDocument(root).toJson());
+			if (!file.commit()) {
+				LOG(("MTP Error: could not write stats dump"));
+			}
+		} else {
+			LOG(("MTP Error: could not open stats dump for writing"));
+		}
+
+		statsDumpScheduled = true;
+		QTimer::singleShot(MTPStatsDumpInterval, this, SLOT(dumpStats()));
+	}
+
+	void RequestResender::prepareDcAuth() {
+		if (!started || !cPrepareDcAuth() || !MTP::authedId() || MTP::dcAuthPreparing()) return;
+
+		const MTProtoDCMap &dcs(mtpDCMap());
+		while (!dcAuthToPrepare.isEmpty()) {
+			int32 dc = dcAuthToPrepare.front();
+			dcAuthToPrepare.pop_front();
+
+			MTProtoDCMap::const_iterator i = dcs.constFind(dc);
+			if (dc == mtpMainDC() || (i != dcs.cend() && i.value()->getKey())) continue; // authorization is imported right after the key is created
+
+			DEBUG_LOG(("MTP Info: preparing auth for dc %1 in background").arg(dc));
+			{
+				QMutexLocker locker(&dcAuthPreparingLock);
+				dcAuthPreparingId = dc;
+			}
+			dcAuthPreparingRequest = MTP::send(MTPauth_ExportAuthorization(MTP_int(dc)), rpcDone(prepareExportDone), rpcFail(prepareFail));
+			dcAuthPreparingTill = getms() + MTPPrepareDcAuthTimeout;
+			QTimer::singleShot(MTPPrepareDcAuthTimeout, this, SLOT(prepareDcAuthCheck()));
+			return;
+		}
+	}
+
+	void RequestResender::prepareDcAuthCheck() {
+		if (!MTP::dcAuthPreparing() || getms() < dcAuthPreparingTill) return; // timer of an already finished dc
+
+		LOG(("MTP Error: could not prepare auth for dc %1 in %2 ms, skipping it").arg(MTP::dcAuthPreparing()).arg(MTPPrepareDcAuthTimeout));
+		if (dcAuthPreparingRequest) MTP::cancel(dcAuthPreparingRequest);
+		prepareDcAuthNext();
+	}
 };
 
 namespace MTP {
@@ -546,6 +764,22 @@ namespace MTP {
 		return QString();
 	}
 
+	void setTcpProtocol(int32 dc, MTProtoConnection::TcpProtocol protocol) {
+		QMutexLocker lock(&tcpProtocolsLock);
+		tcpProtocols.insert(dc, protocol);
+	}
+
+	MTProtoConnection::TcpProtocol tcpProtocol(int32 dc) {
+		{
+			QMutexLocker lock(&tcpProtocolsLock);
+			TcpProtocols::const_iterator i = tcpProtocols.constFind(dc);
+			if (i != tcpProtocols.cend()) return i.value();
+		}
+
+		int32 type = dc / _mtp_internal::dcShift; // file parts are big, so their crc32 and sequence numbers are just overhead
+		return (type == 1 || type == 2 || type > 3) ? MTProtoConnection::TcpAbridged : MTProtoConnection::TcpFull;
+	}
+
 	void initdc(int32 dc) {
 		if (!started) return;
 		_mtp_internal::getSession(dc);
@@ -586,6 +820,15 @@ namespace MTP {
 		for (Sessions::iterator i = sessions.begin(), e = sessions.end(); i != e; ++i) {
 			i.value()->stop();
 		}
+		QList<QThread*> threads(QApplication::instance()->findChildren<QThread*>()); // connection threads, they log and use mtp data till they finish
+		for (int32 i = 0, l = threads.size(); i < l; ++i) {
+			if (dynamic_cast<MTPThread*>(threads.at(i))) {
+				threads.at(i)->wait();
+			}
+		}
+		if (started) {
+			mtpWriteAuthKeys(); // with the session states, so that the next launch does not start with bad_server_salt
+		}
 		delete resender;
 		resender = 0;
 		mtpDestroyConfigLoader();
@@ -593,6 +836,7 @@ namespace MTP {
 
 	void authed(int32 uid) {
 		mtpAuthed(uid);
+		if (uid) prepareDcAuth();
 	}
 
 	int32 authedId() {
@@ -604,6 +848,26 @@ namespace MTP {
 		mtpLogoutOtherDCs();
 	}
 
+	void prepareDcAuth() {
+		if (!started || !cPrepareDcAuth() || !authedId()) return;
+
+		dcAuthToPrepare.clear();
+		const mtpDcOptions &options(mtpDCOptions());
+		for (mtpDcOptions::const_iterator i = options.cbegin(), e = options.cend(); i != e; ++i) {
+			if (!dcAuthToPrepare.contains(i.key())) {
+				dcAuthToPrepare.push_back(i.key());
+			}
+		}
+		if (resender && !dcAuthPreparing()) {
+			QTimer::singleShot(MTPPrepareDcAuthDelay, resender, SLOT(prepareDcAuth()));
+		}
+	}
+
+	int32 dcAuthPreparing() {
+		QMutexLocker locker(&dcAuthPreparingLock);
+		return dcAuthPreparingId;
+	}
+
 	void setGlobalDoneHandler(RPCDoneHandlerPtr handler) {
 		globalHandler.onDone = handler;
 	}
@@ -640,4 +904,56 @@ namespace MTP {
 		return mtpReadConfigElem(blockId, stream);
 	}
 
+	StatsHistogram::StatsHistogram() : count(0), sum(0), max(0) {
+		memset(buckets, 0, sizeof(buckets));
+	}
+
+	void StatsHistogram::add(uint64 value) {
+		int32 bucket = 0;
+		for (uint64 v = value >> 1; v && bucket + 1 < BucketsCount; v >>= 1) {
+			++bucket;
+		}
+		++buckets[bucket];
+		++count;
+		sum += value;
+		if (value > max) max = value;
+	}
+
+	uint64 StatsHistogram::percentile(float64 part) const {
+		if (!count) return 0;
+
+		uint64 need = qMax(uint64(ceil(part * count)), uint64(1)), have = 0;
+		for (int32 i = 0; i < BucketsCount; ++i) {
+			have += buckets[i];
+			if (have >= need) {
+				return qMin((uint64(1) << (i + 1)) - 1, max);
+			}
+		}
+		return max;
+	}
+
+	Stats::Stats() : sent(0), resent(0), bytesOut(0), bytesIn(0) {
+	}
+
+	StatsByDc stats() {
+		QMutexLocker lock(&statsLock);
+		return statsByDc;
+	}
+
+	void resetStats() {
+		QMutexLocker lock(&statsLock);
+		statsByDc.clear();
+	}
+
+	void dumpStats(bool enabled) {
+		statsDumpEnabled = enabled;
+		if (enabled && !statsDumpScheduled && resender) {
+			resender->dumpStats();
+		}
+	}
+
+	bool dumpingStats() {
+		return statsDumpEnabled;
+	}
+
 };
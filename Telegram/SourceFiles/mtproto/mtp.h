@@ -31,11 +31,13 @@ namespace _mtp_internal {
 	static const uint32 dcShift = 10000;
 
 	mtpRequestId storeRequest(mtpRequest &request, const RPCResponseHandler &parser);
+	RPCResponseParser responseParser(mtpRequestId requestId); // thread safe, 0 if the response should be parsed in the callback
+	void removeResponseParser(mtpRequestId requestId);
 	void replaceRequest(mtpRequest &newRequest, const mtpRequest &oldRequest);
 	void clearCallbacks(mtpRequestId requestId, int32 errorCode = RPCError::NoError); // 0 - do not toggle onError callback
 	void clearCallbacksDelayed(const RPCCallbackClears &requestIds);
 	void performDelayedClear();
-	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end);
+	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end, const RPCParsedResponsePtr &parsed = RPCParsedResponsePtr());
 	void globalCallback(const mtpPrime *from, const mtpPrime *end);
 	void onStateChange(int32 dc, int32 state);
 	void onSessionReset(int32 dc);
@@ -44,12 +46,21 @@ namespace _mtp_internal {
 		return rpcErrorOccured(requestId, handler.onFail, err);
 	}
 
+	// MTP::stats() counters, thread safe, times in microseconds
+	void statsSent(int32 dc, mtpTypeId method, uint32 bytes, uint64 usQueued);
+	void statsResent(int32 dc, mtpTypeId method);
+	void statsReceived(int32 dc, mtpTypeId method, uint32 bytes, uint64 usRtt, uint64 usDispatch, uint64 usCallback);
+	mtpTypeId requestStatsInfo(mtpRequestId requestId, uint64 &usSent); // method and last send time of the stored request, 0 if not found
+
 	class RequestResender : public QObject {
 		Q_OBJECT
 
 	public slots:
 
 		void checkDelayed();
+		void prepareDcAuth(); // next dc of the background auth preparing, see MTP::prepareDcAuth()
+		void prepareDcAuthCheck(); // gives up the current dc if it is not prepared in MTPPrepareDcAuthTimeout
+		void dumpStats(); // writes MTP::stats() and schedules the next dump, see MTP::dumpStats()
 	};
 };
 
@@ -61,6 +72,9 @@ namespace MTP {
 	static const uint32 dld = 1 * _mtp_internal::dcShift; // send(req, callbacks, MTP::dld + dc) - for download
 	static const uint32 upl = 2 * _mtp_internal::dcShift; // send(req, callbacks, MTP::upl + dc) - for upload
 	static const uint32 cfg = 3 * _mtp_internal::dcShift; // send(MTPhelp_GetConfig(), MTP::cfg + dc) - for dc enum
+	inline uint32 uplSession(int32 index) { // send(req, callbacks, MTP::uplSession(index) + dc) - for parallel upload, 0 is MTP::upl
+		return index ? ((3 + index) * _mtp_internal::dcShift) : upl;
+	}
 
 	void start();
 	void restart();
@@ -72,6 +86,8 @@ namespace MTP {
 	int32 maindc();
 	int32 dcstate(int32 dc = 0);
 	QString dctransport(int32 dc = 0);
+	void setTcpProtocol(int32 dc, MTProtoConnection::TcpProtocol protocol); // for the exact session dc, like MTP::dld + dc, applied on the next connect
+	MTProtoConnection::TcpProtocol tcpProtocol(int32 dc); // abridged for download and upload sessions by default, full for others
 	void initdc(int32 dc);
 	template <typename TRequest>
 	inline mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), int32 dc = 0, uint64 msCanWait = 0) {
@@ -99,6 +115,9 @@ namespace MTP {
 	int32 authedId();
 	void logoutKeys(RPCDoneHandlerPtr onDone, RPCFailHandlerPtr onFail);
 
+	void prepareDcAuth(); // if cPrepareDcAuth(), creates auth keys and imports authorization for all known dcs, one by one in background
+	int32 dcAuthPreparing(); // dc which auth key is created in background now, thread safe, 0 if none
+
 	void setGlobalDoneHandler(RPCDoneHandlerPtr handler);
 	void setGlobalFailHandler(RPCFailHandlerPtr handler);
 	void setStateChangedHandler(MTPStateChangedHandler handler);
@@ -117,6 +136,37 @@ namespace MTP {
 	void writeConfig(QDataStream &stream);
 	bool readConfigElem(int32 blockId, QDataStream &stream);
 
+	struct StatsHistogram { // bucket i counts values in [2^i, 2^(i + 1)), bucket 0 counts 0 and 1 as well
+		enum { BucketsCount = 32 };
+
+		StatsHistogram();
+		void add(uint64 value);
+		uint64 percentile(float64 part) const; // upper bound of the bucket where this part of all values is reached
+
+		uint64 count, sum, max;
+		uint64 buckets[BucketsCount];
+	};
+	struct Stats { // times in microseconds
+		Stats();
+
+		uint64 sent, resent, bytesOut, bytesIn;
+		StatsHistogram queueTime; // from sendPrepared() till the request is packed for the socket
+		StatsHistogram rtt; // from the last send till its rpc_result is received
+		StatsHistogram dispatchTime; // from the receive in connection thread till the callback call in session thread
+		StatsHistogram callbackTime; // response parse and handler in execCallback()
+	};
+	typedef QMap<mtpTypeId, Stats> MethodStats; // by wrapped method type, 0 for updates
+	struct DcStats {
+		Stats total;
+		MethodStats methods;
+	};
+	typedef QMap<int32, DcStats> StatsByDc; // by session dc, like MTP::dld + dc
+
+	StatsByDc stats(); // copy of the counters since start or last resetStats()
+	void resetStats();
+	void dumpStats(bool enabled); // writes stats() as json to cWorkingDir() + "mtp_stats.json" every MTPStatsDumpInterval ms
+	bool dumpingStats();
+
 };
 
 #include "mtproto/mtpSessionImpl.h"
@@ -245,6 +245,29 @@ namespace {
 		BN_CTX *ctx;
 	};
 
+	typedef QSet<QByteArray> GoodPrimes; // dh_prime bytes with g appended, that already passed the primality test
+	GoodPrimes gGoodPrimes;
+	QMutex gGoodPrimesLock;
+
+	bool isPrimeAndGoodCached(const string &dhPrime, int32 g) {
+		QByteArray key(&dhPrime[0], dhPrime.length());
+		key.append(char(g));
+		{
+			QMutexLocker lock(&gGoodPrimesLock);
+			if (gGoodPrimes.contains(key)) return true;
+		}
+
+		_BigNumPrimeTest bnPrimeTest;
+		if (!bnPrimeTest.isPrimeAndGood(&dhPrime[0], MTPMillerRabinIterCount, g)) {
+			return false;
+		}
+
+		QMutexLocker lock(&gGoodPrimesLock);
+		if (gGoodPrimes.size() >= MTPGoodPrimesCacheSize) gGoodPrimes.clear();
+		gGoodPrimes.insert(key);
+		return true;
+	}
+
 	typedef QMap<uint64, mtpPublicRSA> PublicRSAKeys;
 	PublicRSAKeys gPublicRSA;
 
@@ -331,6 +354,24 @@ QString MTProtoConnection::transport() const {
 	return data->transport();
 }
 
+uint32 MTProtoConnection::containersSent() const {
+	if (!data) return 0;
+
+	return data->containersSent();
+}
+
+float64 MTProtoConnection::containerFill() const {
+	if (!data) return 0;
+
+	return data->containerFill();
+}
+
+uint64 MTProtoConnection::queueDelay() const {
+	if (!data) return 0;
+
+	return data->queueDelay();
+}
+
 namespace {
 	mtpBuffer _handleHttpResponse(QNetworkReply *reply) {
 		QByteArray response = reply->readAll();
@@ -399,7 +440,18 @@ namespace {
 		return mayBeBadKey;
 	}
 
-	mtpBuffer _handleTcpResponse(mtpPrime *packet, uint32 size) {
+	mtpBuffer _tcpErrorPacket(mtpPrime code) {
+		if (code == -429) {
+			LOG(("Protocol Error: -429 flood code returned!"));
+		} else {
+			LOG(("TCP Error: error packet received, code = %1").arg(code));
+		}
+		return mtpBuffer(1, code);
+	}
+
+	mtpBufferSlice _handleTcpResponse(const mtpBuffer &buffer) {
+		const mtpPrime *packet(buffer.constData());
+		uint32 size = buffer.size();
 		if (size < 4 || size * sizeof(mtpPrime) > MTPPacketSizeMax) {
 			LOG(("TCP Error: bad packet size %1").arg(size * sizeof(mtpPrime)));
 			return mtpBuffer(1, -500);
@@ -416,18 +468,10 @@ namespace {
 		}
 		TCP_LOG(("TCP Info: packet received, num = %1, size = %2").arg(packet[1]).arg(size * sizeof(mtpPrime)));
 		if (size == 4) {
-			if (packet[2] == -429) {
-				LOG(("Protocol Error: -429 flood code returned!"));
-			} else {
-				LOG(("TCP Error: error packet received, code = %1").arg(packet[2]));
-			}
-			return mtpBuffer(1, packet[2]);
+			return _tcpErrorPacket(packet[2]);
 		}
 
-		mtpBuffer data(size - 3);
-		memcpy(data.data(), packet + 2, (size - 3) * sizeof(mtpPrime));
-
-		return data;
+		return mtpBufferSlice(buffer, 2, size - 3);
 	}
 
 	void _handleTcpError(QAbstractSocket::SocketError e, QTcpSocket &sock) {
@@ -489,7 +533,7 @@ namespace {
 		return buffer;
 	}
 
-	MTPResPQ _readPQFakeReply(const mtpBuffer &buffer) {
+	MTPResPQ _readPQFakeReply(const mtpBufferSlice &buffer) {
 		const mtpPrime *answer(buffer.constData());
 		uint32 len = buffer.size();
 		if (len < 5) {
@@ -516,8 +560,100 @@ namespace {
 
 }
 
-MTPabstractTcpConnection::MTPabstractTcpConnection() :
-packetNum(0), packetRead(0), packetLeft(0), readingToShort(true), currentPos((char*)shortBuffer) {
+MTPabstractTcpConnection::MTPabstractTcpConnection() : protocol(MTProtoConnection::TcpFull),
+packetNum(0), packetRead(0), packetSize(0), packetLength(0) {
+}
+
+void MTPabstractTcpConnection::setProtocol(MTProtoConnection::TcpProtocol newProtocol) {
+	protocol = newProtocol;
+}
+
+uint32 MTPabstractTcpConnection::packetHeaderSize() const {
+	if (protocol == MTProtoConnection::TcpAbridged) { // 0x7f in the first byte means 3 more bytes of length
+		return (packetRead && (packetLength & 0xFF) == 0x7f) ? sizeof(mtpPrime) : 1;
+	}
+	return sizeof(mtpPrime);
+}
+
+uint32 mtpTcpFramePacket(mtpBuffer &buffer, MTProtoConnection::TcpProtocol protocol, uint32 &packetNum, bool withTag, const char *&from) {
+	uint32 size = buffer.size(), len = size * sizeof(mtpPrime);
+	if (protocol == MTProtoConnection::TcpFull) {
+		buffer[0] = len;
+		buffer[1] = packetNum++;
+		buffer[size - 1] = hashCrc32(&buffer[0], len - sizeof(mtpPrime));
+		from = (const char*)&buffer[0];
+		return len;
+	}
+
+	uint32 dataLen = len - 3 * sizeof(mtpPrime); // no crc32, len and packet num are replaced with a shorter header
+	char *start = (char*)&buffer[2];
+	if (protocol == MTProtoConnection::TcpAbridged) {
+		uint32 ints = dataLen >> 2;
+		if (ints < 0x7f) {
+			*(--start) = char(ints);
+		} else {
+			start -= sizeof(uint32);
+			*(uint32*)start = 0x7f | (ints << 8);
+		}
+		if (withTag) *(--start) = char(MTPTcpAbridgedTag);
+	} else {
+		start -= sizeof(uint32);
+		*(uint32*)start = dataLen;
+		if (withTag) {
+			start -= sizeof(uint32);
+			*(uint32*)start = MTPTcpIntermediateTag;
+		}
+	}
+	++packetNum;
+	from = start;
+	return ((const char*)&buffer[size - 1]) - start;
+}
+
+void MTPabstractTcpConnection::tcpSend(mtpBuffer &buffer) {
+	const char *from = 0;
+	uint32 len = mtpTcpFramePacket(buffer, protocol, packetNum, packetNum == 0, from);
+	TCP_LOG(("TCP Info: write %1 packet %2 bytes %3").arg(packetNum).arg(len).arg(mb(from, len).str()));
+
+	sock.write(from, len);
+}
+
+mtpBufferSlice MTPabstractTcpConnection::tcpPacketData(const mtpBuffer &packet) {
+	if (protocol == MTProtoConnection::TcpFull) {
+		return _handleTcpResponse(packet);
+	}
+
+	uint32 size = packet.size();
+	TCP_LOG(("TCP Info: packet received, size = %1").arg(size * sizeof(mtpPrime)));
+	if (size == 1) {
+		return _tcpErrorPacket(packet[0]);
+	}
+	return mtpBufferSlice(packet, 0, size);
+}
+
+QString MTPabstractTcpConnection::tcpTransport() const {
+	switch (protocol) {
+	case MTProtoConnection::TcpAbridged: return qsl("TCP abridged");
+	case MTProtoConnection::TcpIntermediate: return qsl("TCP intermediate");
+	}
+	return qsl("TCP");
+}
+
+void MTPabstractTcpConnection::preparePacketBuffer(uint32 size) {
+	int32 found = -1;
+	for (int32 i = 0, l = buffersPool.size(); i < l; ++i) {
+		const mtpBuffer &buffer(buffersPool.at(i));
+		if (!buffer.isDetached()) continue; // still used by some received response
+
+		found = i;
+		if (uint32(buffer.capacity()) >= size) break;
+	}
+	if (found >= 0) {
+		packetBuffer = buffersPool.takeAt(found);
+	} else {
+		packetBuffer = mtpBuffer();
+	}
+	packetBuffer.reserve(size); // keep capacity of the pooled buffer when it is resized down
+	packetBuffer.resize(size);
 }
 
 void MTPabstractTcpConnection::socketRead() {
@@ -528,68 +664,46 @@ void MTPabstractTcpConnection::socketRead() {
 	}
 
 	do {
-		char *readTo = currentPos;
-		uint32 toRead = packetLeft ? packetLeft : (readingToShort ? (MTPShortBufferSize * sizeof(mtpPrime)-packetRead) : 4);
-		if (readingToShort) {
-			if (currentPos + toRead > ((char*)shortBuffer) + MTPShortBufferSize * sizeof(mtpPrime)) {
-				longBuffer.resize(((packetRead + toRead) >> 2) + 1);
-				memcpy(&longBuffer[0], shortBuffer, packetRead);
-				readTo = ((char*)&longBuffer[0]) + packetRead;
-			}
-		} else {
-			if (longBuffer.size() * sizeof(mtpPrime) < packetRead + toRead) {
-				longBuffer.resize(((packetRead + toRead) >> 2) + 1);
-				readTo = ((char*)&longBuffer[0]) + packetRead;
-			}
-		}
+		char *readTo = packetSize ? (((char*)packetBuffer.data()) + packetRead) : (((char*)&packetLength) + packetRead);
+		uint32 toRead = (packetSize ? packetSize : packetHeaderSize()) - packetRead;
+
 		int32 bytes = (int32)sock.read(readTo, toRead);
 		if (bytes > 0) {
 			TCP_LOG(("TCP Info: read %1 bytes %2").arg(bytes).arg(mb(readTo, bytes).str()));
 
 			packetRead += bytes;
-			currentPos += bytes;
-			if (packetLeft) {
-				packetLeft -= bytes;
-				if (!packetLeft) {
-					socketPacket((mtpPrime*)(currentPos - packetRead), packetRead >> 2);
-					currentPos = (char*)shortBuffer;
-					packetRead = packetLeft = 0;
-					readingToShort = true;
-				} else {
-					TCP_LOG(("TCP Info: not enough %1 for packet! read %2").arg(packetLeft).arg(packetRead));
-					emit receivedSome();
+			if (!packetSize) {
+				if (packetRead < packetHeaderSize()) continue;
+
+				uint32 size = (uint32)packetLength, sizeMin = 16;
+				if (protocol == MTProtoConnection::TcpAbridged) {
+					size = (packetRead == 1) ? (size << 2) : ((size >> 8) << 2);
 				}
-			} else {
-				bool move = false;
-				while (packetRead >= 4) {
-					uint32 packetSize = *(uint32*)(currentPos - packetRead);
-					if (packetSize < 16 || packetSize > MTPPacketSizeMax || (packetSize & 0x03)) {
-						LOG(("TCP Error: packet size = %1").arg(packetSize));
-						emit error();
-						return;
-					}
-					if (packetRead >= packetSize) {
-						socketPacket((mtpPrime*)(currentPos - packetRead), packetSize >> 2);
-						packetRead -= packetSize;
-						packetLeft = 0;
-						move = true;
-					} else {
-						packetLeft = packetSize - packetRead;
-						TCP_LOG(("TCP Info: not enough %1 for packet! size %2 read %3").arg(packetLeft).arg(packetSize).arg(packetRead));
-						emit receivedSome();
-						break;
-					}
+				if (protocol != MTProtoConnection::TcpFull) {
+					sizeMin = sizeof(mtpPrime); // error code packet
 				}
-				if (move) {
-					if (!packetRead) {
-						currentPos = (char*)shortBuffer;
-						readingToShort = true;
-					} else if (!readingToShort && packetRead < MTPShortBufferSize * sizeof(mtpPrime)) {
-						memcpy(shortBuffer, currentPos - packetRead, packetRead);
-						currentPos = (char*)shortBuffer;
-						readingToShort = true;
-					}
+				if (size < sizeMin || size > MTPPacketSizeMax || (size & 0x03)) {
+					LOG(("TCP Error: packet size = %1").arg(size));
+					emit error();
+					return;
 				}
+				preparePacketBuffer(size >> 2);
+				if (protocol == MTProtoConnection::TcpFull) { // full packet with its header is checked by crc32
+					packetBuffer[0] = packetLength;
+				} else {
+					packetRead = 0;
+				}
+				packetLength = 0;
+				packetSize = size;
+			} else if (packetRead == packetSize) {
+				mtpBuffer packet(packetBuffer);
+				packetBuffer = mtpBuffer();
+				packetRead = packetSize = 0;
+
+				if (packet.size() <= MTPShortBufferSize && buffersPool.size() < MTPReceiveBuffersPoolSize) {
+					buffersPool.push_back(packet);
+				}
+				socketPacket(packet);
 			}
 		} else if (bytes < 0) {
 			LOG(("TCP Error: socket read return -1"));
@@ -600,6 +714,11 @@ void MTPabstractTcpConnection::socketRead() {
 			break;
 		}
 	} while (sock.state() == QAbstractSocket::ConnectedState && sock.bytesAvailable());
+
+	if (packetRead) {
+		TCP_LOG(("TCP Info: not enough %1 for packet! read %2").arg(packetSize ? (packetSize - packetRead) : (packetHeaderSize() - packetRead)).arg(packetRead));
+		emit receivedSome();
+	}
 }
 
 MTPautoConnection::MTPautoConnection(QThread *thread) : status(WaitingBoth),
@@ -670,17 +789,6 @@ void MTPautoConnection::sendData(mtpBuffer &buffer) {
 	}
 }
 
-void MTPautoConnection::tcpSend(mtpBuffer &buffer) {
-	uint32 size = buffer.size(), len = size * 4;
-
-	buffer[0] = len;
-	buffer[1] = packetNum++;
-	buffer[size - 1] = hashCrc32(&buffer[0], len - 4);
-	TCP_LOG(("TCP Info: write %1 packet %2 bytes %3").arg(packetNum).arg(len).arg(mb(&buffer[0], len).str()));
-
-	sock.write((const char*)&buffer[0], len);
-}
-
 void MTPautoConnection::httpSend(mtpBuffer &buffer) {
 	int32 requestSize = (buffer.size() - 3) * sizeof(mtpPrime);
 
@@ -787,8 +895,8 @@ void MTPautoConnection::requestFinished(QNetworkReply *reply) {
 	}
 }
 
-void MTPautoConnection::socketPacket(mtpPrime *packet, uint32 size) {
-	mtpBuffer data = _handleTcpResponse(packet, size);
+void MTPautoConnection::socketPacket(const mtpBuffer &packet) {
+	mtpBufferSlice data = tcpPacketData(packet);
 	if (data.size() == 1) {
 		if (status == WaitingBoth) {
 			status = WaitingHttp;
@@ -841,7 +949,7 @@ int32 MTPautoConnection::debugState() const {
 
 QString MTPautoConnection::transport() const {
 	if (status == UsingTcp) {
-		return qsl("TCP");
+		return tcpTransport();
 	} else if (status == UsingHttp) {
 		return qsl("HTTP");
 	} else {
@@ -881,14 +989,7 @@ void MTPtcpConnection::sendData(mtpBuffer &buffer) {
 		return;
 	}
 
-	uint32 size = buffer.size(), len = size * 4;
-
-	buffer[0] = len;
-	buffer[1] = packetNum++;
-	buffer[size - 1] = hashCrc32(&buffer[0], len - 4);
-	TCP_LOG(("TCP Info: write %1 packet %2 bytes %3").arg(packetNum).arg(len).arg(mb(&buffer[0], len).str()));
-
-	sock.write((const char*)&buffer[0], len);
+	tcpSend(buffer);
 }
 
 void MTPtcpConnection::disconnectFromServer() {
@@ -901,8 +1002,8 @@ void MTPtcpConnection::connectToServer(const QString &addr, int32 port) {
 	connect(&sock, SIGNAL(readyRead()), this, SLOT(socketRead()));
 }
 
-void MTPtcpConnection::socketPacket(mtpPrime *packet, uint32 size) {
-	mtpBuffer data = _handleTcpResponse(packet, size);
+void MTPtcpConnection::socketPacket(const mtpBuffer &packet) {
+	mtpBufferSlice data = tcpPacketData(packet);
 	if (data.size() == 1) {
 		emit error(data[0] == -404);
 	}
@@ -920,7 +1021,7 @@ int32 MTPtcpConnection::debugState() const {
 }
 
 QString MTPtcpConnection::transport() const {
-	return qsl("TCP");
+	return tcpTransport();
 }
 
 void MTPtcpConnection::socketError(QAbstractSocket::SocketError e) {
@@ -1015,9 +1116,13 @@ void MTProtoConnectionPrivate::createConn() {
 		conn->deleteLater();
 	}
 	if (cConnectionType() == dbictAuto) {
-		conn = new MTPautoConnection(thread());
+		MTPautoConnection *autoConn = new MTPautoConnection(thread());
+		autoConn->setProtocol(MTP::tcpProtocol(dc));
+		conn = autoConn;
 	} else if (cConnectionType() == dbictTcpProxy) {
-		conn = new MTPtcpConnection(thread());
+		MTPtcpConnection *tcpConn = new MTPtcpConnection(thread());
+		tcpConn->setProtocol(MTP::tcpProtocol(dc));
+		conn = tcpConn;
 	} else {
 		conn = new MTPhttpConnection(thread());
 	}
@@ -1031,6 +1136,46 @@ void MTProtoConnectionPrivate::createConn() {
 	oldConnectionTimer.start(MTPConnectionOldTimeout);
 }
 
+MTPdcEndpointProbe::MTPdcEndpointProbe(QObject *parent, int32 dc, const mtpDcEndpoint &endpoint) : QObject(parent), _dc(dc), _endpoint(endpoint), _socket(this), _timeout(this), _started(getms()), _finished(false) {
+	connect(&_socket, SIGNAL(connected()), this, SLOT(onConnected()));
+	connect(&_socket, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(onError(QAbstractSocket::SocketError)));
+	connect(&_timeout, SIGNAL(timeout()), this, SLOT(onTimeout()));
+
+	App::setProxySettings(_socket);
+
+	_timeout.setSingleShot(true);
+	_timeout.start(MTPDcEndpointProbeTimeout);
+	_socket.connectToHost(QHostAddress(QString(_endpoint.ip.c_str())), _endpoint.port);
+}
+
+void MTPdcEndpointProbe::onConnected() {
+	finish(true);
+}
+
+void MTPdcEndpointProbe::onError(QAbstractSocket::SocketError e) {
+	DEBUG_LOG(("MTP Info: dc %1 endpoint %2:%3 probe error %4").arg(_dc).arg(_endpoint.ip.c_str()).arg(_endpoint.port).arg(e));
+	finish(false);
+}
+
+void MTPdcEndpointProbe::onTimeout() {
+	finish(false);
+}
+
+void MTPdcEndpointProbe::finish(bool connected) {
+	if (_finished) return;
+	_finished = true;
+
+	if (connected) {
+		mtpDcEndpointRtt(_dc, _endpoint.ip, _endpoint.port, int32(getms() - _started));
+	} else {
+		mtpDcEndpointFailed(_dc, _endpoint.ip, _endpoint.port);
+	}
+	_timeout.stop();
+	disconnect(&_socket, 0, this, 0);
+	_socket.abort();
+	deleteLater();
+}
+
 MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConnection *owner, MTPSessionData *data, uint32 _dc)
 	: QObject(0)
 	, _state(MTProtoConnection::Disconnected)
@@ -1038,6 +1183,9 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
 	, dc(_dc)
     , _owner(owner)
     , conn(0)
+	, _endpointPort(0)
+	, _endpointConnected(false)
+	, _endpointConnectStart(0)
     , retryTimeout(1)
     , oldConnection(true)
     , receiveDelay(MinReceiveDelay)
@@ -1046,6 +1194,10 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
     , pingId(0)
     , toSendPingId(0)
     , pingMsgId(0)
+	, sentContainers(0)
+	, sentContainersSize(0)
+	, sentQueued(0)
+	, sentQueuedDelay(0)
     , restarted(false)
     , keyId(0)
     , sessionData(data)
@@ -1083,9 +1235,9 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
 	connect(sessionData->owner(), SIGNAL(authKeyCreated()), this, SLOT(updateAuthKey()));
 
 	connect(this, SIGNAL(needToRestart()), this, SLOT(restartNow()));
-	connect(this, SIGNAL(needToReceive()), sessionData->owner(), SLOT(tryToReceive()));
 	connect(this, SIGNAL(stateChanged(qint32)), sessionData->owner(), SLOT(onConnectionStateChange(qint32)));
 	connect(sessionData->owner(), SIGNAL(needToSend()), this, SLOT(tryToSend()));
+	connect(sessionData->owner(), SIGNAL(needToTakeQueued()), this, SLOT(takeQueued()));
 	connect(this, SIGNAL(sessionResetDone()), sessionData->owner(), SLOT(onResetDone()));
 
 	oldConnectionTimer.setSingleShot(true);
@@ -1122,6 +1274,22 @@ QString MTProtoConnectionPrivate::transport() const {
 	return conn->transport();
 }
 
+uint32 MTProtoConnectionPrivate::containersSent() const {
+	QMutexLocker lock(&sendStatsLock);
+	return sentContainers;
+}
+
+float64 MTProtoConnectionPrivate::containerFill() const {
+	QMutexLocker lock(&sendStatsLock);
+	if (!sentContainers) return 0;
+	return float64(sentContainersSize * sizeof(mtpPrime)) / (float64(sentContainers) * MTPContainerSizeMax);
+}
+
+uint64 MTProtoConnectionPrivate::queueDelay() const {
+	QMutexLocker lock(&sendStatsLock);
+	return sentQueued ? (sentQueuedDelay / sentQueued) : 0;
+}
+
 bool MTProtoConnectionPrivate::setState(int32 state, int32 ifState) {
 	if (ifState != MTProtoConnection::UpdateAlways) {
 		QReadLocker lock(&stateMutex);
@@ -1332,6 +1500,11 @@ mtpMsgId MTProtoConnectionPrivate::replaceMsgId(mtpRequest &request, mtpMsgId ne
 	return newId;
 }
 
+void MTProtoConnectionPrivate::takeQueued() {
+	QWriteLocker locker(sessionData->toSendMutex());
+	sessionData->toSendMap();
+}
+
 void MTProtoConnectionPrivate::tryToSend() {
 	if (!conn) return;
 
@@ -1368,8 +1541,8 @@ void MTProtoConnectionPrivate::tryToSend() {
 		}
 	}
 
-	bool needAnyResponse = false;
-	mtpRequest toSendRequest;
+	QList<mtpRequest> toSendRequests;
+	QList<bool> toSendNeedResponse;
 	{
 		QWriteLocker locker1(sessionData->toSendMutex());
 
@@ -1381,97 +1554,153 @@ void MTProtoConnectionPrivate::tryToSend() {
 
 		if (!toSendCount) return; // nothing to send
 
-		mtpRequest first = havePrepend ? prepend : toSend.cbegin().value();
-		if (toSendCount == 1 && first->msDate > 0) { // if can send without container
-			toSendRequest = first;
-			if (!prependOnly) {
-				toSend.clear();
-				locker1.unlock();
+		SendBatch byPriority[mtpRequestData::PriorityCount];
+		if (havePrepend) byPriority[mtpRequestData::PriorityInteractive].push_back(prepend);
+
+		uint64 ms = getms();
+		uint32 queued = 0;
+		uint64 queuedDelay = 0;
+		for (mtpPreRequestMap::const_iterator i = toSend.cbegin(), e = toSend.cend(); i != e; ++i) {
+			const mtpRequest &req(i.value());
+			if (req->msDate > 0 && req->msDate <= ms) {
+				++queued;
+				queuedDelay += ms - req->msDate;
+			}
+			byPriority[mtpRequestData::sendPriority(req)].push_back(req);
+		}
+		toSend.clear();
+
+		SendBatch ordered;
+		for (int32 priority = 0; priority < mtpRequestData::PriorityCount; ++priority) {
+			ordered.append(byPriority[priority]);
+		}
+
+		// pack in priority order, starting a new container when the current one is full
+		uint32 containers = 0, containersSize = 0, batchSize = 0;
+		SendBatch batch;
+		for (int32 i = 0, l = ordered.size(); i < l; ++i) {
+			batch.push_back(ordered.at(i));
+			batchSize += mtpRequestData::messageSize(ordered.at(i));
+
+			bool full = (i + 1 == l) || (batch.size() >= MTPContainerCountMax);
+			if (!full) {
+				uint32 nextSize = mtpRequestData::messageSize(ordered.at(i + 1));
+				full = ((batchSize + nextSize) * sizeof(mtpPrime) > uint32(MTPContainerSizeMax));
+			}
+			if (full) {
+				bool needAnyResponse = false;
+				mtpRequest toSendRequest = packToSend(batch, prepend, needAnyResponse);
+				if (mtpTypeId((*toSendRequest)[8]) == mtpc_msg_container) {
+					++containers;
+					containersSize += batchSize;
+				}
+				toSendRequests.push_back(toSendRequest);
+				toSendNeedResponse.push_back(needAnyResponse);
+
+				batch.clear();
+				batchSize = 0;
 			}
+		}
 
-			mtpMsgId msgId = prepareToSend(toSendRequest, msgid());
-			if (havePrepend) pingMsgId = msgId;
+		uint64 us = getus();
+		for (SendBatch::const_iterator i = ordered.cbegin(), e = ordered.cend(); i != e; ++i) {
+			const mtpRequest &req(*i);
+			if (!req->requestId) continue; // ping
 
-			if (toSendRequest->requestId) {
-				if (mtpRequestData::needAck(toSendRequest)) {
-					toSendRequest->msDate = mtpRequestData::isStateRequest(toSendRequest) ? 0 : getms();
+			_mtp_internal::statsSent(dc, mtpRequestData::methodType(req), mtpRequestData::messageSize(req) * sizeof(mtpPrime), (req->usQueued && req->usQueued < us) ? (us - req->usQueued) : 0);
+			req->usSent = us;
+		}
 
-					QWriteLocker locker2(sessionData->haveSentMutex());
-					sessionData->haveSentMap().insert(msgId, toSendRequest);
+		if (containers || queued) {
+			QMutexLocker lock(&sendStatsLock);
+			sentContainers += containers;
+			sentContainersSize += containersSize;
+			sentQueued += queued;
+			sentQueuedDelay += queuedDelay;
+		}
+	}
+	for (int32 i = 0, l = toSendRequests.size(); i < l; ++i) {
+		mtpRequestData::padding(toSendRequests[i]);
+		sendRequest(toSendRequests[i], toSendNeedResponse.at(i));
+	}
+}
 
-					needAnyResponse = true;
-				} else {
-					QWriteLocker locker3(sessionData->wereAckedMutex());
-					sessionData->wereAckedMap().insert(msgId, toSendRequest->requestId);
-				}
-			}
-		} else { // send in container
-			uint32 containerSize = 1 + 1, idsWrapSize = (toSendCount << 1); // cons + vector size, idsWrapSize - size of "request-like" wrap for msgId vector
-			if (havePrepend) containerSize += mtpRequestData::messageSize(prepend);
-			for (mtpPreRequestMap::iterator i = toSend.begin(), e = toSend.end(); i != e; ++i) {
-				containerSize += mtpRequestData::messageSize(i.value());
-			}
-			toSendRequest = mtpRequestData::prepare(containerSize); // prepare container
-			toSendRequest->push_back(mtpc_msg_container);
-			toSendRequest->push_back(toSendCount);
+mtpRequest MTProtoConnectionPrivate::packToSend(SendBatch &batch, const mtpRequest &ping, bool &needAnyResponse) {
+	mtpRequest first = batch.front();
+	if (batch.size() == 1 && first->msDate > 0) { // if can send without container
+		mtpMsgId msgId = prepareToSend(first, msgid());
+		if (first == ping) pingMsgId = msgId;
 
-			mtpMsgId bigMsgId = msgid(); // check for a valid container
+		if (first->requestId) {
+			if (mtpRequestData::needAck(first)) {
+				first->msDate = mtpRequestData::isStateRequest(first) ? 0 : getms();
 
-			QWriteLocker locker2(sessionData->haveSentMutex()); // the fact of this lock is used in replaceMsgId()
-			mtpRequestMap &haveSent(sessionData->haveSentMap());
+				QWriteLocker locker2(sessionData->haveSentMutex());
+				sessionData->haveSentMap().insert(msgId, first);
 
-			QWriteLocker locker3(sessionData->wereAckedMutex()); // the fact of this lock is used in replaceMsgId()
-			mtpRequestIdsMap &wereAcked(sessionData->wereAckedMap());
+				needAnyResponse = true;
+			} else {
+				QWriteLocker locker3(sessionData->wereAckedMutex());
+				sessionData->wereAckedMap().insert(msgId, first->requestId);
+			}
+		}
+		return first;
+	}
 
-			mtpRequest haveSentIdsWrap(mtpRequestData::prepare(idsWrapSize)); // prepare "request-like" wrap for msgId vector
-			haveSentIdsWrap->requestId = 0;
-			haveSentIdsWrap->resize(haveSentIdsWrap->size() + idsWrapSize);
-			mtpMsgId *haveSentArr = (mtpMsgId*)(haveSentIdsWrap->data() + 8);
+	// send in container
+	uint32 toSendCount = batch.size();
+	uint32 containerSize = 1 + 1, idsWrapSize = (toSendCount << 1); // cons + vector size, idsWrapSize - size of "request-like" wrap for msgId vector
+	for (SendBatch::const_iterator i = batch.cbegin(), e = batch.cend(); i != e; ++i) {
+		containerSize += mtpRequestData::messageSize(*i);
+	}
+	mtpRequest toSendRequest = mtpRequestData::prepare(containerSize); // prepare container
+	toSendRequest->push_back(mtpc_msg_container);
+	toSendRequest->push_back(toSendCount);
 
-			if (havePrepend) {
-				mtpMsgId msgId = prepareToSend(prepend, bigMsgId);
-				if (msgId > bigMsgId) msgId = replaceMsgId(prepend, bigMsgId);
-				if (msgId >= bigMsgId) bigMsgId = msgid();
-				*(haveSentArr++) = msgId;
-				if (havePrepend) pingMsgId = msgId;
+	mtpMsgId bigMsgId = msgid(); // check for a valid container
 
-				uint32 from = toSendRequest->size(), len = mtpRequestData::messageSize(prepend);
-				toSendRequest->resize(from + len);
-				memcpy(toSendRequest->data() + from, prepend->constData() + 4, len * sizeof(mtpPrime));
+	QWriteLocker locker2(sessionData->haveSentMutex()); // the fact of this lock is used in replaceMsgId()
+	mtpRequestMap &haveSent(sessionData->haveSentMap());
 
-				needAnyResponse = true;
-			}
-			for (mtpPreRequestMap::iterator i = toSend.begin(), e = toSend.end(); i != e; ++i) {
-				mtpRequest &req(i.value());
-				mtpMsgId msgId = prepareToSend(req, bigMsgId);
-				if (msgId > bigMsgId) msgId = replaceMsgId(req, bigMsgId);
-				if (msgId >= bigMsgId) bigMsgId = msgid();
-				*(haveSentArr++) = msgId;
+	QWriteLocker locker3(sessionData->wereAckedMutex()); // the fact of this lock is used in replaceMsgId()
+	mtpRequestIdsMap &wereAcked(sessionData->wereAckedMap());
 
-				if (req->requestId) {
-					if (mtpRequestData::needAck(req)) {
-						req->msDate = mtpRequestData::isStateRequest(req) ? 0 : getms();
-						haveSent.insert(msgId, req);
+	mtpRequest haveSentIdsWrap(mtpRequestData::prepare(idsWrapSize)); // prepare "request-like" wrap for msgId vector
+	haveSentIdsWrap->requestId = 0;
+	haveSentIdsWrap->resize(haveSentIdsWrap->size() + idsWrapSize);
+	mtpMsgId *haveSentArr = (mtpMsgId*)(haveSentIdsWrap->data() + 8);
+
+	for (SendBatch::iterator i = batch.begin(), e = batch.end(); i != e; ++i) {
+		mtpRequest &req(*i);
+		mtpMsgId msgId = prepareToSend(req, bigMsgId);
+		if (msgId > bigMsgId) msgId = replaceMsgId(req, bigMsgId);
+		if (msgId >= bigMsgId) bigMsgId = msgid();
+		*(haveSentArr++) = msgId;
+
+		if (req == ping) {
+			pingMsgId = msgId;
+			needAnyResponse = true;
+		} else if (req->requestId) {
+			if (mtpRequestData::needAck(req)) {
+				req->msDate = mtpRequestData::isStateRequest(req) ? 0 : getms();
+				haveSent.insert(msgId, req);
 
-						needAnyResponse = true;
-					} else {
-						wereAcked.insert(msgId, req->requestId);
-					}
-				}
-				uint32 from = toSendRequest->size(), len = mtpRequestData::messageSize(req);
-				toSendRequest->resize(from + len);
-				memcpy(toSendRequest->data() + from, req->constData() + 4, len * sizeof(mtpPrime));
+				needAnyResponse = true;
+			} else {
+				wereAcked.insert(msgId, req->requestId);
 			}
-
-			mtpMsgId contMsgId = prepareToSend(toSendRequest, bigMsgId);
-			*(mtpMsgId*)(haveSentIdsWrap->data() + 4) = contMsgId;
-			(*haveSentIdsWrap)[6] = 0; // for container, msDate = 0, seqNo = 0
-			haveSent.insert(contMsgId, haveSentIdsWrap);
-			toSend.clear();
 		}
+		uint32 from = toSendRequest->size(), len = mtpRequestData::messageSize(req);
+		toSendRequest->resize(from + len);
+		memcpy(toSendRequest->data() + from, req->constData() + 4, len * sizeof(mtpPrime));
 	}
-	mtpRequestData::padding(toSendRequest);
-	sendRequest(toSendRequest, needAnyResponse);
+
+	mtpMsgId contMsgId = prepareToSend(toSendRequest, bigMsgId);
+	*(mtpMsgId*)(haveSentIdsWrap->data() + 4) = contMsgId;
+	(*haveSentIdsWrap)[6] = 0; // for container, msDate = 0, seqNo = 0
+	haveSent.insert(contMsgId, haveSentIdsWrap);
+
+	return toSendRequest;
 }
 
 void MTProtoConnectionPrivate::retryByTimer() {
@@ -1509,11 +1738,8 @@ void MTProtoConnectionPrivate::socketStart(bool afterConfig) {
 	setState(MTProtoConnection::Connecting);
 	pingId = pingMsgId = toSendPingId = 0;
 
-	const mtpDcOption *dcOption = 0;
-	const mtpDcOptions &gDcOptions(mtpDCOptions());
-	mtpDcOptions::const_iterator dcIndex = gDcOptions.constFind(dc % _mtp_internal::dcShift);
 	DEBUG_LOG(("MTP Info: connecting to DC %1..").arg(dc));
-	if (dcIndex == gDcOptions.cend()) {
+	if (!mtpChooseDcEndpoint(dc % _mtp_internal::dcShift, _endpointIp, _endpointPort)) {
 		if (afterConfig) {
 			LOG(("MTP Error: DC %1 options not found right after config load!").arg(dc));
 			return restart();
@@ -1524,23 +1750,40 @@ void MTProtoConnectionPrivate::socketStart(bool afterConfig) {
 			return;
 		}
 	}
-	dcOption = &dcIndex.value();
+	_endpointConnected = false;
+	probeEndpoints();
 
-	const char *ip(dcOption->ip.c_str());
-	uint32 port(dcOption->port);
+	const char *ip(_endpointIp.c_str());
+	uint32 port(_endpointPort);
 	DEBUG_LOG(("MTP Info: socket connection to %1:%2..").arg(ip).arg(port));
 
 	connect(conn, SIGNAL(connected()), this, SLOT(onConnected()));
 	connect(conn, SIGNAL(disconnected()), this, SLOT(restart()));
 
+	_endpointConnectStart = getms();
 	conn->connectToServer(ip, port);
 }
 
+void MTProtoConnectionPrivate::probeEndpoints() {
+	if (cConnectionType() == dbictHttpProxy) return; // no direct tcp connections
+
+	int32 dcId = dc % _mtp_internal::dcShift;
+	mtpDcEndpoints endpoints(mtpDcEndpointsToProbe(dcId));
+	for (mtpDcEndpoints::const_iterator i = endpoints.cbegin(), e = endpoints.cend(); i != e; ++i) {
+		new MTPdcEndpointProbe(this, dcId, *i);
+	}
+}
+
 void MTProtoConnectionPrivate::restart(bool maybeBadKey) {
 	DEBUG_LOG(("MTP Info: restarting MTProtoConnection, maybe bad key = %1").arg(logBool(maybeBadKey)));
 
 	connCheckTimer.stop();
 
+	if (!_endpointConnected && !_endpointIp.empty()) { // other endpoint may be chosen next time
+		mtpDcEndpointFailed(dc % _mtp_internal::dcShift, _endpointIp, _endpointPort);
+		_endpointIp = string();
+	}
+
 	mtpAuthKeyPtr key(sessionData->getKey());
 	if (key) {
 		if (!sessionData->isCheckedKey()) {
@@ -1609,6 +1852,9 @@ void MTProtoConnectionPrivate::onBadConnection() {
 	}
 
 	DEBUG_LOG(("MTP Info: bad connection, delay: %1ms").arg(receiveDelay));
+	if (!_endpointIp.empty()) {
+		mtpDcEndpointFailed(dc % _mtp_internal::dcShift, _endpointIp, _endpointPort);
+	}
 	if (receiveDelay < MTPMaxReceiveDelay) {
 		receiveDelay *= 2;
 	}
@@ -1664,9 +1910,11 @@ void MTProtoConnectionPrivate::handleReceived() {
 
 	
 	while (conn->received().size()) {
-		const mtpBuffer &encryptedBuf(conn->received().front());
+		mtpBufferSlice encryptedBuf(conn->received().front());
+		conn->received().pop_front();
+
 		uint32 len = encryptedBuf.size();
-		const mtpPrime *encrypted(encryptedBuf.data());
+		mtpPrime *encrypted(encryptedBuf.inplaceData()); // received buffer is not shared with anyone who reads it yet
 		if (len < 18) { // 2 auth_key_id, 4 msg_key, 2 salt, 2 session, 2 msg_id, 1 seq_no, 1 length, (1 data + 3 padding) min
 			LOG(("TCP Error: bad message received, len %1").arg(len * sizeof(mtpPrime)));
 			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
@@ -1678,28 +1926,26 @@ void MTProtoConnectionPrivate::handleReceived() {
 			return restart();
 		}
 
-		QByteArray dataBuffer((len - 6) * sizeof(mtpPrime), Qt::Uninitialized);
-		mtpPrime *data((mtpPrime*)dataBuffer.data()), *msg = data + 8;
+		uint32 dataSize = (len - 6) * sizeof(mtpPrime);
+		mtpPrime *data(encrypted + 6), *msg = data + 8;
 		const mtpPrime *from(msg), *end;
 		MTPint128 msgKey(*(MTPint128*)(encrypted + 2));
-		
-		aesDecrypt(encrypted + 6, data, dataBuffer.size(), key, msgKey);
+
+		aesDecrypt(data, data, dataSize, key, msgKey); // decrypt in place, the responses will be sliced right from this buffer
 
 		uint64 serverSalt = *(uint64*)&data[0], session = *(uint64*)&data[2], msgId = *(uint64*)&data[4];
 		uint32 seqNo = *(uint32*)&data[6], msgLen = *(uint32*)&data[7];
 		bool needAck = (seqNo & 0x01);
 
-		if (uint32(dataBuffer.size()) < msgLen + 8 * sizeof(mtpPrime) || (msgLen & 0x03)) {
-			LOG(("TCP Error: bad msg_len received %1, data size: %2").arg(msgLen).arg(dataBuffer.size()));
-			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
-			conn->received().pop_front();
+		if (dataSize < msgLen + 8 * sizeof(mtpPrime) || (msgLen & 0x03)) {
+			LOG(("TCP Error: bad msg_len received %1, data size: %2").arg(msgLen).arg(dataSize));
+			TCP_LOG(("TCP Error: bad decrypted message %1").arg(mb(data, dataSize).str()));
 			return restart();
 		}
 		uchar sha1Buffer[20];
 		if (memcmp(&msgKey, hashSha1(data, msgLen + 8 * sizeof(mtpPrime), sha1Buffer) + 1, sizeof(msgKey))) {
 			LOG(("TCP Error: bad SHA1 hash after aesDecrypt in message"));
-			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
-			conn->received().pop_front();
+			TCP_LOG(("TCP Error: bad decrypted message %1").arg(mb(data, dataSize).str()));
 			return restart();
 		}
 		TCP_LOG(("TCP Info: decrypted message %1,%2,%3 is %4").arg(msgId).arg(seqNo).arg(logBool(needAck)).arg(mb(data, msgLen + 8 * sizeof(mtpPrime)).str()));
@@ -1708,12 +1954,9 @@ void MTProtoConnectionPrivate::handleReceived() {
 		if (session != serverSession) {
 			LOG(("MTP Error: bad server session received"));
 			TCP_LOG(("MTP Error: bad server session %1 instead of %2 in message received").arg(session).arg(serverSession));
-			conn->received().pop_front();
 			return restart();
 		}
 
-		conn->received().pop_front();
-
 		int32 serverTime((int32)(msgId >> 32)), clientTime(unixtime());
 		bool isReply = ((msgId & 0x03) == 1);
 		if (!isReply && ((msgId & 0x03) != 3)) {
@@ -1762,7 +2005,7 @@ void MTProtoConnectionPrivate::handleReceived() {
 			needToHandle = receivedIds.insert(msgId, needAck);
 		}
 		if (needToHandle) {
-			res = handleOneReceived(from, end, msgId, serverTime, serverSalt, badTime);
+			res = handleOneReceived(from, end, encryptedBuf, msgId, serverTime, serverSalt, badTime);
 		}
 		{
 			QWriteLocker lock(sessionData->receivedIdsMutex());
@@ -1781,19 +2024,6 @@ void MTProtoConnectionPrivate::handleReceived() {
 			ackRequestData->clear();
 		}
 
-		bool emitSignal = false;
-		{
-			QReadLocker locker(sessionData->haveReceivedMutex());
-			emitSignal = !sessionData->haveReceivedMap().isEmpty();
-			if (emitSignal) {
-				DEBUG_LOG(("MTP Info: emitting needToReceive() - need to parse in another thread, haveReceivedMap.size() = %1").arg(sessionData->haveReceivedMap().size()));
-			}
-		}
-		
-		if (emitSignal) {
-			emit needToReceive();
-		}
-
 		if (res < 0) {
 			_needSessionReset = (res < -1);
 			return restart();
@@ -1815,7 +2045,7 @@ void MTProtoConnectionPrivate::handleReceived() {
 	}
 }
 
-int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mtpPrime *end, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime) {
+int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mtpPrime *end, const mtpBufferSlice &owner, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime) {
 	mtpTypeId cons = *from;
 	try {
 
@@ -1827,7 +2057,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		if (!response.size()) {
 			return -1;
 		}
-		return handleOneReceived(response.data(), response.data() + response.size(), msgId, serverTime, serverSalt, badTime);
+		return handleOneReceived(response.constData(), response.constData() + response.size(), mtpBufferSlice(response), msgId, serverTime, serverSalt, badTime);
 	}
 
 	case mtpc_msg_container: {
@@ -1870,7 +2100,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			}
 			int32 res = 1; // if no need to handle, then succeed
 			if (needToHandle) {
-				res = handleOneReceived(from, otherEnd, inMsgId.v, serverTime, serverSalt, badTime);
+				res = handleOneReceived(from, otherEnd, owner, inMsgId.v, serverTime, serverSalt, badTime);
 				badTime = false;
 			}
 			if (res <= 0) {
@@ -2219,14 +2449,23 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			}
 			typeId = response[0];
 		} else {
-			response.resize(end - from);
-			memcpy(response.data(), from, (end - from) * sizeof(mtpPrime));
+			response = owner.mid(from, end);
 		}
 
 		mtpRequestId requestId = wasSent(reqMsgId.v);
 		if (requestId && requestId != mtpRequestId(0xFFFFFFFF)) {
-			QWriteLocker locker(sessionData->haveReceivedMutex());
-			sessionData->haveReceivedMap().insert(requestId, response); // save rpc_result for processing in main mtp thread
+			MTPSessionData::ReceivedItem item(requestId, response);
+			if (typeId != mtpc_rpc_error) {
+				RPCResponseParser parser = _mtp_internal::responseParser(requestId);
+				if (parser) {
+					try {
+						item.parsed = (*parser)(response.constData(), response.constData() + response.size());
+					} catch (Exception &e) {
+						DEBUG_LOG(("RPC Info: could not parse response for request %1 in connection thread, exception: %2").arg(requestId).arg(e.what()));
+					}
+				}
+			}
+			sessionData->queueReceived(item); // save rpc_result for processing in main mtp thread, parsed objects are not shared with this thread
 		} else {
 			DEBUG_LOG(("RPC Info: requestId not found for msgId %1").arg(reqMsgId.v));
 		}
@@ -2255,13 +2494,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			resend(toResend[i], 10, true);
 		}
 
-		mtpBuffer update(end - from);
-		if (end > from) memcpy(update.data(), from, (end - from) * sizeof(mtpPrime));
-		
-		QWriteLocker locker(sessionData->haveReceivedMutex());
-		mtpResponseMap &haveReceived(sessionData->haveReceivedMap());
-		mtpRequestId fakeRequestId = sessionData->nextFakeRequestId();
-		haveReceived.insert(fakeRequestId, mtpResponse(update)); // notify main process about new session - need to get difference
+		sessionData->queueReceived(MTPSessionData::ReceivedItem(0, mtpResponse(owner.mid(from, end)))); // notify main process about new session - need to get difference
 	} return 1;
 
 	case mtpc_ping: {
@@ -2301,6 +2534,30 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		retryTimeout = 1; // reset restart() timer
 	} return 1;
 
+	case mtpc_future_salts: {
+		MTPFutureSalts msg(from, end);
+		const MTPDfuture_salts &data(msg.c_future_salts());
+		const QVector<MTPfutureSalt> &salts(data.vsalts.c_vector().v);
+		DEBUG_LOG(("Message Info: future salts received, req_msg_id: %1, now: %2, count: %3").arg(data.vreq_msg_id.v).arg(data.vnow.v).arg(salts.size()));
+
+		if (!wasSent(data.vreq_msg_id.v)) {
+			DEBUG_LOG(("Message Error: such msg_id %1 was not sent recently").arg(data.vreq_msg_id.v));
+			return 0;
+		}
+
+		int32 delta = unixtime() - data.vnow.v; // salts are stored in client time
+		mtpFutureSalts futureSalts;
+		futureSalts.reserve(salts.size());
+		for (QVector<MTPfutureSalt>::const_iterator i = salts.cbegin(), e = salts.cend(); i != e; ++i) {
+			const MTPDfuture_salt &salt(i->c_future_salt());
+			futureSalts.push_back(mtpFutureSalt(salt.vvalid_since.v + delta, salt.vvalid_until.v + delta, salt.vsalt.v));
+		}
+		sessionData->setFutureSalts(futureSalts);
+		sessionData->useFutureSalt(unixtime());
+
+		requestsAcked(QVector<MTPlong>(1, data.vreq_msg_id));
+	} return 1;
+
 	}
 
 	} catch (Exception &e) {
@@ -2312,13 +2569,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		return -1;
 	}
 
-	mtpBuffer update(end - from);
-	if (end > from) memcpy(update.data(), from, (end - from) * sizeof(mtpPrime));
-		
-	QWriteLocker locker(sessionData->haveReceivedMutex());
-	mtpResponseMap &haveReceived(sessionData->haveReceivedMap());
-	mtpRequestId fakeRequestId = sessionData->nextFakeRequestId();
-	haveReceived.insert(fakeRequestId, mtpResponse(update)); // notify main process about new updates
+	sessionData->queueReceived(MTPSessionData::ReceivedItem(0, mtpResponse(owner.mid(from, end)))); // notify main process about new updates
 
 	if (cons != mtpc_updatesTooLong && cons != mtpc_updateShortMessage && cons != mtpc_updateShortChatMessage && cons != mtpc_updateShort && cons != mtpc_updatesCombined && cons != mtpc_updates) {
 		LOG(("Message Error: unknown constructor %1").arg(cons)); // maybe new api?..
@@ -2394,6 +2645,7 @@ void MTProtoConnectionPrivate::requestsAcked(const QVector<MTPlong> &ids) {
 
 	RPCCallbackClears clearedAcked;
 	QVector<MTPlong> toAckMore;
+	uint64 msLastSent = 0; // acks are sent by server in batches, the last sent acked request gives the closest to rtt sample
 	{
 		QWriteLocker locker1(sessionData->wereAckedMutex());
 		mtpRequestIdsMap &wereAcked(sessionData->wereAckedMap());
@@ -2415,6 +2667,7 @@ void MTProtoConnectionPrivate::requestsAcked(const QVector<MTPlong> &ids) {
 							toAckMore.push_back(MTP_long(*(inContId++)));
 						}
 					} else {
+						if (req.value()->msDate > msLastSent) msLastSent = req.value()->msDate;
 						wereAcked.insert(msgId, req.value()->requestId);
 					}
 					haveSent.erase(req);
@@ -2459,6 +2712,11 @@ void MTProtoConnectionPrivate::requestsAcked(const QVector<MTPlong> &ids) {
 		}
 	}
 
+	if (msLastSent) {
+		uint64 ms = getms();
+		if (ms >= msLastSent) sessionData->rttSample(ms - msLastSent);
+	}
+
 	if (clearedAcked.size()) {
 		_mtp_internal::clearCallbacksDelayed(clearedAcked);
 	}
@@ -2525,6 +2783,10 @@ void MTProtoConnectionPrivate::onConnected() {
 	}
 
 	TCP_LOG(("Connection Info: connection succeed."));
+	if (!_endpointConnected && !_endpointIp.empty()) { // real connections count like the probes, resetting the endpoint failures
+		mtpDcEndpointRtt(dc % _mtp_internal::dcShift, _endpointIp, _endpointPort, int32(getms() - _endpointConnectStart));
+	}
+	_endpointConnected = true;
 
 	if (updateAuthKey()) {
 		DEBUG_LOG(("MTP Info: returning from socketConnected.."));
@@ -2543,6 +2805,11 @@ void MTProtoConnectionPrivate::onConnected() {
 	}
 
 	authKeyData = new MTProtoConnectionPrivate::AuthKeyCreateData();
+	if (MTP::dcAuthPreparing() == int32(dc % _mtp_internal::dcShift)) { // background key creation should not compete with the ui and other connections
+		authKeyData->priorityLowered = true;
+		authKeyData->priorityBefore = thread()->priority();
+		thread()->setPriority(QThread::LowPriority);
+	}
 	authKeyData->req_num = 0;
 	authKeyData->nonce = MTP::nonce<MTPint128>();
 
@@ -2773,9 +3040,8 @@ void MTProtoConnectionPrivate::dhParamsAnswered() {
 			return restart();
 		}
 		
-		// check that dhPrime and (dhPrime - 1) / 2 are really prime using openssl BIGNUM methods
-		_BigNumPrimeTest bnPrimeTest;
-		if (!bnPrimeTest.isPrimeAndGood(&dhPrime[0], MTPMillerRabinIterCount, dh_inner_data.vg.v)) {
+		// check that dhPrime and (dhPrime - 1) / 2 are really prime using openssl BIGNUM methods, once for each dhPrime and g
+		if (!isPrimeAndGoodCached(dhPrime, dh_inner_data.vg.v)) {
 			LOG(("AuthKey Error: bad dh_prime primality!").arg(dhPrime.length()).arg(g_a.length()));
 			DEBUG_LOG(("AuthKey Error: dh_prime %1").arg(mb(&dhPrime[0], dhPrime.length()).str()));
 			return restart();
@@ -2992,6 +3258,9 @@ void MTProtoConnectionPrivate::authKeyCreated() {
 
 void MTProtoConnectionPrivate::clearAuthKeyData() {
 	if (authKeyData) {
+		if (authKeyData->priorityLowered) {
+			thread()->setPriority(authKeyData->priorityBefore);
+		}
 #ifdef Q_OS_WIN // TODO
 //		SecureZeroMemory(authKeyData, sizeof(AuthKeyCreateData));
 #else
@@ -3053,7 +3322,7 @@ bool MTProtoConnectionPrivate::readResponseNotSecure(TResponse &response) {
 			LOG(("AuthKey Error: trying to read response from empty received list"));
 			return false;
 		}
-		mtpBuffer buffer(conn->received().front());
+		mtpBufferSlice buffer(conn->received().front());
 		conn->received().pop_front();
 
 		const mtpPrime *answer(buffer.constData());
@@ -21,6 +21,7 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 #include "mtproto/mtpScheme.h"
 #include "mtproto/mtpPublicRSA.h"
 #include "mtproto/mtpAuthKey.h"
+#include "mtproto/mtpDC.h"
 
 inline bool mtpRequestData::isSentContainer(const mtpRequest &request) { // "request-like" wrap for msgIds vector
 	if (request->size() < 9) return false;
@@ -49,6 +50,37 @@ inline bool mtpRequestData::needAckByType(mtpTypeId type) {
 	return true;
 }
 
+inline mtpTypeId mtpRequestData::methodType(const mtpRequest &request) {
+	if (request->size() < 9) return 0;
+
+	mtpTypeId type = (*request)[8];
+	if (request->size() > 9) {
+		for (uint32 i = 1; i < mtpLayerMax; ++i) {
+			if (type == mtpLayers[i]) { // look at the wrapped request
+				return (*request)[9];
+			}
+		}
+	}
+	return type;
+}
+
+inline mtpRequestData::SendPriority mtpRequestData::sendPriority(const mtpRequest &request) {
+	if (request->size() < 9) return PriorityInteractive;
+
+	mtpTypeId type = methodType(request);
+	switch (type) {
+	case mtpc_upload_saveFilePart:
+	case mtpc_upload_saveBigFilePart:
+	case mtpc_upload_getFile:
+		return PriorityBulk;
+
+	case mtpc_msgs_state_req:
+	case mtpc_msg_resend_req:
+		return PriorityBackground;
+	}
+	return mtpRequestData::needAckByType(type) ? PriorityInteractive : PriorityBackground;
+}
+
 class MTProtoConnectionPrivate;
 class MTPSessionData;
 
@@ -69,6 +101,12 @@ public:
 		HttpConnection
 	};
 
+	enum TcpProtocol { // framing of packets in tcp transport
+		TcpFull = 0, // len, packet num and crc32 around each packet
+		TcpAbridged, // 0xef once, then 1 or 4 bytes of len / 4 before each packet
+		TcpIntermediate, // 0xeeeeeeee once, then 4 bytes of len before each packet
+	};
+
 	MTProtoConnection();
 	int32 start(MTPSessionData *data, int32 dc = 0); // return dc
 	void restart();
@@ -87,6 +125,10 @@ public:
 	int32 state() const;
 	QString transport() const;
 
+	uint32 containersSent() const;
+	float64 containerFill() const; // average part of MTPContainerSizeMax used
+	uint64 queueDelay() const; // average time requests waited in toSend map before being sent, in ms
+
     /*template <typename TRequest> // not used
     uint64 sendAsync(const TRequest &request) {
         return data->sendAsync(request);
@@ -99,10 +141,15 @@ private:
 
 };
 
+const uchar MTPTcpAbridgedTag = 0xef; // first byte of the abridged tcp protocol
+const uint32 MTPTcpIntermediateTag = 0xeeeeeeee; // first 4 bytes of the intermediate tcp protocol
+
+uint32 mtpTcpFramePacket(mtpBuffer &buffer, MTProtoConnection::TcpProtocol protocol, uint32 &packetNum, bool withTag, const char *&from); // frames buffer in place, returns the bytes count to write from the from pointer
+
 class MTPabstractConnection : public QObject {
 	Q_OBJECT
 
-	typedef QList<mtpBuffer> BuffersQueue;
+	typedef QList<mtpBufferSlice> BuffersQueue;
 
 public:
 
@@ -145,6 +192,8 @@ public:
 
 	MTPabstractTcpConnection();
 
+	void setProtocol(MTProtoConnection::TcpProtocol protocol); // must be called before connectToServer()
+
 public slots:
 
 	void socketRead();
@@ -152,14 +201,23 @@ public slots:
 protected:
 
 	QTcpSocket sock;
+	MTProtoConnection::TcpProtocol protocol;
 	uint32 packetNum; // sent packet number
 
-	uint32 packetRead, packetLeft; // reading from socket
-	bool readingToShort;
-	char *currentPos;
-	mtpBuffer longBuffer;
-	mtpPrime shortBuffer[MTPShortBufferSize];
-	virtual void socketPacket(mtpPrime *packet, uint32 packetSize) = 0;
+	uint32 packetRead, packetSize; // reading from socket, packetSize == 0 while reading the length
+	mtpPrime packetLength; // packet header for any of the protocols
+	mtpBuffer packetBuffer; // current packet is read right here, without any intermediate buffers
+	void preparePacketBuffer(uint32 size);
+	uint32 packetHeaderSize() const;
+	virtual void socketPacket(const mtpBuffer &packet) = 0;
+
+	void tcpSend(mtpBuffer &buffer);
+	mtpBufferSlice tcpPacketData(const mtpBuffer &packet); // returns mtpBuffer(1, error code) for a bad packet
+	QString tcpTransport() const;
+
+private:
+
+	QList<mtpBuffer> buffersPool; // buffer is free for reuse when the pool holds its only reference
 
 };
 
@@ -191,11 +249,10 @@ public slots:
 
 protected:
 
-	void socketPacket(mtpPrime *packet, uint32 packetSize);
+	void socketPacket(const mtpBuffer &packet);
 
 private:
 
-	void tcpSend(mtpBuffer &buffer);
 	void httpSend(mtpBuffer &buffer);
 	enum Status {
 		WaitingBoth = 0,
@@ -239,7 +296,7 @@ public slots:
 
 protected:
 
-	void socketPacket(mtpPrime *packet, uint32 packetSize);
+	void socketPacket(const mtpBuffer &packet);
 
 };
 
@@ -274,6 +331,32 @@ private:
 
 };
 
+class MTPdcEndpointProbe : public QObject { // measures tcp connect time to one of the dc endpoints and deletes itself
+	Q_OBJECT
+
+public:
+
+	MTPdcEndpointProbe(QObject *parent, int32 dc, const mtpDcEndpoint &endpoint);
+
+public slots:
+
+	void onConnected();
+	void onError(QAbstractSocket::SocketError e);
+	void onTimeout();
+
+private:
+
+	void finish(bool connected);
+
+	int32 _dc;
+	mtpDcEndpoint _endpoint;
+	QTcpSocket _socket;
+	QTimer _timeout;
+	uint64 _started;
+	bool _finished;
+
+};
+
 class MTProtoConnectionPrivate : public QObject {
 	Q_OBJECT
 
@@ -287,9 +370,12 @@ public:
 	int32 getState() const;
 	QString transport() const;
 
+	uint32 containersSent() const;
+	float64 containerFill() const;
+	uint64 queueDelay() const;
+
 signals:
 
-	void needToReceive();
 	void needToRestart();
 	void stateChanged(qint32 newState);
 	void sessionResetDone();
@@ -322,6 +408,7 @@ public slots:
 
 	// Sessions signals, when we need to send something
 	void tryToSend();
+	void takeQueued();
 
 	bool updateAuthKey();
 
@@ -332,14 +419,17 @@ public slots:
 private:
 
 	void createConn();
+	void probeEndpoints();
 
 	mtpMsgId prepareToSend(mtpRequest &request, mtpMsgId currentLastId);
 	mtpMsgId replaceMsgId(mtpRequest &request, mtpMsgId newId);
 
+	typedef QList<mtpRequest> SendBatch;
+	mtpRequest packToSend(SendBatch &batch, const mtpRequest &ping, bool &needAnyResponse);
 	bool sendRequest(mtpRequest &request, bool needAnyResponse);
 	mtpRequestId wasSent(mtpMsgId msgId) const;
 
-	int32 handleOneReceived(const mtpPrime *from, const mtpPrime *end, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime);
+	int32 handleOneReceived(const mtpPrime *from, const mtpPrime *end, const mtpBufferSlice &owner, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime);
 	mtpBuffer ungzip(const mtpPrime *from, const mtpPrime *end) const;
 	void handleMsgsStates(const QVector<MTPlong> &ids, const string &states, QVector<MTPlong> &acked);
 
@@ -355,6 +445,10 @@ private:
 	uint32 dc;
 	MTProtoConnection *_owner;
 	MTPabstractConnection *conn;
+	string _endpointIp; // chosen by mtpChooseDcEndpoint for the current connection
+	int32 _endpointPort;
+	bool _endpointConnected;
+	uint64 _endpointConnectStart; // getms() when the connection to the chosen endpoint was started
 
 	QTimer retryTimer; // exp retry timer
 	uint32 retryTimeout;
@@ -379,6 +473,12 @@ private:
 	mtpPingId pingId, toSendPingId;
 	mtpMsgId pingMsgId;
 
+	mutable QMutex sendStatsLock; // send scheduler counters, read from other threads
+	uint32 sentContainers;
+	uint64 sentContainersSize; // in ints
+	uint32 sentQueued;
+	uint64 sentQueuedDelay; // in ms
+
 	mtpRequestId resend(mtpMsgId msgId, uint64 msCanWait = 0, bool forceContainer = false, bool sendMsgStateInfo = false);
 
 	template <typename TRequest>
@@ -403,7 +503,9 @@ private:
 		, retries(0)
 		, g(0)
 		, req_num(0)
-		, msgs_sent(0) {
+		, msgs_sent(0)
+		, priorityLowered(false)
+		, priorityBefore(QThread::InheritPriority) {
 			memset(new_nonce_buf, 0, sizeof(new_nonce_buf));
 			memset(aesKey, 0, sizeof(aesKey));
 			memset(aesIV, 0, sizeof(aesIV));
@@ -427,6 +529,9 @@ private:
 
 		uint32 req_num; // sent not encrypted request number
 		uint32 msgs_sent;
+
+		bool priorityLowered; // for background key creation, priorityBefore is restored when this data is cleared
+		QThread::Priority priorityBefore;
 	};
 	AuthKeyCreateData *authKeyData;
 	void dhClientParamsSend();
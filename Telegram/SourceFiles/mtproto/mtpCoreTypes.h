@@ -75,8 +75,9 @@ public:
 	// in haveSent: = 0 - container with msgIds, > 0 - when was sent
 	uint64 msDate;
 	mtpRequestId requestId;
+	uint64 usQueued, usSent; // for MTP::stats(), when was queued to toSend and when was last sent
 
-	mtpRequestData(bool/* sure*/) : msDate(0) {
+	mtpRequestData(bool/* sure*/) : msDate(0), usQueued(0), usSent(0) {
 	}
 
 	static mtpRequest prepare(uint32 requestSize) {
@@ -108,6 +109,16 @@ public:
 	static bool isStateRequest(const mtpRequest &request);
 	static bool needAck(const mtpRequest &request);
 	static bool needAckByType(mtpTypeId type);
+	static mtpTypeId methodType(const mtpRequest &request); // type of the request wrapped in invokeWithLayer, if any
+
+	enum SendPriority { // requests with lower priority value are packed and sent first
+		PriorityInteractive = 0,
+		PriorityBackground,
+		PriorityBulk, // file parts
+
+		PriorityCount
+	};
+	static SendPriority sendPriority(const mtpRequest &request);
 
 private:
 
@@ -131,14 +142,52 @@ inline void mtpRequest::write(mtpBuffer &to) const {
     memcpy(to.data() + was, value->constData() + 8, s * sizeof(mtpPrime));
 }
 
-class mtpResponse : public mtpBuffer {
+class mtpBufferSlice { // part of a shared buffer, passed around without copying the data
+public:
+	mtpBufferSlice() : _offset(0), _size(0) {
+	}
+	mtpBufferSlice(const mtpBuffer &buffer) : _buffer(buffer), _offset(0), _size(buffer.size()) {
+	}
+	mtpBufferSlice(const mtpBuffer &buffer, uint32 offset, uint32 size) : _buffer(buffer), _offset(offset), _size(size) {
+	}
+
+	const mtpPrime *constData() const {
+		return _buffer.constData() + _offset;
+	}
+	mtpPrime *inplaceData() const { // writes through to every owner of the buffer, used only for received packets decryption
+		return const_cast<mtpPrime*>(constData());
+	}
+	uint32 size() const {
+		return _size;
+	}
+	bool isEmpty() const {
+		return !_size;
+	}
+	const mtpPrime &operator[](uint32 index) const {
+		return constData()[index];
+	}
+
+	mtpBufferSlice mid(const mtpPrime *from, const mtpPrime *end) const { // from and end must point inside this slice
+		return mtpBufferSlice(_buffer, from - _buffer.constData(), end - from);
+	}
+
+private:
+
+	mtpBuffer _buffer;
+	uint32 _offset, _size;
+
+};
+
+class mtpResponse : public mtpBufferSlice {
 public:
 	mtpResponse() {
 	}
-	mtpResponse(const mtpBuffer &v) : mtpBuffer(v) {
+	mtpResponse(const mtpBuffer &v) : mtpBufferSlice(v) {
+	}
+	mtpResponse(const mtpBufferSlice &v) : mtpBufferSlice(v) {
 	}
 	mtpResponse &operator=(const mtpBuffer &v) {
-		mtpBuffer::operator=(v);
+		mtpBufferSlice::operator=(mtpBufferSlice(v));
 		return (*this);
 	}
 	bool needAck() const {
@@ -151,51 +200,292 @@ public:
 typedef QMap<mtpRequestId, mtpRequest> mtpPreRequestMap;
 typedef QMap<mtpMsgId, mtpRequest> mtpRequestMap;
 
-class mtpMsgIdsSet : public QMap<mtpMsgId, bool> {
-public:	
-	typedef QMap<mtpMsgId, bool> ParentType;
+template <typename T>
+class mtpMsgIdsMap { // sorted flat buffer of msgId -> T, append of a new max msgId and removal of the min msgId are O(1)
+	struct Item {
+		mtpMsgId key;
+		T value;
+	};
+	typedef QVector<Item> Items;
 
-	bool insert(const mtpMsgId &k, bool v) {
-		ParentType::const_iterator i = constFind(k);
-		if (i == cend()) {
-			if (size() >= MTPIdsBufferSize && k < min()) {
-				MTP_LOG(-1, ("No need to handle - %1 < min = %2").arg(k).arg(min()));
-				return false;
-			} else {
-				ParentType::insert(k, v);
-				return true;
-			}
+public:
+
+	class const_iterator;
+	class iterator {
+	public:
+		iterator(Item *item = 0) : _item(item) {
+		}
+		const mtpMsgId &key() const {
+			return _item->key;
+		}
+		T &value() const {
+			return _item->value;
+		}
+		T &operator*() const {
+			return _item->value;
+		}
+		iterator &operator++() {
+			++_item;
+			return *this;
+		}
+		iterator &operator--() {
+			--_item;
+			return *this;
+		}
+		bool operator==(const iterator &other) const {
+			return _item == other._item;
+		}
+		bool operator!=(const iterator &other) const {
+			return _item != other._item;
+		}
+		bool operator==(const const_iterator &other) const;
+		bool operator!=(const const_iterator &other) const;
+
+	private:
+		Item *_item;
+		friend class const_iterator;
+		friend class mtpMsgIdsMap<T>;
+	};
+
+	class const_iterator {
+	public:
+		const_iterator(const Item *item = 0) : _item(item) {
+		}
+		const_iterator(const iterator &i) : _item(i._item) {
+		}
+		const mtpMsgId &key() const {
+			return _item->key;
+		}
+		const T &value() const {
+			return _item->value;
+		}
+		const T &operator*() const {
+			return _item->value;
+		}
+		const_iterator &operator++() {
+			++_item;
+			return *this;
+		}
+		const_iterator &operator--() {
+			--_item;
+			return *this;
+		}
+		bool operator==(const const_iterator &other) const {
+			return _item == other._item;
+		}
+		bool operator!=(const const_iterator &other) const {
+			return _item != other._item;
+		}
+
+	private:
+		const Item *_item;
+		friend class iterator;
+	};
+
+	mtpMsgIdsMap() : _start(0) {
+	}
+
+	int32 size() const {
+		return _items.size() - _start;
+	}
+	bool isEmpty() const {
+		return !size();
+	}
+	void clear() {
+		_items.clear();
+		_start = 0;
+	}
+
+	iterator begin() {
+		return iterator(_items.data() + _start);
+	}
+	iterator end() {
+		return iterator(_items.data() + _items.size());
+	}
+	const_iterator begin() const {
+		return cbegin();
+	}
+	const_iterator end() const {
+		return cend();
+	}
+	const_iterator cbegin() const {
+		return const_iterator(_items.constData() + _start);
+	}
+	const_iterator cend() const {
+		return const_iterator(_items.constData() + _items.size());
+	}
+
+	iterator find(const mtpMsgId &k) {
+		int32 i = indexOf(k);
+		return (i < _items.size() && _items.at(i).key == k) ? iterator(_items.data() + i) : end();
+	}
+	const_iterator find(const mtpMsgId &k) const {
+		return constFind(k);
+	}
+	const_iterator constFind(const mtpMsgId &k) const {
+		int32 i = indexOf(k);
+		return (i < _items.size() && _items.at(i).key == k) ? const_iterator(_items.constData() + i) : cend();
+	}
+	bool contains(const mtpMsgId &k) const {
+		return constFind(k) != cend();
+	}
+
+	iterator insert(const mtpMsgId &k, const T &v) { // replaces the value if k is already in map
+		Item item;
+		item.key = k;
+		item.value = v;
+		if (!size() || k > max()) { // new msgIds usually are the biggest ones
+			_items.push_back(item);
+			return iterator(_items.data() + _items.size() - 1);
+		}
+		int32 i = indexOf(k);
+		if (_items.at(i).key == k) {
+			_items[i].value = v;
+		} else if (i == _start && _start > 0) { // reuse the slot left after trimming
+			_items[--i] = item;
+			_start = i;
 		} else {
-			MTP_LOG(-1, ("No need to handle - %1 already is in map").arg(k));
-			return false;
+			_items.insert(i, item);
+		}
+		return iterator(_items.data() + i);
+	}
+
+	iterator erase(iterator it) {
+		int32 i = it._item - _items.constData();
+		if (i == _start) { // trimming of the oldest msgIds does not move anything
+			if (++_start == _items.size()) {
+				clear();
+			} else if (_start >= MTPIdsBufferSize && _start * 2 >= _items.size()) {
+				_items.remove(0, _start);
+				_start = 0;
+			}
+			return begin();
 		}
+		_items.remove(i);
+		return iterator(_items.data() + i);
 	}
 
 	mtpMsgId min() const {
-		return size() ? cbegin().key() : 0;
+		return size() ? _items.at(_start).key : 0;
 	}
 
 	mtpMsgId max() const {
-		ParentType::const_iterator e(cend());
-		return size() ? (--e).key() : 0;
+		return size() ? _items.at(_items.size() - 1).key : 0;
+	}
+
+private:
+
+	int32 indexOf(const mtpMsgId &k) const { // index of the first item with key >= k
+		int32 from = _start, till = _items.size();
+		while (from < till) {
+			int32 middle = (from + till) / 2;
+			if (_items.at(middle).key < k) {
+				from = middle + 1;
+			} else {
+				till = middle;
+			}
+		}
+		return from;
 	}
+
+	Items _items;
+	int32 _start;
+
 };
 
-class mtpRequestIdsMap : public QMap<mtpMsgId, mtpRequestId> {
+template <typename T>
+inline bool mtpMsgIdsMap<T>::iterator::operator==(const const_iterator &other) const {
+	return _item == other._item;
+}
+
+template <typename T>
+inline bool mtpMsgIdsMap<T>::iterator::operator!=(const const_iterator &other) const {
+	return _item != other._item;
+}
+
+class mtpMsgIdsSet : public mtpMsgIdsMap<bool> { // msgId -> needAck
 public:
-	typedef QMap<mtpMsgId, mtpRequestId> ParentType;
+	typedef mtpMsgIdsMap<bool> ParentType;
 
-	mtpMsgId min() const {
-		return size() ? cbegin().key() : 0;
+	bool insert(const mtpMsgId &k, bool v) {
+		if (size() && k <= max() && constFind(k) != cend()) {
+			MTP_LOG(-1, ("No need to handle - %1 already is in map").arg(k));
+			return false;
+		}
+		if (size() >= MTPIdsBufferSize && k < min()) {
+			MTP_LOG(-1, ("No need to handle - %1 < min = %2").arg(k).arg(min()));
+			return false;
+		}
+		ParentType::insert(k, v);
+		return true;
 	}
+};
 
-	mtpMsgId max() const {
-		ParentType::const_iterator e(cend());
-		return size() ? (--e).key() : 0;
+typedef mtpMsgIdsMap<mtpRequestId> mtpRequestIdsMap;
+
+template <typename T>
+class mtpLockFreeQueue { // many producer threads, one consumer at a time, push() never blocks
+public:
+
+	mtpLockFreeQueue() : _head(&_stub), _tail(&_stub) {
 	}
-};
 
-typedef QMap<mtpRequestId, mtpResponse> mtpResponseMap;
+	void push(const T &value) {
+		pushNode(new Node(value));
+	}
+
+	bool pop(T &value) { // only one thread can pop at the same time
+		Node *tail = _tail, *next = tail->next.loadAcquire();
+		if (tail == &_stub) {
+			if (!next) return false;
+
+			_tail = tail = next;
+			next = next->next.loadAcquire();
+		}
+		if (!next) {
+			if (tail != _head.loadAcquire()) return false; // some producer did not finish push() yet
+
+			pushNode(&_stub);
+			next = tail->next.loadAcquire();
+			if (!next) return false;
+		}
+		_tail = next;
+		value = tail->value;
+		delete tail;
+		return true;
+	}
+
+	~mtpLockFreeQueue() {
+		T value;
+		while (pop(value)) {
+		}
+	}
+
+private:
+
+	struct Node {
+		Node() : next(0) {
+		}
+		Node(const T &value) : next(0), value(value) {
+		}
+		QAtomicPointer<Node> next;
+		T value;
+	};
+
+	void pushNode(Node *node) {
+		node->next.store(0);
+		Node *prev = _head.fetchAndStoreOrdered(node);
+		prev->next.storeRelease(node);
+	}
+
+	QAtomicPointer<Node> _head; // last pushed node
+	Node *_tail; // next node to pop, used only by the consumer
+	Node _stub;
+
+	mtpLockFreeQueue(const mtpLockFreeQueue &other);
+	mtpLockFreeQueue &operator=(const mtpLockFreeQueue &other);
+
+};
 
 class mtpErrorUnexpected : public Exception {
 public:
@@ -233,6 +523,27 @@ public:
 	}
 };
 
+class mtpArenaBlock;
+class mtpArenaScope { // while it lives, data of MTP objects created in this thread is allocated from one arena
+public:
+	mtpArenaScope();
+	~mtpArenaScope();
+
+	static void *allocate(size_t size); // from the arena of the current thread or from heap, if there is no arena
+	static void free(void *p); // from any thread, arena block is freed after all its objects are freed
+
+#ifdef TDESKTOP_BENCHMARK
+	static uint32 heapAllocations(); // arena blocks and objects allocated from heap since start
+#endif
+
+private:
+	mtpArenaScope(const mtpArenaScope &other);
+	mtpArenaScope &operator=(const mtpArenaScope &other);
+
+	mtpArenaScope *_prev;
+	mtpArenaBlock *_block;
+};
+
 class mtpData {
 public:
 	mtpData() : cnt(1) {
@@ -240,6 +551,13 @@ public:
     mtpData(const mtpData &) : cnt(1) {
 	}
 
+	static void *operator new(size_t size) {
+		return mtpArenaScope::allocate(size);
+	}
+	static void operator delete(void *p) {
+		mtpArenaScope::free(p);
+	}
+
 	mtpData *incr() {
 		++cnt;
 		return this;
@@ -417,6 +735,11 @@ public:
 		if (cons != mtpc_int) throw mtpErrorUnexpected(cons, "MTPint");
 		v = (int32)*(from++);
 	}
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int) {
+		if (from + 1 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_int) throw mtpErrorUnexpected(cons, "MTPint");
+		from += 1;
+	}
 	void write(mtpBuffer &to) const {
 		to.push_back((mtpPrime)v);
 	}
@@ -461,6 +784,11 @@ public:
 		v = (uint64)(((uint32*)from)[0]) | ((uint64)(((uint32*)from)[1]) << 32);
 		from += 2;
 	}
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_long) {
+		if (from + 2 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_long) throw mtpErrorUnexpected(cons, "MTPlong");
+		from += 2;
+	}
 	void write(mtpBuffer &to) const {
 		to.push_back((mtpPrime)(v & 0xFFFFFFFFL));
 		to.push_back((mtpPrime)(v >> 32));
@@ -508,6 +836,11 @@ public:
 		h = (uint64)(((uint32*)from)[2]) | ((uint64)(((uint32*)from)[3]) << 32);
 		from += 4;
 	}
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int128) {
+		if (from + 4 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_int128) throw mtpErrorUnexpected(cons, "MTPint128");
+		from += 4;
+	}
 	void write(mtpBuffer &to) const {
 		to.push_back((mtpPrime)(l & 0xFFFFFFFFL));
 		to.push_back((mtpPrime)(l >> 32));
@@ -555,6 +888,11 @@ public:
 		l.read(from, end);
 		h.read(from, end);
 	}
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int256) {
+		if (from + 8 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_int256) throw mtpErrorUnexpected(cons, "MTPint256");
+		from += 8;
+	}
 	void write(mtpBuffer &to) const {
 		l.write(to);
 		h.write(to);
@@ -600,6 +938,11 @@ public:
 		*(uint64*)(&v) = (uint64)(((uint32*)from)[0]) | ((uint64)(((uint32*)from)[1]) << 32);
 		from += 2;
 	}
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_double) {
+		if (from + 2 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_double) throw mtpErrorUnexpected(cons, "MTPdouble");
+		from += 2;
+	}
 	void write(mtpBuffer &to) const {
 		uint64 iv = *(uint64*)(&v);
 		to.push_back((mtpPrime)(iv & 0xFFFFFFFFL));
@@ -637,7 +980,7 @@ public:
 	MTPDstring(const char *val) : v(val) {
 	}
 
-	string v;
+	string v; // only MTPDstring itself is taken from the arena, the contents are always on heap
 };
 
 class MTPstring : private mtpDataOwner {
@@ -694,6 +1037,20 @@ public:
 		v.v.resize(l);
 		memcpy(&v.v[0], buf, l);
 	}
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_string) {
+		if (from + 1 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_string) throw mtpErrorUnexpected(cons, "MTPstring");
+
+		const uchar *buf = (const uchar*)from;
+		if (buf[0] == 254) {
+			uint32 l = (uint32)buf[1] + ((uint32)buf[2] << 8) + ((uint32)buf[3] << 16);
+			from += ((l + 4) >> 2) + (((l + 4) & 0x03) ? 1 : 0);
+		} else {
+			uint32 l = (uint32)buf[0];
+			from += ((l + 1) >> 2) + (((l + 1) & 0x03) ? 1 : 0);
+		}
+		if (from > end) throw mtpErrorInsufficient();
+	}
 	void write(mtpBuffer &to) const {
 		uint32 l = c_string().v.length(), s = l + ((l < 254) ? 1 : 4), was = to.size();
 		if (s & 0x03) {
@@ -775,6 +1132,9 @@ public:
 			default: throw mtpErrorUnexpected(cons, "MTPbool");
 		}
 	}
+	static void skip(const mtpPrime *& /*from*/, const mtpPrime * /*end*/, mtpTypeId cons) {
+		if (cons != mtpc_boolFalse && cons != mtpc_boolTrue) throw mtpErrorUnexpected(cons, "MTPbool");
+	}
 	void write(mtpBuffer & /*to*/) const {
 	}
 
@@ -913,6 +1273,93 @@ inline bool operator!=(const MTPvector<T> &a, const MTPvector<T> &b) {
 	return a.c_vector().v != b.c_vector().v;
 }
 
+// Views read fields right from the serialized data when they are accessed, MTP*View classes are generated in mtpScheme.h
+// T is a view or a core type, that has T(from, end[, cons]) constructor and static T::skip(from, end[, cons])
+
+inline mtpTypeId mtpReadTypeId(const mtpPrime *&from, const mtpPrime *end) {
+	if (from + 1 > end) throw mtpErrorInsufficient();
+	return (mtpTypeId)*(from++);
+}
+
+template <typename T>
+class MTPBoxedView : public T {
+public:
+	MTPBoxedView(const mtpPrime *&from, const mtpPrime *end) : T(from, end, mtpReadTypeId(from, end)) {
+	}
+
+	static void skip(const mtpPrime *&from, const mtpPrime *end) {
+		mtpTypeId cons = mtpReadTypeId(from, end);
+		T::skip(from, end, cons);
+	}
+};
+
+template <typename T>
+class MTPvectorView {
+public:
+	MTPvectorView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_vector) : _from(from) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	uint32 count() const {
+		return (uint32)*_from;
+	}
+
+	class const_iterator {
+	public:
+		const_iterator(const mtpPrime *from, const mtpPrime *end, uint32 left) : _from(from), _end(end), _left(left) {
+		}
+
+		T operator*() const {
+			const mtpPrime *from = _from;
+			return T(from, _end);
+		}
+		const_iterator &operator++() {
+			T::skip(_from, _end);
+			--_left;
+			return *this;
+		}
+		bool operator==(const const_iterator &other) const {
+			return _left == other._left;
+		}
+		bool operator!=(const const_iterator &other) const {
+			return _left != other._left;
+		}
+
+	private:
+		const mtpPrime *_from, *_end;
+		uint32 _left;
+	};
+	const_iterator cbegin() const {
+		return const_iterator(_from + 1, _end, count());
+	}
+	const_iterator cend() const {
+		return const_iterator(_end, _end, 0);
+	}
+
+	template <typename V>
+	V read() const { // materializes the vector as V, for example MTPvector<MTPUser>
+		const mtpPrime *from = _from;
+		return V(from, _end);
+	}
+	void copyTo(mtpBuffer &to) const { // keeps the serialized vector to be read by MTPvectorView later
+		to.resize(_end - _from);
+		memcpy(to.data(), _from, (_end - _from) * sizeof(mtpPrime));
+	}
+
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_vector) {
+		if (from + 1 > end) throw mtpErrorInsufficient();
+		if (cons != mtpc_vector) throw mtpErrorUnexpected(cons, "MTPvector");
+		uint32 count = (uint32)*(from++);
+		for (uint32 i = 0; i < count; ++i) {
+			T::skip(from, end);
+		}
+	}
+
+private:
+	const mtpPrime *_from, *_end; // _from points to the elements count
+};
+
 class MTPDerror : public mtpDataImpl<MTPDerror> {
 public:
 	MTPint vcode;
@@ -31,6 +31,25 @@ namespace {
 	_KeysMapForWrite _keysMapForWrite;
 	QMutex _keysMapForWriteMutex;
 
+	typedef QMap<int32, mtpDcEndpoints> _DcEndpoints; // dc without shift -> all its endpoints from config
+	_DcEndpoints _dcEndpoints;
+	QMutex _dcEndpointsMutex;
+
+	mtpDcEndpoint *_findDcEndpoint(mtpDcEndpoints &endpoints, const string &ip, int32 port) {
+		for (mtpDcEndpoints::iterator i = endpoints.begin(), e = endpoints.end(); i != e; ++i) {
+			if (i->ip == ip && i->port == port) return &*i;
+		}
+		return 0;
+	}
+
+	int32 _dcEndpointScore(const mtpDcEndpoint &endpoint) {
+		return (endpoint.rtt ? endpoint.rtt : int32(MTPDcEndpointUnknownRtt)) + endpoint.failures * MTPDcEndpointFailurePenalty;
+	}
+
+	typedef QMap<int32, mtpSessionState> _SessionStates; // dc with shift -> state
+	_SessionStates _sessionStates;
+	QMutex _sessionStatesMutex;
+
 	int32 readAuthKeysFields(QIODevice *io) {
 		if (!io->isOpen()) io->open(QIODevice::ReadOnly);
 
@@ -112,6 +131,39 @@ namespace {
 				}
 			} break;
 
+			case dbiSessionState: {
+				qint32 dcId;
+				quint64 keyId, session, salt;
+				quint32 messagesSent, saltsCount;
+				stream >> dcId >> keyId >> session >> salt >> messagesSent >> saltsCount;
+
+				mtpSessionState state;
+				for (quint32 i = 0; i < saltsCount && stream.status() == QDataStream::Ok; ++i) {
+					qint32 validSince, validUntil;
+					quint64 futureSalt;
+					stream >> validSince >> validUntil >> futureSalt;
+					state.futureSalts.push_back(mtpFutureSalt(validSince, validUntil, futureSalt));
+				}
+				if (stream.status() == QDataStream::Ok) {
+					DEBUG_LOG(("MTP Info: session state found, dc %1, session %2, salt %3, future salts %4").arg(dcId).arg(session).arg(salt).arg(saltsCount));
+					state.keyId = keyId;
+					state.session = session;
+					state.salt = salt;
+					state.messagesSent = messagesSent;
+
+					QMutexLocker lock(&_sessionStatesMutex);
+					_sessionStates.insert(dcId, state);
+				}
+			} break;
+
+			case dbiUnixtimeDelta: {
+				qint32 delta;
+				stream >> delta;
+				if (stream.status() == QDataStream::Ok) {
+					unixtimeRestore(delta);
+				}
+			} break;
+
 			case dbiUser: {
 				quint32 dcId;
 				qint32 uid;
@@ -232,10 +284,21 @@ namespace {
 	typedef QVector<mtpAuthKeyPtr> _KeysToWrite;
 	void writeAuthKeys() {
 		_KeysToWrite keysToWrite;
+		QMap<int32, uint64> keyIds;
 		{
 			QMutexLocker lock(&_keysMapForWriteMutex);
 			for (_KeysMapForWrite::const_iterator i = _keysMapForWrite.cbegin(), e = _keysMapForWrite.cend(); i != e; ++i) {
 				keysToWrite.push_back(i.value());
+				keyIds.insert(i.key(), i.value()->keyId());
+			}
+		}
+		_SessionStates statesToWrite;
+		{
+			QMutexLocker lock(&_sessionStatesMutex);
+			for (_SessionStates::const_iterator i = _sessionStates.cbegin(), e = _sessionStates.cend(); i != e; ++i) {
+				if (keyIds.value(i.key() % _mtp_internal::dcShift) == i.value().keyId) { // states of destroyed keys are dropped
+					statesToWrite.insert(i.key(), i.value());
+				}
 			}
 		}
 
@@ -256,6 +319,15 @@ namespace {
 					stream << quint32(dbiKey) << quint32((*i)->getDC());
 					(*i)->write(stream);
 				}
+				for (_SessionStates::const_iterator i = statesToWrite.cbegin(), e = statesToWrite.cend(); i != e; ++i) {
+					const mtpSessionState &state(i.value());
+					stream << quint32(dbiSessionState) << qint32(i.key()) << quint64(state.keyId) << quint64(state.session) << quint64(state.salt) << quint32(state.messagesSent);
+					stream << quint32(state.futureSalts.size());
+					for (mtpFutureSalts::const_iterator j = state.futureSalts.cbegin(), end = state.futureSalts.cend(); j != end; ++j) {
+						stream << qint32(j->validSince) << qint32(j->validUntil) << quint64(j->salt);
+					}
+				}
+				stream << quint32(dbiUnixtimeDelta) << qint32(unixtime() - myunixtime());
 
 				if (stream.status() != QDataStream::Ok) {
 					LOG(("MTP Error: could not write keys to memory buf, status: %1").arg(stream.status()));
@@ -301,6 +373,24 @@ void mtpLoadData() {
 	static _KeysReader keysReader;
 }
 
+void mtpSaveSessionState(int32 dcWithShift, const mtpSessionState &state) {
+	QMutexLocker lock(&_sessionStatesMutex);
+	_sessionStates[dcWithShift] = state;
+}
+
+bool mtpRestoreSessionState(int32 dcWithShift, mtpSessionState &state) {
+	QMutexLocker lock(&_sessionStatesMutex);
+	_SessionStates::const_iterator i = _sessionStates.constFind(dcWithShift);
+	if (i == _sessionStates.cend()) return false;
+
+	state = i.value();
+	return true;
+}
+
+void mtpWriteAuthKeys() {
+	writeAuthKeys();
+}
+
 int32 mtpAuthed() {
 	return userId;
 }
@@ -423,17 +513,41 @@ namespace {
 
 void mtpUpdateDcOptions(const QVector<MTPDcOption> &options) {
 	QSet<int32> already, restart;
+	_DcEndpoints endpoints;
 	for (QVector<MTPDcOption>::const_iterator i = options.cbegin(), e = options.cend(); i != e; ++i) {
 		const MTPDdcOption &optData(i->c_dcOption());
+		const string &ip(optData.vip_address.c_string().v);
+		if (!_findDcEndpoint(endpoints[optData.vid.v], ip, optData.vport.v)) {
+			endpoints[optData.vid.v].push_back(mtpDcEndpoint(ip, optData.vport.v));
+		}
 		if (already.constFind(optData.vid.v) == already.cend()) {
 			already.insert(optData.vid.v);
 			mtpDcOptions::const_iterator a = gDCOptions.constFind(optData.vid.v);
 			if (a != gDCOptions.cend()) {
-				if (a.value().ip != optData.vip_address.c_string().v || a.value().port != optData.vport.v) {
+				if (a.value().ip != ip || a.value().port != optData.vport.v) {
 					restart.insert(optData.vid.v);
 				}
 			}
-			gDCOptions.insert(optData.vid.v, mtpDcOption(optData.vid.v, optData.vhostname.c_string().v, optData.vip_address.c_string().v, optData.vport.v));
+			gDCOptions.insert(optData.vid.v, mtpDcOption(optData.vid.v, optData.vhostname.c_string().v, ip, optData.vport.v));
+		}
+	}
+	{
+		QMutexLocker lock(&_dcEndpointsMutex);
+		for (_DcEndpoints::iterator i = endpoints.begin(), e = endpoints.end(); i != e; ++i) {
+			mtpDcEndpoints &was(_dcEndpoints[i.key()]);
+			bool changed = (was.size() != i.value().size());
+			for (mtpDcEndpoints::iterator j = i.value().begin(), ej = i.value().end(); j != ej; ++j) {
+				mtpDcEndpoint *known = _findDcEndpoint(was, j->ip, j->port);
+				if (known) {
+					*j = *known;
+				} else {
+					changed = true;
+				}
+			}
+			if (changed && !was.isEmpty()) { // connections may use a removed endpoint
+				restart.insert(i.key());
+			}
+			was = i.value();
 		}
 	}
 	for (QSet<int32>::const_iterator i = restart.cbegin(), e = restart.cend(); i != e; ++i) {
@@ -441,6 +555,88 @@ void mtpUpdateDcOptions(const QVector<MTPDcOption> &options) {
 	}
 }
 
+bool mtpChooseDcEndpoint(int32 dc, string &ip, int32 &port) {
+	{
+		QMutexLocker lock(&_dcEndpointsMutex);
+		_DcEndpoints::const_iterator i = _dcEndpoints.constFind(dc);
+		if (i != _dcEndpoints.cend() && !i.value().isEmpty()) {
+			const mtpDcEndpoint *best = 0;
+			for (mtpDcEndpoints::const_iterator j = i.value().cbegin(), e = i.value().cend(); j != e; ++j) {
+				if (!best || _dcEndpointScore(*j) < _dcEndpointScore(*best)) { // first in config order wins ties
+					best = &*j;
+				}
+			}
+			ip = best->ip;
+			port = best->port;
+			return true;
+		}
+	}
+
+	mtpDcOptions::const_iterator i = gDCOptions.constFind(dc);
+	if (i == gDCOptions.cend()) return false;
+
+	ip = i->ip;
+	port = i->port;
+	return true;
+}
+
+mtpDcEndpoints mtpDcEndpointsToProbe(int32 dc) {
+	mtpDcEndpoints result;
+
+	QMutexLocker lock(&_dcEndpointsMutex);
+	_DcEndpoints::iterator i = _dcEndpoints.find(dc);
+	if (i == _dcEndpoints.end() || i.value().size() < 2) return result; // nothing to choose from
+
+	uint64 ms = getms();
+	for (mtpDcEndpoints::iterator j = i.value().begin(), e = i.value().end(); j != e; ++j) {
+		if (!j->probed || j->probed + MTPDcEndpointProbeInterval <= ms) {
+			j->probed = ms;
+			result.push_back(*j);
+		}
+	}
+	return result;
+}
+
+void mtpDcEndpointRtt(int32 dc, const string &ip, int32 port, int32 ms) {
+	QMutexLocker lock(&_dcEndpointsMutex);
+	mtpDcEndpoint *endpoint = _findDcEndpoint(_dcEndpoints[dc], ip, port);
+	if (!endpoint) return;
+
+	ms = qMax(ms, 1);
+	endpoint->rtt = endpoint->rtt ? ((endpoint->rtt * 7 + ms) / 8) : ms;
+	endpoint->failures = 0;
+	DEBUG_LOG(("MTP Info: dc %1 endpoint %2:%3 connected in %4ms, rtt estimate %5ms").arg(dc).arg(ip.c_str()).arg(port).arg(ms).arg(endpoint->rtt));
+}
+
+void mtpDcEndpointFailed(int32 dc, const string &ip, int32 port) {
+	QMutexLocker lock(&_dcEndpointsMutex);
+	mtpDcEndpoint *endpoint = _findDcEndpoint(_dcEndpoints[dc], ip, port);
+	if (!endpoint) return;
+
+	if (endpoint->failures < MTPDcEndpointFailuresMax) ++endpoint->failures;
+	DEBUG_LOG(("MTP Info: dc %1 endpoint %2:%3 failed, %4 failures in a row").arg(dc).arg(ip.c_str()).arg(port).arg(endpoint->failures));
+}
+
+#ifdef TDESKTOP_BENCHMARK
+void mtpSetBenchmarkDc(int32 dc, const string &ip, int32 port, const mtpAuthKeyPtr &key) {
+	mtpLoadData(); // built in dcs are added here, so it must be done before they are replaced
+
+	gDCOptions.clear();
+	gDCOptions.insert(dc, mtpDcOption(dc, ip, ip, port));
+	gDCs.clear();
+	gDCs.insert(dc, MTProtoDCPtr(new MTProtoDC(dc, key)));
+	mainDC = dc;
+	configLoadedOnce = true; // the stand-in server does not answer help.getConfig
+
+	{
+		QMutexLocker lock(&_dcEndpointsMutex);
+		_dcEndpoints.clear();
+	}
+	QMutexLocker lock(&_keysMapForWriteMutex);
+	_keysMapForWrite.clear();
+}
+#endif
+
 MTProtoConfigLoader::MTProtoConfigLoader() : _enumCurrent(0), _enumRequest(0) {
 	connect(&_enumDCTimer, SIGNAL(timeout()), this, SLOT(enumDC()));
 	_enumDCTimer.setSingleShot(true);
@@ -502,6 +698,13 @@ void mtpWriteConfig(QDataStream &stream) {
 		for (mtpDcOptions::const_iterator i = gDCOptions.cbegin(), e = gDCOptions.cend(); i != e; ++i) {
 			stream << quint32(dbiDcOption) << i->id << QString(i->host.c_str()) << QString(i->ip.c_str()) << i->port;
 		}
+
+		QMutexLocker lock(&_dcEndpointsMutex);
+		for (_DcEndpoints::const_iterator i = _dcEndpoints.cbegin(), e = _dcEndpoints.cend(); i != e; ++i) {
+			for (mtpDcEndpoints::const_iterator j = i.value().cbegin(), ej = i.value().cend(); j != ej; ++j) {
+				stream << quint32(dbiDcEndpoint) << quint32(i.key()) << QString(j->ip.c_str()) << qint32(j->port) << qint32(j->rtt) << qint32(j->failures);
+			}
+		}
 		stream << quint32(dbiConfig1) << qint32(cMaxGroupCount());
 	}
 }
@@ -532,6 +735,23 @@ bool mtpReadConfigElem(int32 blockId, QDataStream &stream) {
 		}
 	} break;
 
+	case dbiDcEndpoint: {
+		quint32 dcId;
+		QString ip;
+		qint32 port, rtt, failures;
+		stream >> dcId >> ip >> port >> rtt >> failures;
+
+		if (stream.status() == QDataStream::Ok) {
+			QMutexLocker lock(&_dcEndpointsMutex);
+			mtpDcEndpoints &endpoints(_dcEndpoints[dcId]);
+			string ipString(ip.toUtf8().constData());
+			if (!_findDcEndpoint(endpoints, ipString, port)) {
+				endpoints.push_back(mtpDcEndpoint(ipString, port, rtt, failures));
+			}
+			return true;
+		}
+	} break;
+
 	case dbiConfig1: {
 		quint32 maxSize;
 		stream >> maxSize;
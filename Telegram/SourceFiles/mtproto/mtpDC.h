@@ -78,6 +78,36 @@ struct mtpDcOption {
 };
 typedef QMap<int, mtpDcOption> mtpDcOptions;
 
+struct mtpDcEndpoint { // one of the ip:port pairs a dc is available at
+	mtpDcEndpoint(const string &ip = string(), int32 port = 0, int32 rtt = 0, int32 failures = 0) : ip(ip), port(port), rtt(rtt), failures(failures), probed(0) {
+	}
+
+	string ip;
+	int32 port;
+	int32 rtt; // rolling tcp connect time estimate in ms, 0 if not measured yet
+	int32 failures; // in a row
+	uint64 probed; // getms() of the last probe start, not written
+};
+typedef QVector<mtpDcEndpoint> mtpDcEndpoints;
+
+struct mtpFutureSalt {
+	mtpFutureSalt(int32 validSince = 0, int32 validUntil = 0, uint64 salt = 0) : validSince(validSince), validUntil(validUntil), salt(salt) {
+	}
+
+	int32 validSince, validUntil;
+	uint64 salt;
+};
+typedef QVector<mtpFutureSalt> mtpFutureSalts; // sorted by validSince
+
+struct mtpSessionState { // written with the auth keys, so that the next launch continues the session with a valid salt
+	mtpSessionState() : keyId(0), session(0), salt(0), messagesSent(0) {
+	}
+
+	uint64 keyId, session, salt;
+	uint32 messagesSent;
+	mtpFutureSalts futureSalts;
+};
+
 class MTProtoConfigLoader : public QObject {
 	Q_OBJECT
 
@@ -114,6 +144,14 @@ void mtpLogoutOtherDCs();
 void mtpSetDC(int32 dc);
 uint32 mtpMaxChatSize();
 
+bool mtpChooseDcEndpoint(int32 dc, string &ip, int32 &port); // fastest healthy endpoint, first dc option if none measured, false if dc is unknown
+mtpDcEndpoints mtpDcEndpointsToProbe(int32 dc); // endpoints not probed for MTPDcEndpointProbeInterval, marked as probed now
+void mtpDcEndpointRtt(int32 dc, const string &ip, int32 port, int32 ms);
+void mtpDcEndpointFailed(int32 dc, const string &ip, int32 port);
+
+void mtpSaveSessionState(int32 dcWithShift, const mtpSessionState &state);
+bool mtpRestoreSessionState(int32 dcWithShift, mtpSessionState &state); // false if nothing was saved for this dc
+
 void mtpWriteAuthKeys();
 void mtpLoadData();
 int32 mtpAuthed();
@@ -123,3 +161,7 @@ void mtpWriteConfig(QDataStream &stream);
 bool mtpReadConfigElem(int32 blockId, QDataStream &stream);
 
 void mtpUpdateDcOptions(const QVector<MTPDcOption> &options);
+
+#ifdef TDESKTOP_BENCHMARK
+void mtpSetBenchmarkDc(int32 dc, const string &ip, int32 port, const mtpAuthKeyPtr &key); // the only dc, before MTP::start() while there are no connection threads, nothing about it is written
+#endif
@@ -35,7 +35,8 @@ namespace {
 }
 
 mtpFileLoader::mtpFileLoader(int32 dc, const int64 &volume, int32 local, const int64 &secret) : prev(0), next(0),
-    priority(0), inQueue(false), complete(false), requestId(0),
+    priority(0), inQueue(false), complete(false),
+    nextOffset(0), endOffset(-1), partSize(DownloadPartSize), loadedSize(0), partGrow(false),
     dc(dc), locationType(0), volume(volume), local(local), secret(secret),
     id(0), access(0), initialSize(0), size(0), type(MTP_storage_fileUnknown()) {
 	LoaderQueues::iterator i = queues.find(dc);
@@ -46,9 +47,10 @@ mtpFileLoader::mtpFileLoader(int32 dc, const int64 &volume, int32 local, const i
 }
 
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &id, const uint64 &access, mtpTypeId locType, const QString &to, int32 size) : prev(0), next(0),
-priority(0), inQueue(false), complete(false), requestId(0),
+priority(0), inQueue(false), complete(false),
+nextOffset(0), endOffset(size > 0 ? size : -1), partSize(DocumentDownloadPartSize), loadedSize(0), partGrow(false),
 dc(dc), locationType(locType),
-id(id), access(access), file(to), duplicateInData(false), initialSize(size), type(MTP_storage_fileUnknown()) {
+id(id), access(access), file(to), duplicateInData(false), initialSize(size), size(size), type(MTP_storage_fileUnknown()) {
 	LoaderQueues::iterator i = queues.find(MTP::dld + dc);
 	if (i == queues.cend()) {
 		i = queues.insert(MTP::dld + dc, mtpFileLoaderQueue());
@@ -57,9 +59,10 @@ id(id), access(access), file(to), duplicateInData(false), initialSize(size), typ
 }
 
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &id, const uint64 &access, mtpTypeId locType, const QString &to, int32 size, bool todata) : prev(0), next(0),
-priority(0), inQueue(false), complete(false), requestId(0),
+priority(0), inQueue(false), complete(false),
+nextOffset(0), endOffset(size > 0 ? size : -1), partSize(DocumentDownloadPartSize), loadedSize(0), partGrow(false),
 dc(dc), locationType(locType),
-id(id), access(access), file(to), duplicateInData(todata), initialSize(size), type(MTP_storage_fileUnknown()) {
+id(id), access(access), file(to), duplicateInData(todata), initialSize(size), size(size), type(MTP_storage_fileUnknown()) {
 	LoaderQueues::iterator i = queues.find(MTP::dld + dc);
 	if (i == queues.cend()) {
 		i = queues.insert(MTP::dld + dc, mtpFileLoaderQueue());
@@ -90,7 +93,7 @@ float64 mtpFileLoader::currentProgress() const {
 }
 
 int32 mtpFileLoader::currentOffset() const {
-	return file.isOpen() ? file.size() : data.size();
+	return loadedSize;
 }
 
 int32 mtpFileLoader::fullSize() const {
@@ -110,16 +113,15 @@ uint64 mtpFileLoader::objId() const {
 void mtpFileLoader::loadNext() {
 	if (queue->queries >= MaxFileQueries) return;
 	for (mtpFileLoader *i = queue->start; i; i = i->next) {
-		if (i->loadPart() && queue->queries >= MaxFileQueries) return;
+		while (i->loadPart()) {
+			if (queue->queries >= MaxFileQueries) return;
+		}
 	}
 }
 
 void mtpFileLoader::finishFail() {
 	bool started = currentOffset() > 0;
-	if (requestId) {
-		requestId = 0;
-		--queue->queries;
-	}
+	cancelRequests();
 	type = MTP_storage_fileUnknown();
 	complete = true;
 	if (file.isOpen()) {
@@ -132,13 +134,21 @@ void mtpFileLoader::finishFail() {
 	loadNext();
 }
 
+void mtpFileLoader::cancelRequests() {
+	for (PartRequests::const_iterator i = requests.cbegin(), e = requests.cend(); i != e; ++i) {
+		MTP::cancel(i.value().requestId);
+		--queue->queries;
+	}
+	requests.clear();
+}
+
 bool mtpFileLoader::loadPart() {
-	if (complete || requestId) return false;
+	if (complete || requests.size() >= (endOffset >= 0 ? DownloadPartsInFlight : 1)) return false; // dont request past the unknown file end
+	if (endOffset >= 0 && nextOffset >= endOffset) return false;
 
-	int32 limit = DocumentDownloadPartSize;
 	MTPInputFileLocation loc;
 	switch (locationType) {
-	case 0: loc = MTP_inputFileLocation(MTP_long(volume), MTP_int(local), MTP_long(secret)); limit = DownloadPartSize; break;
+	case 0: loc = MTP_inputFileLocation(MTP_long(volume), MTP_int(local), MTP_long(secret)); break;
 	case mtpc_inputVideoFileLocation: loc = MTP_inputVideoFileLocation(MTP_long(id), MTP_long(access)); break;
 	case mtpc_inputAudioFileLocation: loc = MTP_inputAudioFileLocation(MTP_long(id), MTP_long(access)); break;
 	case mtpc_inputDocumentFileLocation: loc = MTP_inputDocumentFileLocation(MTP_long(id), MTP_long(access)); break;
@@ -148,54 +158,85 @@ bool mtpFileLoader::loadPart() {
 	break;
 	}
 
+	if (partGrow && !(nextOffset % (partSize * 2))) { // parts never cross the multiple of their size, so never cross a 1mb boundary
+		partSize *= 2;
+		partGrow = false;
+	}
+
 	++queue->queries;
-	int32 offset = currentOffset();
+	int32 offset = nextOffset, limit = partSize;
+	nextOffset += limit;
+
 	MTPupload_GetFile request(MTPupload_getFile(loc, MTP_int(offset), MTP_int(limit)));
-	requestId = MTP::send(request, rpcDone(&mtpFileLoader::partLoaded, offset), rpcFail(&mtpFileLoader::partFailed), MTP::dld + dc, 50);
+	requests.insert(offset, PartRequest(MTP::send(request, rpcDone(&mtpFileLoader::partLoaded, offset), rpcFail(&mtpFileLoader::partFailed), MTP::dld + dc, 50), limit));
 	return true;
 }
 
 void mtpFileLoader::partLoaded(int32 offset, const MTPupload_File &result) {
-	if (requestId) {
-		--queue->queries;
-		requestId = 0;
+	PartRequests::iterator i = requests.find(offset);
+	if (i == requests.end()) return;
+
+	PartRequest req(i.value());
+	requests.erase(i);
+	--queue->queries;
+
+	const MTPDupload_file &d(result.c_upload_file());
+	const string &bytes(d.vbytes.c_string().v);
+	int32 bytesSize = bytes.size();
+	if (bytesSize) {
+		if (file.isOpen()) {
+			if (!file.seek(offset) || file.write(bytes.data(), bytesSize) != qint64(bytesSize)) {
+				return finishFail();
+			}
+		} else {
+			if (data.size() < offset + bytesSize) {
+				data.resize(offset + bytesSize);
+			}
+			memcpy(data.data() + offset, bytes.data(), bytesSize);
+		}
+		loadedSize += bytesSize;
 	}
-	if (offset == currentOffset()) {
-		int32 limit = locationType ? DocumentDownloadPartSize : DownloadPartSize;
-		const MTPDupload_file &d(result.c_upload_file());
-		const string &bytes(d.vbytes.c_string().v);
-		if (bytes.size()) {
-			if (file.isOpen()) {
-				if (file.write(bytes.data(), bytes.size()) != qint64(bytes.size())) {
-					return finishFail();
-				}
-			} else {
-				data.append(bytes.data(), bytes.size());
+
+	if (bytesSize == req.limit && !(bytesSize % 1024)) { // good next offset
+		if (req.limit == partSize && partSize < DocumentDownloadPartSizeMax && locationType && getms() - req.sent < DownloadPartGrowTimeout) {
+			partGrow = true;
+		}
+	} else if (endOffset < 0 || offset + bytesSize < endOffset) { // file end found, parts after it are not needed
+		endOffset = offset + bytesSize;
+		for (PartRequests::iterator j = requests.lowerBound(endOffset); j != requests.end();) {
+			MTP::cancel(j.value().requestId);
+			--queue->queries;
+			j = requests.erase(j);
+		}
+	}
+
+	if (endOffset >= 0 && nextOffset >= endOffset && requests.isEmpty()) {
+		if (file.isOpen()) {
+			if (file.size() > endOffset && !file.resize(endOffset)) {
+				return finishFail();
 			}
+		} else if (data.size() > endOffset) {
+			data.resize(endOffset);
 		}
-		if (bytes.size() && !(bytes.size() % 1024)) { // good next offset
-//			offset += bytes.size();
-		} else {
-			if (duplicateInData && !file.fileName().isEmpty()) {
-				if (!file.open(QIODevice::WriteOnly)) {
-					return finishFail();
-				}
-				if (file.write(data) != qint64(data.size())) {
-					return finishFail();
-				}
+		if (duplicateInData && !file.fileName().isEmpty()) {
+			if (!file.open(QIODevice::WriteOnly)) {
+				return finishFail();
 			}
-			type = d.vtype;
-			complete = true;
-			if (file.isOpen()) {
-				file.close();
-				psPostprocessFile(QFileInfo(file).absoluteFilePath());
+			if (file.write(data) != qint64(data.size())) {
+				return finishFail();
 			}
-			removeFromQueue();
-			App::wnd()->update();
-			App::wnd()->notifyUpdateAllPhotos();
 		}
-		emit progress(this);
+		type = d.vtype;
+		complete = true;
+		if (file.isOpen()) {
+			file.close();
+			psPostprocessFile(QFileInfo(file).absoluteFilePath());
+		}
+		removeFromQueue();
+		App::wnd()->update();
+		App::wnd()->notifyUpdateAllPhotos();
 	}
+	emit progress(this);
 	loadNext();
 }
 
@@ -234,6 +275,12 @@ void mtpFileLoader::start(bool loadFirst, bool prior) {
 			finishFail();
 			return;
 		}
+		if (size > 0 && !file.resize(size)) { // preallocate, parts are written by their offsets
+			finishFail();
+			return;
+		}
+	} else if (size > 0) {
+		data.reserve(size);
 	}
 
 	mtpFileLoader *before = 0, *after = 0;
@@ -326,10 +373,7 @@ void mtpFileLoader::start(bool loadFirst, bool prior) {
 
 void mtpFileLoader::cancel() {
 	bool started = currentOffset() > 0;
-	if (requestId) {
-		requestId = 0;
-		--queue->queries;
-	}
+	cancelRequests();
 	type = MTP_storage_fileUnknown();
 	complete = true;
 	if (file.isOpen()) {
@@ -348,7 +392,10 @@ bool mtpFileLoader::loading() const {
 
 void mtpFileLoader::started(bool loadFirst, bool prior) {
 	if ((queue->queries >= MaxFileQueries && (!loadFirst || !prior)) || complete) return;
-	loadPart();
+	if (loadPart()) {
+		while (queue->queries < MaxFileQueries && loadPart()) {
+		}
+	}
 }
 
 mtpFileLoader::~mtpFileLoader() {
@@ -61,12 +61,26 @@ private:
 
 	mtpFileLoaderQueue *queue;
 	bool inQueue, complete;
-	int32 requestId;
+
+	struct PartRequest {
+		PartRequest(mtpRequestId requestId = 0, int32 limit = 0) : requestId(requestId), limit(limit), sent(getms()) {
+		}
+		mtpRequestId requestId;
+		int32 limit;
+		uint64 sent;
+	};
+	typedef QMap<int32, PartRequest> PartRequests; // offset -> request
+	PartRequests requests;
+	int32 nextOffset, endOffset; // endOffset == -1 while the file end is unknown
+	int32 partSize, loadedSize;
+	bool partGrow;
+
 	void started(bool loadFirst, bool prior);
 	void removeFromQueue();
 
 	void loadNext();
 	void finishFail();
+	void cancelRequests();
 	bool loadPart();
 	void partLoaded(int32 offset, const MTPupload_File &result);
 	bool partFailed(const RPCError &error);
@@ -18,6 +18,119 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 #include "stdafx.h"
 #include "mtproto/mtpRPC.h"
 
+class mtpArenaBlock {
+public:
+
+	static mtpArenaBlock *create(uint32 size) {
+		void *memory = ::operator new(dataOffset() + size);
+		return new (memory) mtpArenaBlock(size);
+	}
+
+	char *allocate(uint32 size) {
+		if (_used + size > _size) return 0;
+
+		char *result = reinterpret_cast<char*>(this) + dataOffset() + _used;
+		_used += size;
+		_refs.ref();
+		return result;
+	}
+
+	void release() {
+		if (!_refs.deref()) {
+			this->~mtpArenaBlock();
+			::operator delete(this);
+		}
+	}
+
+private:
+
+	mtpArenaBlock(uint32 size) : _refs(1), _used(0), _size(size) { // one ref is held by the arena scope
+	}
+
+	static uint32 dataOffset() {
+		return (sizeof(mtpArenaBlock) + 7) & ~7;
+	}
+
+	QAtomicInt _refs;
+	uint32 _used, _size;
+
+};
+
+namespace {
+	struct ArenaCurrent { // QThreadStorage deletes what it holds, so scopes living on stack are kept here by plain pointer
+		ArenaCurrent() : scope(0) {
+		}
+		mtpArenaScope *scope;
+	};
+	QThreadStorage<ArenaCurrent*> currentArenas;
+#ifdef TDESKTOP_BENCHMARK
+	QAtomicInt heapAllocationsCount;
+#endif
+
+	const uint32 ArenaAllocHeader = 8; // each allocation starts with the pointer to its block or 0 for heap
+
+	ArenaCurrent *currentArena() {
+		if (!currentArenas.hasLocalData()) currentArenas.setLocalData(new ArenaCurrent());
+		return currentArenas.localData();
+	}
+}
+
+mtpArenaScope::mtpArenaScope() : _prev(currentArena()->scope), _block(0) {
+	currentArena()->scope = this;
+}
+
+mtpArenaScope::~mtpArenaScope() {
+	ArenaCurrent *current = currentArena();
+	Q_ASSERT(current->scope == this); // nested scopes must be destroyed in reverse order in the thread they were created in
+	if (_block) _block->release();
+	current->scope = _prev;
+}
+
+void *mtpArenaScope::allocate(size_t size) {
+	uint32 full = ArenaAllocHeader + ((size + 7) & ~7);
+	mtpArenaScope *arena = currentArenas.hasLocalData() ? currentArenas.localData()->scope : 0;
+
+	mtpArenaBlock *block = 0;
+	char *result = 0;
+	if (arena && full <= MTPArenaBlockSize / 4) { // big objects go to heap, so that blocks are filled well
+		if (arena->_block) result = arena->_block->allocate(full);
+		if (!result) {
+			if (arena->_block) arena->_block->release();
+			arena->_block = mtpArenaBlock::create(MTPArenaBlockSize);
+			result = arena->_block->allocate(full);
+#ifdef TDESKTOP_BENCHMARK
+			heapAllocationsCount.ref();
+#endif
+		}
+		block = arena->_block;
+	} else {
+		result = static_cast<char*>(::operator new(full));
+#ifdef TDESKTOP_BENCHMARK
+		heapAllocationsCount.ref();
+#endif
+	}
+	*reinterpret_cast<mtpArenaBlock**>(result) = block;
+	return result + ArenaAllocHeader;
+}
+
+void mtpArenaScope::free(void *p) {
+	if (!p) return;
+
+	char *start = static_cast<char*>(p) - ArenaAllocHeader;
+	mtpArenaBlock *block = *reinterpret_cast<mtpArenaBlock**>(start);
+	if (block) {
+		block->release();
+	} else {
+		::operator delete(start);
+	}
+}
+
+#ifdef TDESKTOP_BENCHMARK
+uint32 mtpArenaScope::heapAllocations() {
+	return uint32(heapAllocationsCount.load());
+}
+#endif
+
 RPCOwnedDoneHandler::RPCOwnedDoneHandler(RPCSender *owner) : _owner(owner) {
 	_owner->_rpcRegHandler(this);
 }
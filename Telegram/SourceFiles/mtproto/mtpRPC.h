@@ -56,9 +56,37 @@ private:
 	QString _type, _description;
 };
 
+class RPCAbstractParsedResponse { // response, that was parsed in connection thread
+public:
+	virtual ~RPCAbstractParsedResponse() {
+	}
+};
+typedef QSharedPointer<RPCAbstractParsedResponse> RPCParsedResponsePtr;
+
+template <typename TResponse>
+class RPCParsedResponse : public RPCAbstractParsedResponse {
+public:
+	RPCParsedResponse(const mtpPrime *from, const mtpPrime *end) : response(from, end) {
+	}
+	TResponse response;
+};
+
+typedef RPCParsedResponsePtr (*RPCResponseParser)(const mtpPrime *from, const mtpPrime *end); // called in connection thread, may throw
+
+template <typename TResponse>
+RPCParsedResponsePtr rpcParseResponse(const mtpPrime *from, const mtpPrime *end) {
+	mtpArenaScope arena; // all the objects of one response are allocated together
+	return RPCParsedResponsePtr(new RPCParsedResponse<TResponse>(from, end));
+}
+
 class RPCAbstractDoneHandler { // abstract done
 public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const = 0;
+	virtual RPCResponseParser parser() const { // handlers with known response type let it be parsed before the callback is called
+		return 0;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const { // called only if parser() is not 0
+	}
 	virtual ~RPCAbstractDoneHandler() {
 	}
 };
@@ -127,6 +155,12 @@ public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		(*_onDone)(TResponse(from, end));
 	}
+	virtual RPCResponseParser parser() const {
+		return rpcParseResponse<TResponse>;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const {
+		(*_onDone)(static_cast<const RPCParsedResponse<TResponse>&>(parsed).response);
+	}
 
 private:
 	CallbackType _onDone;
@@ -143,6 +177,12 @@ public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		(*_onDone)(TResponse(from, end), requestId);
 	}
+	virtual RPCResponseParser parser() const {
+		return rpcParseResponse<TResponse>;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const {
+		(*_onDone)(static_cast<const RPCParsedResponse<TResponse>&>(parsed).response, requestId);
+	}
 
 private:
 	CallbackType _onDone;
@@ -364,6 +404,12 @@ public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(TResponse(from, end));
 	}
+	virtual RPCResponseParser parser() const {
+		return rpcParseResponse<TResponse>;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const {
+		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(static_cast<const RPCParsedResponse<TResponse>&>(parsed).response);
+	}
 
 private:
 	CallbackType _onDone;
@@ -380,6 +426,12 @@ public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(TResponse(from, end), requestId);
 	}
+	virtual RPCResponseParser parser() const {
+		return rpcParseResponse<TResponse>;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const {
+		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(static_cast<const RPCParsedResponse<TResponse>&>(parsed).response, requestId);
+	}
 
 private:
 	CallbackType _onDone;
@@ -462,6 +514,12 @@ public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, TResponse(from, end));
 	}
+	virtual RPCResponseParser parser() const {
+		return rpcParseResponse<TResponse>;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const {
+		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, static_cast<const RPCParsedResponse<TResponse>&>(parsed).response);
+	}
 
 private:
 	CallbackType _onDone;
@@ -479,6 +537,12 @@ public:
 	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, TResponse(from, end), requestId);
 	}
+	virtual RPCResponseParser parser() const {
+		return rpcParseResponse<TResponse>;
+	}
+	virtual void operator()(mtpRequestId requestId, const RPCAbstractParsedResponse &parsed) const {
+		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, static_cast<const RPCParsedResponse<TResponse>&>(parsed).response, requestId);
+	}
 
 private:
 	CallbackType _onDone;
@@ -21995,6 +21995,14511 @@ inline MTPnotifyPeer MTP_notifyAll() {
 	return MTPnotifyPeer(mtpc_notifyAll);
 }
 
+// Lazy views forward declarations
+class MTPresPQView;
+class MTPDresPQView;
+class MTPp_Q_inner_dataView;
+class MTPDp_q_inner_dataView;
+class MTPserver_DH_ParamsView;
+class MTPDserver_DH_params_failView;
+class MTPDserver_DH_params_okView;
+class MTPserver_DH_inner_dataView;
+class MTPDserver_DH_inner_dataView;
+class MTPclient_DH_Inner_DataView;
+class MTPDclient_DH_inner_dataView;
+class MTPset_client_DH_params_answerView;
+class MTPDdh_gen_okView;
+class MTPDdh_gen_retryView;
+class MTPDdh_gen_failView;
+class MTPmsgsAckView;
+class MTPDmsgs_ackView;
+class MTPbadMsgNotificationView;
+class MTPDbad_msg_notificationView;
+class MTPDbad_server_saltView;
+class MTPmsgsStateReqView;
+class MTPDmsgs_state_reqView;
+class MTPmsgsStateInfoView;
+class MTPDmsgs_state_infoView;
+class MTPmsgsAllInfoView;
+class MTPDmsgs_all_infoView;
+class MTPmsgDetailedInfoView;
+class MTPDmsg_detailed_infoView;
+class MTPDmsg_new_detailed_infoView;
+class MTPmsgResendReqView;
+class MTPDmsg_resend_reqView;
+class MTPrpcErrorView;
+class MTPDrpc_errorView;
+class MTPrpcDropAnswerView;
+class MTPDrpc_answer_droppedView;
+class MTPfutureSaltView;
+class MTPDfuture_saltView;
+class MTPfutureSaltsView;
+class MTPDfuture_saltsView;
+class MTPpongView;
+class MTPDpongView;
+class MTPdestroySessionResView;
+class MTPDdestroy_session_okView;
+class MTPDdestroy_session_noneView;
+class MTPnewSessionView;
+class MTPDnew_session_createdView;
+class MTPhttpWaitView;
+class MTPDhttp_waitView;
+class MTPinputPeerView;
+class MTPDinputPeerContactView;
+class MTPDinputPeerForeignView;
+class MTPDinputPeerChatView;
+class MTPinputUserView;
+class MTPDinputUserContactView;
+class MTPDinputUserForeignView;
+class MTPinputContactView;
+class MTPDinputPhoneContactView;
+class MTPinputFileView;
+class MTPDinputFileView;
+class MTPDinputFileBigView;
+class MTPinputMediaView;
+class MTPDinputMediaUploadedPhotoView;
+class MTPDinputMediaPhotoView;
+class MTPDinputMediaGeoPointView;
+class MTPDinputMediaContactView;
+class MTPDinputMediaUploadedVideoView;
+class MTPDinputMediaUploadedThumbVideoView;
+class MTPDinputMediaVideoView;
+class MTPDinputMediaUploadedAudioView;
+class MTPDinputMediaAudioView;
+class MTPDinputMediaUploadedDocumentView;
+class MTPDinputMediaUploadedThumbDocumentView;
+class MTPDinputMediaDocumentView;
+class MTPinputChatPhotoView;
+class MTPDinputChatUploadedPhotoView;
+class MTPDinputChatPhotoView;
+class MTPinputGeoPointView;
+class MTPDinputGeoPointView;
+class MTPinputPhotoView;
+class MTPDinputPhotoView;
+class MTPinputVideoView;
+class MTPDinputVideoView;
+class MTPinputFileLocationView;
+class MTPDinputFileLocationView;
+class MTPDinputVideoFileLocationView;
+class MTPDinputEncryptedFileLocationView;
+class MTPDinputAudioFileLocationView;
+class MTPDinputDocumentFileLocationView;
+class MTPinputPhotoCropView;
+class MTPDinputPhotoCropView;
+class MTPinputAppEventView;
+class MTPDinputAppEventView;
+class MTPpeerView;
+class MTPDpeerUserView;
+class MTPDpeerChatView;
+class MTPstorage_fileTypeView;
+class MTPfileLocationView;
+class MTPDfileLocationUnavailableView;
+class MTPDfileLocationView;
+class MTPuserView;
+class MTPDuserEmptyView;
+class MTPDuserSelfView;
+class MTPDuserContactView;
+class MTPDuserRequestView;
+class MTPDuserForeignView;
+class MTPDuserDeletedView;
+class MTPuserProfilePhotoView;
+class MTPDuserProfilePhotoView;
+class MTPuserStatusView;
+class MTPDuserStatusOnlineView;
+class MTPDuserStatusOfflineView;
+class MTPchatView;
+class MTPDchatEmptyView;
+class MTPDchatView;
+class MTPDchatForbiddenView;
+class MTPDgeoChatView;
+class MTPchatFullView;
+class MTPDchatFullView;
+class MTPchatParticipantView;
+class MTPDchatParticipantView;
+class MTPchatParticipantsView;
+class MTPDchatParticipantsForbiddenView;
+class MTPDchatParticipantsView;
+class MTPchatPhotoView;
+class MTPDchatPhotoView;
+class MTPmessageView;
+class MTPDmessageEmptyView;
+class MTPDmessageView;
+class MTPDmessageForwardedView;
+class MTPDmessageServiceView;
+class MTPmessageMediaView;
+class MTPDmessageMediaPhotoView;
+class MTPDmessageMediaVideoView;
+class MTPDmessageMediaGeoView;
+class MTPDmessageMediaContactView;
+class MTPDmessageMediaUnsupportedView;
+class MTPDmessageMediaDocumentView;
+class MTPDmessageMediaAudioView;
+class MTPmessageActionView;
+class MTPDmessageActionChatCreateView;
+class MTPDmessageActionChatEditTitleView;
+class MTPDmessageActionChatEditPhotoView;
+class MTPDmessageActionChatAddUserView;
+class MTPDmessageActionChatDeleteUserView;
+class MTPDmessageActionGeoChatCreateView;
+class MTPdialogView;
+class MTPDdialogView;
+class MTPphotoView;
+class MTPDphotoEmptyView;
+class MTPDphotoView;
+class MTPphotoSizeView;
+class MTPDphotoSizeEmptyView;
+class MTPDphotoSizeView;
+class MTPDphotoCachedSizeView;
+class MTPvideoView;
+class MTPDvideoEmptyView;
+class MTPDvideoView;
+class MTPgeoPointView;
+class MTPDgeoPointView;
+class MTPauth_checkedPhoneView;
+class MTPDauth_checkedPhoneView;
+class MTPauth_sentCodeView;
+class MTPDauth_sentCodeView;
+class MTPauth_authorizationView;
+class MTPDauth_authorizationView;
+class MTPauth_exportedAuthorizationView;
+class MTPDauth_exportedAuthorizationView;
+class MTPinputNotifyPeerView;
+class MTPDinputNotifyPeerView;
+class MTPDinputNotifyGeoChatPeerView;
+class MTPinputPeerNotifyEventsView;
+class MTPinputPeerNotifySettingsView;
+class MTPDinputPeerNotifySettingsView;
+class MTPpeerNotifyEventsView;
+class MTPpeerNotifySettingsView;
+class MTPDpeerNotifySettingsView;
+class MTPwallPaperView;
+class MTPDwallPaperView;
+class MTPDwallPaperSolidView;
+class MTPuserFullView;
+class MTPDuserFullView;
+class MTPcontactView;
+class MTPDcontactView;
+class MTPimportedContactView;
+class MTPDimportedContactView;
+class MTPcontactBlockedView;
+class MTPDcontactBlockedView;
+class MTPcontactFoundView;
+class MTPDcontactFoundView;
+class MTPcontactSuggestedView;
+class MTPDcontactSuggestedView;
+class MTPcontactStatusView;
+class MTPDcontactStatusView;
+class MTPchatLocatedView;
+class MTPDchatLocatedView;
+class MTPcontacts_foreignLinkView;
+class MTPDcontacts_foreignLinkRequestedView;
+class MTPcontacts_myLinkView;
+class MTPDcontacts_myLinkRequestedView;
+class MTPcontacts_linkView;
+class MTPDcontacts_linkView;
+class MTPcontacts_contactsView;
+class MTPDcontacts_contactsView;
+class MTPcontacts_importedContactsView;
+class MTPDcontacts_importedContactsView;
+class MTPcontacts_blockedView;
+class MTPDcontacts_blockedView;
+class MTPDcontacts_blockedSliceView;
+class MTPcontacts_foundView;
+class MTPDcontacts_foundView;
+class MTPcontacts_suggestedView;
+class MTPDcontacts_suggestedView;
+class MTPmessages_dialogsView;
+class MTPDmessages_dialogsView;
+class MTPDmessages_dialogsSliceView;
+class MTPmessages_messagesView;
+class MTPDmessages_messagesView;
+class MTPDmessages_messagesSliceView;
+class MTPmessages_messageView;
+class MTPDmessages_messageView;
+class MTPmessages_statedMessagesView;
+class MTPDmessages_statedMessagesView;
+class MTPDmessages_statedMessagesLinksView;
+class MTPmessages_statedMessageView;
+class MTPDmessages_statedMessageView;
+class MTPDmessages_statedMessageLinkView;
+class MTPmessages_sentMessageView;
+class MTPDmessages_sentMessageView;
+class MTPDmessages_sentMessageLinkView;
+class MTPmessages_chatView;
+class MTPDmessages_chatView;
+class MTPmessages_chatsView;
+class MTPDmessages_chatsView;
+class MTPmessages_chatFullView;
+class MTPDmessages_chatFullView;
+class MTPmessages_affectedHistoryView;
+class MTPDmessages_affectedHistoryView;
+class MTPmessagesFilterView;
+class MTPupdateView;
+class MTPDupdateNewMessageView;
+class MTPDupdateMessageIDView;
+class MTPDupdateReadMessagesView;
+class MTPDupdateDeleteMessagesView;
+class MTPDupdateRestoreMessagesView;
+class MTPDupdateUserTypingView;
+class MTPDupdateChatUserTypingView;
+class MTPDupdateChatParticipantsView;
+class MTPDupdateUserStatusView;
+class MTPDupdateUserNameView;
+class MTPDupdateUserPhotoView;
+class MTPDupdateContactRegisteredView;
+class MTPDupdateContactLinkView;
+class MTPDupdateActivationView;
+class MTPDupdateNewAuthorizationView;
+class MTPDupdateNewGeoChatMessageView;
+class MTPDupdateNewEncryptedMessageView;
+class MTPDupdateEncryptedChatTypingView;
+class MTPDupdateEncryptionView;
+class MTPDupdateEncryptedMessagesReadView;
+class MTPDupdateChatParticipantAddView;
+class MTPDupdateChatParticipantDeleteView;
+class MTPDupdateDcOptionsView;
+class MTPDupdateUserBlockedView;
+class MTPDupdateNotifySettingsView;
+class MTPupdates_stateView;
+class MTPDupdates_stateView;
+class MTPupdates_differenceView;
+class MTPDupdates_differenceEmptyView;
+class MTPDupdates_differenceView;
+class MTPDupdates_differenceSliceView;
+class MTPupdatesView;
+class MTPDupdateShortMessageView;
+class MTPDupdateShortChatMessageView;
+class MTPDupdateShortView;
+class MTPDupdatesCombinedView;
+class MTPDupdatesView;
+class MTPphotos_photosView;
+class MTPDphotos_photosView;
+class MTPDphotos_photosSliceView;
+class MTPphotos_photoView;
+class MTPDphotos_photoView;
+class MTPupload_fileView;
+class MTPDupload_fileView;
+class MTPdcOptionView;
+class MTPDdcOptionView;
+class MTPconfigView;
+class MTPDconfigView;
+class MTPnearestDcView;
+class MTPDnearestDcView;
+class MTPhelp_appUpdateView;
+class MTPDhelp_appUpdateView;
+class MTPhelp_inviteTextView;
+class MTPDhelp_inviteTextView;
+class MTPinputGeoChatView;
+class MTPDinputGeoChatView;
+class MTPgeoChatMessageView;
+class MTPDgeoChatMessageEmptyView;
+class MTPDgeoChatMessageView;
+class MTPDgeoChatMessageServiceView;
+class MTPgeochats_statedMessageView;
+class MTPDgeochats_statedMessageView;
+class MTPgeochats_locatedView;
+class MTPDgeochats_locatedView;
+class MTPgeochats_messagesView;
+class MTPDgeochats_messagesView;
+class MTPDgeochats_messagesSliceView;
+class MTPencryptedChatView;
+class MTPDencryptedChatEmptyView;
+class MTPDencryptedChatWaitingView;
+class MTPDencryptedChatRequestedView;
+class MTPDencryptedChatView;
+class MTPDencryptedChatDiscardedView;
+class MTPinputEncryptedChatView;
+class MTPDinputEncryptedChatView;
+class MTPencryptedFileView;
+class MTPDencryptedFileView;
+class MTPinputEncryptedFileView;
+class MTPDinputEncryptedFileUploadedView;
+class MTPDinputEncryptedFileView;
+class MTPDinputEncryptedFileBigUploadedView;
+class MTPencryptedMessageView;
+class MTPDencryptedMessageView;
+class MTPDencryptedMessageServiceView;
+class MTPdecryptedMessageLayerView;
+class MTPDdecryptedMessageLayerView;
+class MTPdecryptedMessageView;
+class MTPDdecryptedMessageView;
+class MTPDdecryptedMessageServiceView;
+class MTPdecryptedMessageMediaView;
+class MTPDdecryptedMessageMediaPhotoView;
+class MTPDdecryptedMessageMediaVideoView;
+class MTPDdecryptedMessageMediaGeoPointView;
+class MTPDdecryptedMessageMediaContactView;
+class MTPDdecryptedMessageMediaDocumentView;
+class MTPDdecryptedMessageMediaAudioView;
+class MTPdecryptedMessageActionView;
+class MTPDdecryptedMessageActionSetMessageTTLView;
+class MTPDdecryptedMessageActionReadMessagesView;
+class MTPDdecryptedMessageActionDeleteMessagesView;
+class MTPDdecryptedMessageActionScreenshotMessagesView;
+class MTPDdecryptedMessageActionNotifyLayerView;
+class MTPmessages_dhConfigView;
+class MTPDmessages_dhConfigNotModifiedView;
+class MTPDmessages_dhConfigView;
+class MTPmessages_sentEncryptedMessageView;
+class MTPDmessages_sentEncryptedMessageView;
+class MTPDmessages_sentEncryptedFileView;
+class MTPinputAudioView;
+class MTPDinputAudioView;
+class MTPinputDocumentView;
+class MTPDinputDocumentView;
+class MTPaudioView;
+class MTPDaudioEmptyView;
+class MTPDaudioView;
+class MTPdocumentView;
+class MTPDdocumentEmptyView;
+class MTPDdocumentView;
+class MTPhelp_supportView;
+class MTPDhelp_supportView;
+class MTPnotifyPeerView;
+class MTPDnotifyPeerView;
+
+// Lazy views of types, fields are read on access
+
+class MTPDresPQView {
+public:
+	MTPDresPQView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPresPQView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPstring vpq() const;
+	MTPBoxedView<MTPvectorView<MTPlong > > vserver_public_key_fingerprints() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPresPQView { // fields of MTPresPQ are read on access
+public:
+	MTPresPQView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_resPQ) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDresPQView c_resPQ() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPresPQ read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_resPQ);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDp_q_inner_dataView {
+public:
+	MTPDp_q_inner_dataView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPp_Q_inner_dataView
+	}
+
+	MTPstring vpq() const;
+	MTPstring vp() const;
+	MTPstring vq() const;
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPint256 vnew_nonce() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPp_Q_inner_dataView { // fields of MTPp_Q_inner_data are read on access
+public:
+	MTPp_Q_inner_dataView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_p_q_inner_data) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDp_q_inner_dataView c_p_q_inner_data() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPp_Q_inner_data read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_p_q_inner_data);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDserver_DH_params_failView {
+public:
+	MTPDserver_DH_params_failView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPserver_DH_ParamsView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPint128 vnew_nonce_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDserver_DH_params_okView {
+public:
+	MTPDserver_DH_params_okView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPserver_DH_ParamsView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPstring vencrypted_answer() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPserver_DH_ParamsView { // fields of MTPserver_DH_Params are read on access
+public:
+	MTPserver_DH_ParamsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDserver_DH_params_failView c_server_DH_params_fail() const;
+	MTPDserver_DH_params_okView c_server_DH_params_ok() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPserver_DH_Params read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDserver_DH_inner_dataView {
+public:
+	MTPDserver_DH_inner_dataView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPserver_DH_inner_dataView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPint vg() const;
+	MTPstring vdh_prime() const;
+	MTPstring vg_a() const;
+	MTPint vserver_time() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPserver_DH_inner_dataView { // fields of MTPserver_DH_inner_data are read on access
+public:
+	MTPserver_DH_inner_dataView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_server_DH_inner_data) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDserver_DH_inner_dataView c_server_DH_inner_data() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPserver_DH_inner_data read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_server_DH_inner_data);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDclient_DH_inner_dataView {
+public:
+	MTPDclient_DH_inner_dataView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPclient_DH_Inner_DataView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPlong vretry_id() const;
+	MTPstring vg_b() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPclient_DH_Inner_DataView { // fields of MTPclient_DH_Inner_Data are read on access
+public:
+	MTPclient_DH_Inner_DataView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_client_DH_inner_data) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDclient_DH_inner_dataView c_client_DH_inner_data() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPclient_DH_Inner_Data read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_client_DH_inner_data);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdh_gen_okView {
+public:
+	MTPDdh_gen_okView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPset_client_DH_params_answerView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPint128 vnew_nonce_hash1() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdh_gen_retryView {
+public:
+	MTPDdh_gen_retryView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPset_client_DH_params_answerView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPint128 vnew_nonce_hash2() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdh_gen_failView {
+public:
+	MTPDdh_gen_failView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPset_client_DH_params_answerView
+	}
+
+	MTPint128 vnonce() const;
+	MTPint128 vserver_nonce() const;
+	MTPint128 vnew_nonce_hash3() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPset_client_DH_params_answerView { // fields of MTPset_client_DH_params_answer are read on access
+public:
+	MTPset_client_DH_params_answerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdh_gen_okView c_dh_gen_ok() const;
+	MTPDdh_gen_retryView c_dh_gen_retry() const;
+	MTPDdh_gen_failView c_dh_gen_fail() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPset_client_DH_params_answer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmsgs_ackView {
+public:
+	MTPDmsgs_ackView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgsAckView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vmsg_ids() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmsgsAckView { // fields of MTPmsgsAck are read on access
+public:
+	MTPmsgsAckView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_ack) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmsgs_ackView c_msgs_ack() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmsgsAck read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_ack);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDbad_msg_notificationView {
+public:
+	MTPDbad_msg_notificationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPbadMsgNotificationView
+	}
+
+	MTPlong vbad_msg_id() const;
+	MTPint vbad_msg_seqno() const;
+	MTPint verror_code() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDbad_server_saltView {
+public:
+	MTPDbad_server_saltView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPbadMsgNotificationView
+	}
+
+	MTPlong vbad_msg_id() const;
+	MTPint vbad_msg_seqno() const;
+	MTPint verror_code() const;
+	MTPlong vnew_server_salt() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPbadMsgNotificationView { // fields of MTPbadMsgNotification are read on access
+public:
+	MTPbadMsgNotificationView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDbad_msg_notificationView c_bad_msg_notification() const;
+	MTPDbad_server_saltView c_bad_server_salt() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPbadMsgNotification read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmsgs_state_reqView {
+public:
+	MTPDmsgs_state_reqView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgsStateReqView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vmsg_ids() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmsgsStateReqView { // fields of MTPmsgsStateReq are read on access
+public:
+	MTPmsgsStateReqView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_req) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmsgs_state_reqView c_msgs_state_req() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmsgsStateReq read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_req);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmsgs_state_infoView {
+public:
+	MTPDmsgs_state_infoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgsStateInfoView
+	}
+
+	MTPlong vreq_msg_id() const;
+	MTPstring vinfo() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmsgsStateInfoView { // fields of MTPmsgsStateInfo are read on access
+public:
+	MTPmsgsStateInfoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_info) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmsgs_state_infoView c_msgs_state_info() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmsgsStateInfo read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_info);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmsgs_all_infoView {
+public:
+	MTPDmsgs_all_infoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgsAllInfoView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vmsg_ids() const;
+	MTPstring vinfo() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmsgsAllInfoView { // fields of MTPmsgsAllInfo are read on access
+public:
+	MTPmsgsAllInfoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_all_info) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmsgs_all_infoView c_msgs_all_info() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmsgsAllInfo read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_all_info);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmsg_detailed_infoView {
+public:
+	MTPDmsg_detailed_infoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgDetailedInfoView
+	}
+
+	MTPlong vmsg_id() const;
+	MTPlong vanswer_msg_id() const;
+	MTPint vbytes() const;
+	MTPint vstatus() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmsg_new_detailed_infoView {
+public:
+	MTPDmsg_new_detailed_infoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgDetailedInfoView
+	}
+
+	MTPlong vanswer_msg_id() const;
+	MTPint vbytes() const;
+	MTPint vstatus() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmsgDetailedInfoView { // fields of MTPmsgDetailedInfo are read on access
+public:
+	MTPmsgDetailedInfoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmsg_detailed_infoView c_msg_detailed_info() const;
+	MTPDmsg_new_detailed_infoView c_msg_new_detailed_info() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmsgDetailedInfo read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmsg_resend_reqView {
+public:
+	MTPDmsg_resend_reqView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmsgResendReqView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vmsg_ids() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmsgResendReqView { // fields of MTPmsgResendReq are read on access
+public:
+	MTPmsgResendReqView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msg_resend_req) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmsg_resend_reqView c_msg_resend_req() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmsgResendReq read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msg_resend_req);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDrpc_errorView {
+public:
+	MTPDrpc_errorView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPrpcErrorView
+	}
+
+	MTPint verror_code() const;
+	MTPstring verror_message() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPrpcErrorView { // fields of MTPrpcError are read on access
+public:
+	MTPrpcErrorView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_rpc_error) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDrpc_errorView c_rpc_error() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPrpcError read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_rpc_error);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDrpc_answer_droppedView {
+public:
+	MTPDrpc_answer_droppedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPrpcDropAnswerView
+	}
+
+	MTPlong vmsg_id() const;
+	MTPint vseq_no() const;
+	MTPint vbytes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPrpcDropAnswerView { // fields of MTPrpcDropAnswer are read on access
+public:
+	MTPrpcDropAnswerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDrpc_answer_droppedView c_rpc_answer_dropped() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPrpcDropAnswer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDfuture_saltView {
+public:
+	MTPDfuture_saltView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPfutureSaltView
+	}
+
+	MTPint vvalid_since() const;
+	MTPint vvalid_until() const;
+	MTPlong vsalt() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPfutureSaltView { // fields of MTPfutureSalt are read on access
+public:
+	MTPfutureSaltView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salt) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDfuture_saltView c_future_salt() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPfutureSalt read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salt);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDfuture_saltsView {
+public:
+	MTPDfuture_saltsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPfutureSaltsView
+	}
+
+	MTPlong vreq_msg_id() const;
+	MTPint vnow() const;
+	MTPvectorView<MTPfutureSaltView > vsalts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPfutureSaltsView { // fields of MTPfutureSalts are read on access
+public:
+	MTPfutureSaltsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salts) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDfuture_saltsView c_future_salts() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPfutureSalts read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salts);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDpongView {
+public:
+	MTPDpongView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPpongView
+	}
+
+	MTPlong vmsg_id() const;
+	MTPlong vping_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPpongView { // fields of MTPpong are read on access
+public:
+	MTPpongView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_pong) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDpongView c_pong() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPpong read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_pong);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdestroy_session_okView {
+public:
+	MTPDdestroy_session_okView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdestroySessionResView
+	}
+
+	MTPlong vsession_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdestroy_session_noneView {
+public:
+	MTPDdestroy_session_noneView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdestroySessionResView
+	}
+
+	MTPlong vsession_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdestroySessionResView { // fields of MTPdestroySessionRes are read on access
+public:
+	MTPdestroySessionResView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdestroy_session_okView c_destroy_session_ok() const;
+	MTPDdestroy_session_noneView c_destroy_session_none() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdestroySessionRes read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDnew_session_createdView {
+public:
+	MTPDnew_session_createdView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPnewSessionView
+	}
+
+	MTPlong vfirst_msg_id() const;
+	MTPlong vunique_id() const;
+	MTPlong vserver_salt() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPnewSessionView { // fields of MTPnewSession are read on access
+public:
+	MTPnewSessionView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_new_session_created) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDnew_session_createdView c_new_session_created() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPnewSession read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_new_session_created);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDhttp_waitView {
+public:
+	MTPDhttp_waitView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPhttpWaitView
+	}
+
+	MTPint vmax_delay() const;
+	MTPint vwait_after() const;
+	MTPint vmax_wait() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPhttpWaitView { // fields of MTPhttpWait are read on access
+public:
+	MTPhttpWaitView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_http_wait) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDhttp_waitView c_http_wait() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPhttpWait read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_http_wait);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputPeerContactView {
+public:
+	MTPDinputPeerContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputPeerView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputPeerForeignView {
+public:
+	MTPDinputPeerForeignView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputPeerView
+	}
+
+	MTPint vuser_id() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputPeerChatView {
+public:
+	MTPDinputPeerChatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputPeerView
+	}
+
+	MTPint vchat_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputPeerView { // fields of MTPinputPeer are read on access
+public:
+	MTPinputPeerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputPeerContactView c_inputPeerContact() const;
+	MTPDinputPeerForeignView c_inputPeerForeign() const;
+	MTPDinputPeerChatView c_inputPeerChat() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputPeer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputUserContactView {
+public:
+	MTPDinputUserContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputUserView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputUserForeignView {
+public:
+	MTPDinputUserForeignView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputUserView
+	}
+
+	MTPint vuser_id() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputUserView { // fields of MTPinputUser are read on access
+public:
+	MTPinputUserView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputUserContactView c_inputUserContact() const;
+	MTPDinputUserForeignView c_inputUserForeign() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputUser read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputPhoneContactView {
+public:
+	MTPDinputPhoneContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputContactView
+	}
+
+	MTPlong vclient_id() const;
+	MTPstring vphone() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputContactView { // fields of MTPinputContact are read on access
+public:
+	MTPinputContactView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPhoneContact) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputPhoneContactView c_inputPhoneContact() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputContact read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPhoneContact);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputFileView {
+public:
+	MTPDinputFileView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileView
+	}
+
+	MTPlong vid() const;
+	MTPint vparts() const;
+	MTPstring vname() const;
+	MTPstring vmd5_checksum() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputFileBigView {
+public:
+	MTPDinputFileBigView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileView
+	}
+
+	MTPlong vid() const;
+	MTPint vparts() const;
+	MTPstring vname() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputFileView { // fields of MTPinputFile are read on access
+public:
+	MTPinputFileView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputFileView c_inputFile() const;
+	MTPDinputFileBigView c_inputFileBig() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputFile read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputMediaUploadedPhotoView {
+public:
+	MTPDinputMediaUploadedPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaPhotoView {
+public:
+	MTPDinputMediaPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputPhotoView> vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaGeoPointView {
+public:
+	MTPDinputMediaGeoPointView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputGeoPointView> vgeo_point() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaContactView {
+public:
+	MTPDinputMediaContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPstring vphone_number() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaUploadedVideoView {
+public:
+	MTPDinputMediaUploadedVideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+	MTPint vduration() const;
+	MTPint vw() const;
+	MTPint vh() const;
+	MTPstring vmime_type() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaUploadedThumbVideoView {
+public:
+	MTPDinputMediaUploadedThumbVideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+	MTPBoxedView<MTPinputFileView> vthumb() const;
+	MTPint vduration() const;
+	MTPint vw() const;
+	MTPint vh() const;
+	MTPstring vmime_type() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaVideoView {
+public:
+	MTPDinputMediaVideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputVideoView> vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaUploadedAudioView {
+public:
+	MTPDinputMediaUploadedAudioView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+	MTPint vduration() const;
+	MTPstring vmime_type() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaAudioView {
+public:
+	MTPDinputMediaAudioView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputAudioView> vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaUploadedDocumentView {
+public:
+	MTPDinputMediaUploadedDocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+	MTPstring vfile_name() const;
+	MTPstring vmime_type() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaUploadedThumbDocumentView {
+public:
+	MTPDinputMediaUploadedThumbDocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+	MTPBoxedView<MTPinputFileView> vthumb() const;
+	MTPstring vfile_name() const;
+	MTPstring vmime_type() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputMediaDocumentView {
+public:
+	MTPDinputMediaDocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputMediaView
+	}
+
+	MTPBoxedView<MTPinputDocumentView> vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputMediaView { // fields of MTPinputMedia are read on access
+public:
+	MTPinputMediaView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputMediaUploadedPhotoView c_inputMediaUploadedPhoto() const;
+	MTPDinputMediaPhotoView c_inputMediaPhoto() const;
+	MTPDinputMediaGeoPointView c_inputMediaGeoPoint() const;
+	MTPDinputMediaContactView c_inputMediaContact() const;
+	MTPDinputMediaUploadedVideoView c_inputMediaUploadedVideo() const;
+	MTPDinputMediaUploadedThumbVideoView c_inputMediaUploadedThumbVideo() const;
+	MTPDinputMediaVideoView c_inputMediaVideo() const;
+	MTPDinputMediaUploadedAudioView c_inputMediaUploadedAudio() const;
+	MTPDinputMediaAudioView c_inputMediaAudio() const;
+	MTPDinputMediaUploadedDocumentView c_inputMediaUploadedDocument() const;
+	MTPDinputMediaUploadedThumbDocumentView c_inputMediaUploadedThumbDocument() const;
+	MTPDinputMediaDocumentView c_inputMediaDocument() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputMedia read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputChatUploadedPhotoView {
+public:
+	MTPDinputChatUploadedPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputChatPhotoView
+	}
+
+	MTPBoxedView<MTPinputFileView> vfile() const;
+	MTPBoxedView<MTPinputPhotoCropView> vcrop() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputChatPhotoView {
+public:
+	MTPDinputChatPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputChatPhotoView
+	}
+
+	MTPBoxedView<MTPinputPhotoView> vid() const;
+	MTPBoxedView<MTPinputPhotoCropView> vcrop() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputChatPhotoView { // fields of MTPinputChatPhoto are read on access
+public:
+	MTPinputChatPhotoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputChatUploadedPhotoView c_inputChatUploadedPhoto() const;
+	MTPDinputChatPhotoView c_inputChatPhoto() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputChatPhoto read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputGeoPointView {
+public:
+	MTPDinputGeoPointView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputGeoPointView
+	}
+
+	MTPdouble vlat() const;
+	MTPdouble vlong() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputGeoPointView { // fields of MTPinputGeoPoint are read on access
+public:
+	MTPinputGeoPointView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputGeoPointView c_inputGeoPoint() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputGeoPoint read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputPhotoView {
+public:
+	MTPDinputPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputPhotoView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputPhotoView { // fields of MTPinputPhoto are read on access
+public:
+	MTPinputPhotoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputPhotoView c_inputPhoto() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputPhoto read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputVideoView {
+public:
+	MTPDinputVideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputVideoView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputVideoView { // fields of MTPinputVideo are read on access
+public:
+	MTPinputVideoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputVideoView c_inputVideo() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputVideo read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputFileLocationView {
+public:
+	MTPDinputFileLocationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileLocationView
+	}
+
+	MTPlong vvolume_id() const;
+	MTPint vlocal_id() const;
+	MTPlong vsecret() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputVideoFileLocationView {
+public:
+	MTPDinputVideoFileLocationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileLocationView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputEncryptedFileLocationView {
+public:
+	MTPDinputEncryptedFileLocationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileLocationView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputAudioFileLocationView {
+public:
+	MTPDinputAudioFileLocationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileLocationView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputDocumentFileLocationView {
+public:
+	MTPDinputDocumentFileLocationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputFileLocationView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputFileLocationView { // fields of MTPinputFileLocation are read on access
+public:
+	MTPinputFileLocationView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputFileLocationView c_inputFileLocation() const;
+	MTPDinputVideoFileLocationView c_inputVideoFileLocation() const;
+	MTPDinputEncryptedFileLocationView c_inputEncryptedFileLocation() const;
+	MTPDinputAudioFileLocationView c_inputAudioFileLocation() const;
+	MTPDinputDocumentFileLocationView c_inputDocumentFileLocation() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputFileLocation read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputPhotoCropView {
+public:
+	MTPDinputPhotoCropView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputPhotoCropView
+	}
+
+	MTPdouble vcrop_left() const;
+	MTPdouble vcrop_top() const;
+	MTPdouble vcrop_width() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputPhotoCropView { // fields of MTPinputPhotoCrop are read on access
+public:
+	MTPinputPhotoCropView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputPhotoCropView c_inputPhotoCrop() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputPhotoCrop read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputAppEventView {
+public:
+	MTPDinputAppEventView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputAppEventView
+	}
+
+	MTPdouble vtime() const;
+	MTPstring vtype() const;
+	MTPlong vpeer() const;
+	MTPstring vdata() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputAppEventView { // fields of MTPinputAppEvent are read on access
+public:
+	MTPinputAppEventView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputAppEvent) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputAppEventView c_inputAppEvent() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputAppEvent read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputAppEvent);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDpeerUserView {
+public:
+	MTPDpeerUserView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPpeerView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDpeerChatView {
+public:
+	MTPDpeerChatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPpeerView
+	}
+
+	MTPint vchat_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPpeerView { // fields of MTPpeer are read on access
+public:
+	MTPpeerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDpeerUserView c_peerUser() const;
+	MTPDpeerChatView c_peerChat() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPpeer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPstorage_fileTypeView { // fields of MTPstorage_fileType are read on access
+public:
+	MTPstorage_fileTypeView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPstorage_fileType read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDfileLocationUnavailableView {
+public:
+	MTPDfileLocationUnavailableView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPfileLocationView
+	}
+
+	MTPlong vvolume_id() const;
+	MTPint vlocal_id() const;
+	MTPlong vsecret() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDfileLocationView {
+public:
+	MTPDfileLocationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPfileLocationView
+	}
+
+	MTPint vdc_id() const;
+	MTPlong vvolume_id() const;
+	MTPint vlocal_id() const;
+	MTPlong vsecret() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPfileLocationView { // fields of MTPfileLocation are read on access
+public:
+	MTPfileLocationView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDfileLocationUnavailableView c_fileLocationUnavailable() const;
+	MTPDfileLocationView c_fileLocation() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPfileLocation read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDuserEmptyView {
+public:
+	MTPDuserEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserView
+	}
+
+	MTPint vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDuserSelfView {
+public:
+	MTPDuserSelfView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserView
+	}
+
+	MTPint vid() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+	MTPstring vphone() const;
+	MTPBoxedView<MTPuserProfilePhotoView> vphoto() const;
+	MTPBoxedView<MTPuserStatusView> vstatus() const;
+	MTPBoxedView<MTPbool> vinactive() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDuserContactView {
+public:
+	MTPDuserContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserView
+	}
+
+	MTPint vid() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+	MTPlong vaccess_hash() const;
+	MTPstring vphone() const;
+	MTPBoxedView<MTPuserProfilePhotoView> vphoto() const;
+	MTPBoxedView<MTPuserStatusView> vstatus() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDuserRequestView {
+public:
+	MTPDuserRequestView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserView
+	}
+
+	MTPint vid() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+	MTPlong vaccess_hash() const;
+	MTPstring vphone() const;
+	MTPBoxedView<MTPuserProfilePhotoView> vphoto() const;
+	MTPBoxedView<MTPuserStatusView> vstatus() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDuserForeignView {
+public:
+	MTPDuserForeignView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserView
+	}
+
+	MTPint vid() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+	MTPlong vaccess_hash() const;
+	MTPBoxedView<MTPuserProfilePhotoView> vphoto() const;
+	MTPBoxedView<MTPuserStatusView> vstatus() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDuserDeletedView {
+public:
+	MTPDuserDeletedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserView
+	}
+
+	MTPint vid() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPuserView { // fields of MTPuser are read on access
+public:
+	MTPuserView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDuserEmptyView c_userEmpty() const;
+	MTPDuserSelfView c_userSelf() const;
+	MTPDuserContactView c_userContact() const;
+	MTPDuserRequestView c_userRequest() const;
+	MTPDuserForeignView c_userForeign() const;
+	MTPDuserDeletedView c_userDeleted() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPuser read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDuserProfilePhotoView {
+public:
+	MTPDuserProfilePhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserProfilePhotoView
+	}
+
+	MTPlong vphoto_id() const;
+	MTPBoxedView<MTPfileLocationView> vphoto_small() const;
+	MTPBoxedView<MTPfileLocationView> vphoto_big() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPuserProfilePhotoView { // fields of MTPuserProfilePhoto are read on access
+public:
+	MTPuserProfilePhotoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDuserProfilePhotoView c_userProfilePhoto() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPuserProfilePhoto read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDuserStatusOnlineView {
+public:
+	MTPDuserStatusOnlineView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserStatusView
+	}
+
+	MTPint vexpires() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDuserStatusOfflineView {
+public:
+	MTPDuserStatusOfflineView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserStatusView
+	}
+
+	MTPint vwas_online() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPuserStatusView { // fields of MTPuserStatus are read on access
+public:
+	MTPuserStatusView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDuserStatusOnlineView c_userStatusOnline() const;
+	MTPDuserStatusOfflineView c_userStatusOffline() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPuserStatus read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDchatEmptyView {
+public:
+	MTPDchatEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatView
+	}
+
+	MTPint vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDchatView {
+public:
+	MTPDchatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatView
+	}
+
+	MTPint vid() const;
+	MTPstring vtitle() const;
+	MTPBoxedView<MTPchatPhotoView> vphoto() const;
+	MTPint vparticipants_count() const;
+	MTPint vdate() const;
+	MTPBoxedView<MTPbool> vleft() const;
+	MTPint vversion() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDchatForbiddenView {
+public:
+	MTPDchatForbiddenView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatView
+	}
+
+	MTPint vid() const;
+	MTPstring vtitle() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDgeoChatView {
+public:
+	MTPDgeoChatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatView
+	}
+
+	MTPint vid() const;
+	MTPlong vaccess_hash() const;
+	MTPstring vtitle() const;
+	MTPstring vaddress() const;
+	MTPstring vvenue() const;
+	MTPBoxedView<MTPgeoPointView> vgeo() const;
+	MTPBoxedView<MTPchatPhotoView> vphoto() const;
+	MTPint vparticipants_count() const;
+	MTPint vdate() const;
+	MTPBoxedView<MTPbool> vchecked_in() const;
+	MTPint vversion() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPchatView { // fields of MTPchat are read on access
+public:
+	MTPchatView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDchatEmptyView c_chatEmpty() const;
+	MTPDchatView c_chat() const;
+	MTPDchatForbiddenView c_chatForbidden() const;
+	MTPDgeoChatView c_geoChat() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPchat read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDchatFullView {
+public:
+	MTPDchatFullView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatFullView
+	}
+
+	MTPint vid() const;
+	MTPBoxedView<MTPchatParticipantsView> vparticipants() const;
+	MTPBoxedView<MTPphotoView> vchat_photo() const;
+	MTPBoxedView<MTPpeerNotifySettingsView> vnotify_settings() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPchatFullView { // fields of MTPchatFull are read on access
+public:
+	MTPchatFullView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatFull) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDchatFullView c_chatFull() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPchatFull read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatFull);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDchatParticipantView {
+public:
+	MTPDchatParticipantView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatParticipantView
+	}
+
+	MTPint vuser_id() const;
+	MTPint vinviter_id() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPchatParticipantView { // fields of MTPchatParticipant are read on access
+public:
+	MTPchatParticipantView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatParticipant) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDchatParticipantView c_chatParticipant() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPchatParticipant read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatParticipant);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDchatParticipantsForbiddenView {
+public:
+	MTPDchatParticipantsForbiddenView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatParticipantsView
+	}
+
+	MTPint vchat_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDchatParticipantsView {
+public:
+	MTPDchatParticipantsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatParticipantsView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vadmin_id() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatParticipantView> > > vparticipants() const;
+	MTPint vversion() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPchatParticipantsView { // fields of MTPchatParticipants are read on access
+public:
+	MTPchatParticipantsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDchatParticipantsForbiddenView c_chatParticipantsForbidden() const;
+	MTPDchatParticipantsView c_chatParticipants() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPchatParticipants read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDchatPhotoView {
+public:
+	MTPDchatPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatPhotoView
+	}
+
+	MTPBoxedView<MTPfileLocationView> vphoto_small() const;
+	MTPBoxedView<MTPfileLocationView> vphoto_big() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPchatPhotoView { // fields of MTPchatPhoto are read on access
+public:
+	MTPchatPhotoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDchatPhotoView c_chatPhoto() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPchatPhoto read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessageEmptyView {
+public:
+	MTPDmessageEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageView
+	}
+
+	MTPint vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageView {
+public:
+	MTPDmessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageView
+	}
+
+	MTPint vid() const;
+	MTPint vfrom_id() const;
+	MTPBoxedView<MTPpeerView> vto_id() const;
+	MTPBoxedView<MTPbool> vout() const;
+	MTPBoxedView<MTPbool> vunread() const;
+	MTPint vdate() const;
+	MTPstring vmessage() const;
+	MTPBoxedView<MTPmessageMediaView> vmedia() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageForwardedView {
+public:
+	MTPDmessageForwardedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageView
+	}
+
+	MTPint vid() const;
+	MTPint vfwd_from_id() const;
+	MTPint vfwd_date() const;
+	MTPint vfrom_id() const;
+	MTPBoxedView<MTPpeerView> vto_id() const;
+	MTPBoxedView<MTPbool> vout() const;
+	MTPBoxedView<MTPbool> vunread() const;
+	MTPint vdate() const;
+	MTPstring vmessage() const;
+	MTPBoxedView<MTPmessageMediaView> vmedia() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageServiceView {
+public:
+	MTPDmessageServiceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageView
+	}
+
+	MTPint vid() const;
+	MTPint vfrom_id() const;
+	MTPBoxedView<MTPpeerView> vto_id() const;
+	MTPBoxedView<MTPbool> vout() const;
+	MTPBoxedView<MTPbool> vunread() const;
+	MTPint vdate() const;
+	MTPBoxedView<MTPmessageActionView> vaction() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessageView { // fields of MTPmessage are read on access
+public:
+	MTPmessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessageEmptyView c_messageEmpty() const;
+	MTPDmessageView c_message() const;
+	MTPDmessageForwardedView c_messageForwarded() const;
+	MTPDmessageServiceView c_messageService() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessageMediaPhotoView {
+public:
+	MTPDmessageMediaPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPBoxedView<MTPphotoView> vphoto() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageMediaVideoView {
+public:
+	MTPDmessageMediaVideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPBoxedView<MTPvideoView> vvideo() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageMediaGeoView {
+public:
+	MTPDmessageMediaGeoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPBoxedView<MTPgeoPointView> vgeo() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageMediaContactView {
+public:
+	MTPDmessageMediaContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPstring vphone_number() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageMediaUnsupportedView {
+public:
+	MTPDmessageMediaUnsupportedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPbytes vbytes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageMediaDocumentView {
+public:
+	MTPDmessageMediaDocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPBoxedView<MTPdocumentView> vdocument() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageMediaAudioView {
+public:
+	MTPDmessageMediaAudioView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageMediaView
+	}
+
+	MTPBoxedView<MTPaudioView> vaudio() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessageMediaView { // fields of MTPmessageMedia are read on access
+public:
+	MTPmessageMediaView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessageMediaPhotoView c_messageMediaPhoto() const;
+	MTPDmessageMediaVideoView c_messageMediaVideo() const;
+	MTPDmessageMediaGeoView c_messageMediaGeo() const;
+	MTPDmessageMediaContactView c_messageMediaContact() const;
+	MTPDmessageMediaUnsupportedView c_messageMediaUnsupported() const;
+	MTPDmessageMediaDocumentView c_messageMediaDocument() const;
+	MTPDmessageMediaAudioView c_messageMediaAudio() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessageMedia read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessageActionChatCreateView {
+public:
+	MTPDmessageActionChatCreateView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageActionView
+	}
+
+	MTPstring vtitle() const;
+	MTPBoxedView<MTPvectorView<MTPint > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageActionChatEditTitleView {
+public:
+	MTPDmessageActionChatEditTitleView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageActionView
+	}
+
+	MTPstring vtitle() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageActionChatEditPhotoView {
+public:
+	MTPDmessageActionChatEditPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageActionView
+	}
+
+	MTPBoxedView<MTPphotoView> vphoto() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageActionChatAddUserView {
+public:
+	MTPDmessageActionChatAddUserView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageActionView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageActionChatDeleteUserView {
+public:
+	MTPDmessageActionChatDeleteUserView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageActionView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessageActionGeoChatCreateView {
+public:
+	MTPDmessageActionGeoChatCreateView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessageActionView
+	}
+
+	MTPstring vtitle() const;
+	MTPstring vaddress() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessageActionView { // fields of MTPmessageAction are read on access
+public:
+	MTPmessageActionView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessageActionChatCreateView c_messageActionChatCreate() const;
+	MTPDmessageActionChatEditTitleView c_messageActionChatEditTitle() const;
+	MTPDmessageActionChatEditPhotoView c_messageActionChatEditPhoto() const;
+	MTPDmessageActionChatAddUserView c_messageActionChatAddUser() const;
+	MTPDmessageActionChatDeleteUserView c_messageActionChatDeleteUser() const;
+	MTPDmessageActionGeoChatCreateView c_messageActionGeoChatCreate() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessageAction read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdialogView {
+public:
+	MTPDdialogView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdialogView
+	}
+
+	MTPBoxedView<MTPpeerView> vpeer() const;
+	MTPint vtop_message() const;
+	MTPint vunread_count() const;
+	MTPBoxedView<MTPpeerNotifySettingsView> vnotify_settings() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdialogView { // fields of MTPdialog are read on access
+public:
+	MTPdialogView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dialog) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdialogView c_dialog() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdialog read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dialog);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDphotoEmptyView {
+public:
+	MTPDphotoEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotoView
+	}
+
+	MTPlong vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDphotoView {
+public:
+	MTPDphotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotoView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+	MTPstring vcaption() const;
+	MTPBoxedView<MTPgeoPointView> vgeo() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > > vsizes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPphotoView { // fields of MTPphoto are read on access
+public:
+	MTPphotoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDphotoEmptyView c_photoEmpty() const;
+	MTPDphotoView c_photo() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPphoto read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDphotoSizeEmptyView {
+public:
+	MTPDphotoSizeEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotoSizeView
+	}
+
+	MTPstring vtype() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDphotoSizeView {
+public:
+	MTPDphotoSizeView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotoSizeView
+	}
+
+	MTPstring vtype() const;
+	MTPBoxedView<MTPfileLocationView> vlocation() const;
+	MTPint vw() const;
+	MTPint vh() const;
+	MTPint vsize() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDphotoCachedSizeView {
+public:
+	MTPDphotoCachedSizeView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotoSizeView
+	}
+
+	MTPstring vtype() const;
+	MTPBoxedView<MTPfileLocationView> vlocation() const;
+	MTPint vw() const;
+	MTPint vh() const;
+	MTPbytes vbytes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPphotoSizeView { // fields of MTPphotoSize are read on access
+public:
+	MTPphotoSizeView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDphotoSizeEmptyView c_photoSizeEmpty() const;
+	MTPDphotoSizeView c_photoSize() const;
+	MTPDphotoCachedSizeView c_photoCachedSize() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPphotoSize read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDvideoEmptyView {
+public:
+	MTPDvideoEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPvideoView
+	}
+
+	MTPlong vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDvideoView {
+public:
+	MTPDvideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPvideoView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+	MTPstring vcaption() const;
+	MTPint vduration() const;
+	MTPstring vmime_type() const;
+	MTPint vsize() const;
+	MTPBoxedView<MTPphotoSizeView> vthumb() const;
+	MTPint vdc_id() const;
+	MTPint vw() const;
+	MTPint vh() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPvideoView { // fields of MTPvideo are read on access
+public:
+	MTPvideoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDvideoEmptyView c_videoEmpty() const;
+	MTPDvideoView c_video() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPvideo read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDgeoPointView {
+public:
+	MTPDgeoPointView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeoPointView
+	}
+
+	MTPdouble vlong() const;
+	MTPdouble vlat() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPgeoPointView { // fields of MTPgeoPoint are read on access
+public:
+	MTPgeoPointView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDgeoPointView c_geoPoint() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPgeoPoint read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDauth_checkedPhoneView {
+public:
+	MTPDauth_checkedPhoneView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPauth_checkedPhoneView
+	}
+
+	MTPBoxedView<MTPbool> vphone_registered() const;
+	MTPBoxedView<MTPbool> vphone_invited() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPauth_checkedPhoneView { // fields of MTPauth_checkedPhone are read on access
+public:
+	MTPauth_checkedPhoneView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkedPhone) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDauth_checkedPhoneView c_auth_checkedPhone() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPauth_checkedPhone read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkedPhone);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDauth_sentCodeView {
+public:
+	MTPDauth_sentCodeView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPauth_sentCodeView
+	}
+
+	MTPBoxedView<MTPbool> vphone_registered() const;
+	MTPstring vphone_code_hash() const;
+	MTPint vsend_call_timeout() const;
+	MTPBoxedView<MTPbool> vis_password() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPauth_sentCodeView { // fields of MTPauth_sentCode are read on access
+public:
+	MTPauth_sentCodeView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sentCode) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDauth_sentCodeView c_auth_sentCode() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPauth_sentCode read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sentCode);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDauth_authorizationView {
+public:
+	MTPDauth_authorizationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPauth_authorizationView
+	}
+
+	MTPint vexpires() const;
+	MTPBoxedView<MTPuserView> vuser() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPauth_authorizationView { // fields of MTPauth_authorization are read on access
+public:
+	MTPauth_authorizationView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_authorization) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDauth_authorizationView c_auth_authorization() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPauth_authorization read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_authorization);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDauth_exportedAuthorizationView {
+public:
+	MTPDauth_exportedAuthorizationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPauth_exportedAuthorizationView
+	}
+
+	MTPint vid() const;
+	MTPbytes vbytes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPauth_exportedAuthorizationView { // fields of MTPauth_exportedAuthorization are read on access
+public:
+	MTPauth_exportedAuthorizationView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_exportedAuthorization) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDauth_exportedAuthorizationView c_auth_exportedAuthorization() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPauth_exportedAuthorization read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_exportedAuthorization);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputNotifyPeerView {
+public:
+	MTPDinputNotifyPeerView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputNotifyPeerView
+	}
+
+	MTPBoxedView<MTPinputPeerView> vpeer() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputNotifyGeoChatPeerView {
+public:
+	MTPDinputNotifyGeoChatPeerView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputNotifyPeerView
+	}
+
+	MTPBoxedView<MTPinputGeoChatView> vpeer() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputNotifyPeerView { // fields of MTPinputNotifyPeer are read on access
+public:
+	MTPinputNotifyPeerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputNotifyPeerView c_inputNotifyPeer() const;
+	MTPDinputNotifyGeoChatPeerView c_inputNotifyGeoChatPeer() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputNotifyPeer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPinputPeerNotifyEventsView { // fields of MTPinputPeerNotifyEvents are read on access
+public:
+	MTPinputPeerNotifyEventsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputPeerNotifyEvents read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputPeerNotifySettingsView {
+public:
+	MTPDinputPeerNotifySettingsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputPeerNotifySettingsView
+	}
+
+	MTPint vmute_until() const;
+	MTPstring vsound() const;
+	MTPBoxedView<MTPbool> vshow_previews() const;
+	MTPint vevents_mask() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputPeerNotifySettingsView { // fields of MTPinputPeerNotifySettings are read on access
+public:
+	MTPinputPeerNotifySettingsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPeerNotifySettings) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputPeerNotifySettingsView c_inputPeerNotifySettings() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputPeerNotifySettings read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPeerNotifySettings);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPpeerNotifyEventsView { // fields of MTPpeerNotifyEvents are read on access
+public:
+	MTPpeerNotifyEventsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPpeerNotifyEvents read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDpeerNotifySettingsView {
+public:
+	MTPDpeerNotifySettingsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPpeerNotifySettingsView
+	}
+
+	MTPint vmute_until() const;
+	MTPstring vsound() const;
+	MTPBoxedView<MTPbool> vshow_previews() const;
+	MTPint vevents_mask() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPpeerNotifySettingsView { // fields of MTPpeerNotifySettings are read on access
+public:
+	MTPpeerNotifySettingsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDpeerNotifySettingsView c_peerNotifySettings() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPpeerNotifySettings read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDwallPaperView {
+public:
+	MTPDwallPaperView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPwallPaperView
+	}
+
+	MTPint vid() const;
+	MTPstring vtitle() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > > vsizes() const;
+	MTPint vcolor() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDwallPaperSolidView {
+public:
+	MTPDwallPaperSolidView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPwallPaperView
+	}
+
+	MTPint vid() const;
+	MTPstring vtitle() const;
+	MTPint vbg_color() const;
+	MTPint vcolor() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPwallPaperView { // fields of MTPwallPaper are read on access
+public:
+	MTPwallPaperView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDwallPaperView c_wallPaper() const;
+	MTPDwallPaperSolidView c_wallPaperSolid() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPwallPaper read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDuserFullView {
+public:
+	MTPDuserFullView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPuserFullView
+	}
+
+	MTPBoxedView<MTPuserView> vuser() const;
+	MTPBoxedView<MTPcontacts_linkView> vlink() const;
+	MTPBoxedView<MTPphotoView> vprofile_photo() const;
+	MTPBoxedView<MTPpeerNotifySettingsView> vnotify_settings() const;
+	MTPBoxedView<MTPbool> vblocked() const;
+	MTPstring vreal_first_name() const;
+	MTPstring vreal_last_name() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPuserFullView { // fields of MTPuserFull are read on access
+public:
+	MTPuserFullView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_userFull) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDuserFullView c_userFull() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPuserFull read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_userFull);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontactView {
+public:
+	MTPDcontactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontactView
+	}
+
+	MTPint vuser_id() const;
+	MTPBoxedView<MTPbool> vmutual() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontactView { // fields of MTPcontact are read on access
+public:
+	MTPcontactView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contact) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontactView c_contact() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontact read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contact);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDimportedContactView {
+public:
+	MTPDimportedContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPimportedContactView
+	}
+
+	MTPint vuser_id() const;
+	MTPlong vclient_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPimportedContactView { // fields of MTPimportedContact are read on access
+public:
+	MTPimportedContactView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_importedContact) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDimportedContactView c_importedContact() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPimportedContact read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_importedContact);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontactBlockedView {
+public:
+	MTPDcontactBlockedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontactBlockedView
+	}
+
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontactBlockedView { // fields of MTPcontactBlocked are read on access
+public:
+	MTPcontactBlockedView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactBlocked) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontactBlockedView c_contactBlocked() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontactBlocked read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactBlocked);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontactFoundView {
+public:
+	MTPDcontactFoundView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontactFoundView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontactFoundView { // fields of MTPcontactFound are read on access
+public:
+	MTPcontactFoundView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactFound) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontactFoundView c_contactFound() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontactFound read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactFound);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontactSuggestedView {
+public:
+	MTPDcontactSuggestedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontactSuggestedView
+	}
+
+	MTPint vuser_id() const;
+	MTPint vmutual_contacts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontactSuggestedView { // fields of MTPcontactSuggested are read on access
+public:
+	MTPcontactSuggestedView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactSuggested) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontactSuggestedView c_contactSuggested() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontactSuggested read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactSuggested);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontactStatusView {
+public:
+	MTPDcontactStatusView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontactStatusView
+	}
+
+	MTPint vuser_id() const;
+	MTPint vexpires() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontactStatusView { // fields of MTPcontactStatus are read on access
+public:
+	MTPcontactStatusView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactStatus) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontactStatusView c_contactStatus() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontactStatus read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactStatus);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDchatLocatedView {
+public:
+	MTPDchatLocatedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPchatLocatedView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vdistance() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPchatLocatedView { // fields of MTPchatLocated are read on access
+public:
+	MTPchatLocatedView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatLocated) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDchatLocatedView c_chatLocated() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPchatLocated read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatLocated);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_foreignLinkRequestedView {
+public:
+	MTPDcontacts_foreignLinkRequestedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_foreignLinkView
+	}
+
+	MTPBoxedView<MTPbool> vhas_phone() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_foreignLinkView { // fields of MTPcontacts_foreignLink are read on access
+public:
+	MTPcontacts_foreignLinkView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_foreignLinkRequestedView c_contacts_foreignLinkRequested() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_foreignLink read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_myLinkRequestedView {
+public:
+	MTPDcontacts_myLinkRequestedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_myLinkView
+	}
+
+	MTPBoxedView<MTPbool> vcontact() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_myLinkView { // fields of MTPcontacts_myLink are read on access
+public:
+	MTPcontacts_myLinkView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_myLinkRequestedView c_contacts_myLinkRequested() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_myLink read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_linkView {
+public:
+	MTPDcontacts_linkView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_linkView
+	}
+
+	MTPBoxedView<MTPcontacts_myLinkView> vmy_link() const;
+	MTPBoxedView<MTPcontacts_foreignLinkView> vforeign_link() const;
+	MTPBoxedView<MTPuserView> vuser() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_linkView { // fields of MTPcontacts_link are read on access
+public:
+	MTPcontacts_linkView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_link) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_linkView c_contacts_link() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_link read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_link);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_contactsView {
+public:
+	MTPDcontacts_contactsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_contactsView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactView> > > vcontacts() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_contactsView { // fields of MTPcontacts_contacts are read on access
+public:
+	MTPcontacts_contactsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_contactsView c_contacts_contacts() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_contacts read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_importedContactsView {
+public:
+	MTPDcontacts_importedContactsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_importedContactsView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPimportedContactView> > > vimported() const;
+	MTPBoxedView<MTPvectorView<MTPlong > > vretry_contacts() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_importedContactsView { // fields of MTPcontacts_importedContacts are read on access
+public:
+	MTPcontacts_importedContactsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importedContacts) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_importedContactsView c_contacts_importedContacts() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_importedContacts read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importedContacts);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_blockedView {
+public:
+	MTPDcontacts_blockedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_blockedView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > > vblocked() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDcontacts_blockedSliceView {
+public:
+	MTPDcontacts_blockedSliceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_blockedView
+	}
+
+	MTPint vcount() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > > vblocked() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_blockedView { // fields of MTPcontacts_blocked are read on access
+public:
+	MTPcontacts_blockedView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_blockedView c_contacts_blocked() const;
+	MTPDcontacts_blockedSliceView c_contacts_blockedSlice() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_blocked read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_foundView {
+public:
+	MTPDcontacts_foundView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_foundView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactFoundView> > > vresults() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_foundView { // fields of MTPcontacts_found are read on access
+public:
+	MTPcontacts_foundView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_found) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_foundView c_contacts_found() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_found read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_found);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDcontacts_suggestedView {
+public:
+	MTPDcontacts_suggestedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPcontacts_suggestedView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactSuggestedView> > > vresults() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPcontacts_suggestedView { // fields of MTPcontacts_suggested are read on access
+public:
+	MTPcontacts_suggestedView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_suggested) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDcontacts_suggestedView c_contacts_suggested() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPcontacts_suggested read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_suggested);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_dialogsView {
+public:
+	MTPDmessages_dialogsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_dialogsView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > > vdialogs() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_dialogsSliceView {
+public:
+	MTPDmessages_dialogsSliceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_dialogsView
+	}
+
+	MTPint vcount() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > > vdialogs() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_dialogsView { // fields of MTPmessages_dialogs are read on access
+public:
+	MTPmessages_dialogsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_dialogsView c_messages_dialogs() const;
+	MTPDmessages_dialogsSliceView c_messages_dialogsSlice() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_dialogs read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_messagesView {
+public:
+	MTPDmessages_messagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_messagesView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_messagesSliceView {
+public:
+	MTPDmessages_messagesSliceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_messagesView
+	}
+
+	MTPint vcount() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_messagesView { // fields of MTPmessages_messages are read on access
+public:
+	MTPmessages_messagesView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_messagesView c_messages_messages() const;
+	MTPDmessages_messagesSliceView c_messages_messagesSlice() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_messages read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_messageView {
+public:
+	MTPDmessages_messageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_messageView
+	}
+
+	MTPBoxedView<MTPmessageView> vmessage() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_messageView { // fields of MTPmessages_message are read on access
+public:
+	MTPmessages_messageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_messageView c_messages_message() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_message read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_statedMessagesView {
+public:
+	MTPDmessages_statedMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_statedMessagesView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPint vpts() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_statedMessagesLinksView {
+public:
+	MTPDmessages_statedMessagesLinksView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_statedMessagesView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > > vlinks() const;
+	MTPint vpts() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_statedMessagesView { // fields of MTPmessages_statedMessages are read on access
+public:
+	MTPmessages_statedMessagesView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_statedMessagesView c_messages_statedMessages() const;
+	MTPDmessages_statedMessagesLinksView c_messages_statedMessagesLinks() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_statedMessages read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_statedMessageView {
+public:
+	MTPDmessages_statedMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_statedMessageView
+	}
+
+	MTPBoxedView<MTPmessageView> vmessage() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPint vpts() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_statedMessageLinkView {
+public:
+	MTPDmessages_statedMessageLinkView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_statedMessageView
+	}
+
+	MTPBoxedView<MTPmessageView> vmessage() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > > vlinks() const;
+	MTPint vpts() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_statedMessageView { // fields of MTPmessages_statedMessage are read on access
+public:
+	MTPmessages_statedMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_statedMessageView c_messages_statedMessage() const;
+	MTPDmessages_statedMessageLinkView c_messages_statedMessageLink() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_statedMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_sentMessageView {
+public:
+	MTPDmessages_sentMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_sentMessageView
+	}
+
+	MTPint vid() const;
+	MTPint vdate() const;
+	MTPint vpts() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_sentMessageLinkView {
+public:
+	MTPDmessages_sentMessageLinkView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_sentMessageView
+	}
+
+	MTPint vid() const;
+	MTPint vdate() const;
+	MTPint vpts() const;
+	MTPint vseq() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > > vlinks() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_sentMessageView { // fields of MTPmessages_sentMessage are read on access
+public:
+	MTPmessages_sentMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_sentMessageView c_messages_sentMessage() const;
+	MTPDmessages_sentMessageLinkView c_messages_sentMessageLink() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_sentMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_chatView {
+public:
+	MTPDmessages_chatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_chatView
+	}
+
+	MTPBoxedView<MTPchatView> vchat() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_chatView { // fields of MTPmessages_chat are read on access
+public:
+	MTPmessages_chatView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chat) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_chatView c_messages_chat() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_chat read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chat);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_chatsView {
+public:
+	MTPDmessages_chatsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_chatsView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_chatsView { // fields of MTPmessages_chats are read on access
+public:
+	MTPmessages_chatsView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chats) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_chatsView c_messages_chats() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_chats read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chats);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_chatFullView {
+public:
+	MTPDmessages_chatFullView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_chatFullView
+	}
+
+	MTPBoxedView<MTPchatFullView> vfull_chat() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_chatFullView { // fields of MTPmessages_chatFull are read on access
+public:
+	MTPmessages_chatFullView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chatFull) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_chatFullView c_messages_chatFull() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_chatFull read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chatFull);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_affectedHistoryView {
+public:
+	MTPDmessages_affectedHistoryView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_affectedHistoryView
+	}
+
+	MTPint vpts() const;
+	MTPint vseq() const;
+	MTPint voffset() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_affectedHistoryView { // fields of MTPmessages_affectedHistory are read on access
+public:
+	MTPmessages_affectedHistoryView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_affectedHistory) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_affectedHistoryView c_messages_affectedHistory() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_affectedHistory read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_affectedHistory);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPmessagesFilterView { // fields of MTPmessagesFilter are read on access
+public:
+	MTPmessagesFilterView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessagesFilter read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDupdateNewMessageView {
+public:
+	MTPDupdateNewMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPmessageView> vmessage() const;
+	MTPint vpts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateMessageIDView {
+public:
+	MTPDupdateMessageIDView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vid() const;
+	MTPlong vrandom_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateReadMessagesView {
+public:
+	MTPDupdateReadMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPint > > vmessages() const;
+	MTPint vpts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateDeleteMessagesView {
+public:
+	MTPDupdateDeleteMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPint > > vmessages() const;
+	MTPint vpts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateRestoreMessagesView {
+public:
+	MTPDupdateRestoreMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPint > > vmessages() const;
+	MTPint vpts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateUserTypingView {
+public:
+	MTPDupdateUserTypingView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateChatUserTypingView {
+public:
+	MTPDupdateChatUserTypingView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateChatParticipantsView {
+public:
+	MTPDupdateChatParticipantsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPchatParticipantsView> vparticipants() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateUserStatusView {
+public:
+	MTPDupdateUserStatusView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+	MTPBoxedView<MTPuserStatusView> vstatus() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateUserNameView {
+public:
+	MTPDupdateUserNameView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateUserPhotoView {
+public:
+	MTPDupdateUserPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+	MTPBoxedView<MTPuserProfilePhotoView> vphoto() const;
+	MTPBoxedView<MTPbool> vprevious() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateContactRegisteredView {
+public:
+	MTPDupdateContactRegisteredView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateContactLinkView {
+public:
+	MTPDupdateContactLinkView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+	MTPBoxedView<MTPcontacts_myLinkView> vmy_link() const;
+	MTPBoxedView<MTPcontacts_foreignLinkView> vforeign_link() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateActivationView {
+public:
+	MTPDupdateActivationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateNewAuthorizationView {
+public:
+	MTPDupdateNewAuthorizationView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPlong vauth_key_id() const;
+	MTPint vdate() const;
+	MTPstring vdevice() const;
+	MTPstring vlocation() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateNewGeoChatMessageView {
+public:
+	MTPDupdateNewGeoChatMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPgeoChatMessageView> vmessage() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateNewEncryptedMessageView {
+public:
+	MTPDupdateNewEncryptedMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPencryptedMessageView> vmessage() const;
+	MTPint vqts() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateEncryptedChatTypingView {
+public:
+	MTPDupdateEncryptedChatTypingView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vchat_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateEncryptionView {
+public:
+	MTPDupdateEncryptionView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPencryptedChatView> vchat() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateEncryptedMessagesReadView {
+public:
+	MTPDupdateEncryptedMessagesReadView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vmax_date() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateChatParticipantAddView {
+public:
+	MTPDupdateChatParticipantAddView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vuser_id() const;
+	MTPint vinviter_id() const;
+	MTPint vversion() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateChatParticipantDeleteView {
+public:
+	MTPDupdateChatParticipantDeleteView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vuser_id() const;
+	MTPint vversion() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateDcOptionsView {
+public:
+	MTPDupdateDcOptionsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > > vdc_options() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateUserBlockedView {
+public:
+	MTPDupdateUserBlockedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPint vuser_id() const;
+	MTPBoxedView<MTPbool> vblocked() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateNotifySettingsView {
+public:
+	MTPDupdateNotifySettingsView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdateView
+	}
+
+	MTPBoxedView<MTPnotifyPeerView> vpeer() const;
+	MTPBoxedView<MTPpeerNotifySettingsView> vnotify_settings() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPupdateView { // fields of MTPupdate are read on access
+public:
+	MTPupdateView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDupdateNewMessageView c_updateNewMessage() const;
+	MTPDupdateMessageIDView c_updateMessageID() const;
+	MTPDupdateReadMessagesView c_updateReadMessages() const;
+	MTPDupdateDeleteMessagesView c_updateDeleteMessages() const;
+	MTPDupdateRestoreMessagesView c_updateRestoreMessages() const;
+	MTPDupdateUserTypingView c_updateUserTyping() const;
+	MTPDupdateChatUserTypingView c_updateChatUserTyping() const;
+	MTPDupdateChatParticipantsView c_updateChatParticipants() const;
+	MTPDupdateUserStatusView c_updateUserStatus() const;
+	MTPDupdateUserNameView c_updateUserName() const;
+	MTPDupdateUserPhotoView c_updateUserPhoto() const;
+	MTPDupdateContactRegisteredView c_updateContactRegistered() const;
+	MTPDupdateContactLinkView c_updateContactLink() const;
+	MTPDupdateActivationView c_updateActivation() const;
+	MTPDupdateNewAuthorizationView c_updateNewAuthorization() const;
+	MTPDupdateNewGeoChatMessageView c_updateNewGeoChatMessage() const;
+	MTPDupdateNewEncryptedMessageView c_updateNewEncryptedMessage() const;
+	MTPDupdateEncryptedChatTypingView c_updateEncryptedChatTyping() const;
+	MTPDupdateEncryptionView c_updateEncryption() const;
+	MTPDupdateEncryptedMessagesReadView c_updateEncryptedMessagesRead() const;
+	MTPDupdateChatParticipantAddView c_updateChatParticipantAdd() const;
+	MTPDupdateChatParticipantDeleteView c_updateChatParticipantDelete() const;
+	MTPDupdateDcOptionsView c_updateDcOptions() const;
+	MTPDupdateUserBlockedView c_updateUserBlocked() const;
+	MTPDupdateNotifySettingsView c_updateNotifySettings() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPupdate read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDupdates_stateView {
+public:
+	MTPDupdates_stateView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdates_stateView
+	}
+
+	MTPint vpts() const;
+	MTPint vqts() const;
+	MTPint vdate() const;
+	MTPint vseq() const;
+	MTPint vunread_count() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPupdates_stateView { // fields of MTPupdates_state are read on access
+public:
+	MTPupdates_stateView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_state) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDupdates_stateView c_updates_state() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPupdates_state read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_state);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDupdates_differenceEmptyView {
+public:
+	MTPDupdates_differenceEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdates_differenceView
+	}
+
+	MTPint vdate() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdates_differenceView {
+public:
+	MTPDupdates_differenceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdates_differenceView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vnew_messages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > > vnew_encrypted_messages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > vother_updates() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPBoxedView<MTPupdates_stateView> vstate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdates_differenceSliceView {
+public:
+	MTPDupdates_differenceSliceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdates_differenceView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > vnew_messages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > > vnew_encrypted_messages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > vother_updates() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPBoxedView<MTPupdates_stateView> vintermediate_state() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPupdates_differenceView { // fields of MTPupdates_difference are read on access
+public:
+	MTPupdates_differenceView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDupdates_differenceEmptyView c_updates_differenceEmpty() const;
+	MTPDupdates_differenceView c_updates_difference() const;
+	MTPDupdates_differenceSliceView c_updates_differenceSlice() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPupdates_difference read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDupdateShortMessageView {
+public:
+	MTPDupdateShortMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdatesView
+	}
+
+	MTPint vid() const;
+	MTPint vfrom_id() const;
+	MTPstring vmessage() const;
+	MTPint vpts() const;
+	MTPint vdate() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateShortChatMessageView {
+public:
+	MTPDupdateShortChatMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdatesView
+	}
+
+	MTPint vid() const;
+	MTPint vfrom_id() const;
+	MTPint vchat_id() const;
+	MTPstring vmessage() const;
+	MTPint vpts() const;
+	MTPint vdate() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdateShortView {
+public:
+	MTPDupdateShortView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdatesView
+	}
+
+	MTPBoxedView<MTPupdateView> vupdate() const;
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdatesCombinedView {
+public:
+	MTPDupdatesCombinedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdatesView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > vupdates() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPint vdate() const;
+	MTPint vseq_start() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDupdatesView {
+public:
+	MTPDupdatesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupdatesView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > vupdates() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPint vdate() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPupdatesView { // fields of MTPupdates are read on access
+public:
+	MTPupdatesView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDupdateShortMessageView c_updateShortMessage() const;
+	MTPDupdateShortChatMessageView c_updateShortChatMessage() const;
+	MTPDupdateShortView c_updateShort() const;
+	MTPDupdatesCombinedView c_updatesCombined() const;
+	MTPDupdatesView c_updates() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPupdates read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDphotos_photosView {
+public:
+	MTPDphotos_photosView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotos_photosView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > > vphotos() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDphotos_photosSliceView {
+public:
+	MTPDphotos_photosSliceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotos_photosView
+	}
+
+	MTPint vcount() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > > vphotos() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPphotos_photosView { // fields of MTPphotos_photos are read on access
+public:
+	MTPphotos_photosView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDphotos_photosView c_photos_photos() const;
+	MTPDphotos_photosSliceView c_photos_photosSlice() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPphotos_photos read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDphotos_photoView {
+public:
+	MTPDphotos_photoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPphotos_photoView
+	}
+
+	MTPBoxedView<MTPphotoView> vphoto() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPphotos_photoView { // fields of MTPphotos_photo are read on access
+public:
+	MTPphotos_photoView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_photo) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDphotos_photoView c_photos_photo() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPphotos_photo read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_photo);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDupload_fileView {
+public:
+	MTPDupload_fileView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPupload_fileView
+	}
+
+	MTPBoxedView<MTPstorage_fileTypeView> vtype() const;
+	MTPint vmtime() const;
+	MTPbytes vbytes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPupload_fileView { // fields of MTPupload_file are read on access
+public:
+	MTPupload_fileView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_file) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDupload_fileView c_upload_file() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPupload_file read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_file);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdcOptionView {
+public:
+	MTPDdcOptionView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdcOptionView
+	}
+
+	MTPint vid() const;
+	MTPstring vhostname() const;
+	MTPstring vip_address() const;
+	MTPint vport() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdcOptionView { // fields of MTPdcOption are read on access
+public:
+	MTPdcOptionView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dcOption) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdcOptionView c_dcOption() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdcOption read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dcOption);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDconfigView {
+public:
+	MTPDconfigView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPconfigView
+	}
+
+	MTPint vdate() const;
+	MTPBoxedView<MTPbool> vtest_mode() const;
+	MTPint vthis_dc() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > > vdc_options() const;
+	MTPint vchat_size_max() const;
+	MTPint vbroadcast_size_max() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPconfigView { // fields of MTPconfig are read on access
+public:
+	MTPconfigView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_config) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDconfigView c_config() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPconfig read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_config);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDnearestDcView {
+public:
+	MTPDnearestDcView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPnearestDcView
+	}
+
+	MTPstring vcountry() const;
+	MTPint vthis_dc() const;
+	MTPint vnearest_dc() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPnearestDcView { // fields of MTPnearestDc are read on access
+public:
+	MTPnearestDcView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_nearestDc) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDnearestDcView c_nearestDc() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPnearestDc read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_nearestDc);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDhelp_appUpdateView {
+public:
+	MTPDhelp_appUpdateView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPhelp_appUpdateView
+	}
+
+	MTPint vid() const;
+	MTPBoxedView<MTPbool> vcritical() const;
+	MTPstring vurl() const;
+	MTPstring vtext() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPhelp_appUpdateView { // fields of MTPhelp_appUpdate are read on access
+public:
+	MTPhelp_appUpdateView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDhelp_appUpdateView c_help_appUpdate() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPhelp_appUpdate read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDhelp_inviteTextView {
+public:
+	MTPDhelp_inviteTextView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPhelp_inviteTextView
+	}
+
+	MTPstring vmessage() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPhelp_inviteTextView { // fields of MTPhelp_inviteText are read on access
+public:
+	MTPhelp_inviteTextView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_inviteText) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDhelp_inviteTextView c_help_inviteText() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPhelp_inviteText read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_inviteText);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputGeoChatView {
+public:
+	MTPDinputGeoChatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputGeoChatView
+	}
+
+	MTPint vchat_id() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputGeoChatView { // fields of MTPinputGeoChat are read on access
+public:
+	MTPinputGeoChatView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputGeoChat) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputGeoChatView c_inputGeoChat() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputGeoChat read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputGeoChat);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDgeoChatMessageEmptyView {
+public:
+	MTPDgeoChatMessageEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeoChatMessageView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDgeoChatMessageView {
+public:
+	MTPDgeoChatMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeoChatMessageView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vid() const;
+	MTPint vfrom_id() const;
+	MTPint vdate() const;
+	MTPstring vmessage() const;
+	MTPBoxedView<MTPmessageMediaView> vmedia() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDgeoChatMessageServiceView {
+public:
+	MTPDgeoChatMessageServiceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeoChatMessageView
+	}
+
+	MTPint vchat_id() const;
+	MTPint vid() const;
+	MTPint vfrom_id() const;
+	MTPint vdate() const;
+	MTPBoxedView<MTPmessageActionView> vaction() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPgeoChatMessageView { // fields of MTPgeoChatMessage are read on access
+public:
+	MTPgeoChatMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDgeoChatMessageEmptyView c_geoChatMessageEmpty() const;
+	MTPDgeoChatMessageView c_geoChatMessage() const;
+	MTPDgeoChatMessageServiceView c_geoChatMessageService() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPgeoChatMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDgeochats_statedMessageView {
+public:
+	MTPDgeochats_statedMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeochats_statedMessageView
+	}
+
+	MTPBoxedView<MTPgeoChatMessageView> vmessage() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+	MTPint vseq() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPgeochats_statedMessageView { // fields of MTPgeochats_statedMessage are read on access
+public:
+	MTPgeochats_statedMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_statedMessage) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDgeochats_statedMessageView c_geochats_statedMessage() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPgeochats_statedMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_statedMessage);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDgeochats_locatedView {
+public:
+	MTPDgeochats_locatedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeochats_locatedView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > > vresults() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPgeochats_locatedView { // fields of MTPgeochats_located are read on access
+public:
+	MTPgeochats_locatedView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_located) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDgeochats_locatedView c_geochats_located() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPgeochats_located read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_located);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDgeochats_messagesView {
+public:
+	MTPDgeochats_messagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeochats_messagesView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDgeochats_messagesSliceView {
+public:
+	MTPDgeochats_messagesSliceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPgeochats_messagesView
+	}
+
+	MTPint vcount() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > > vmessages() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > vchats() const;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > vusers() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPgeochats_messagesView { // fields of MTPgeochats_messages are read on access
+public:
+	MTPgeochats_messagesView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDgeochats_messagesView c_geochats_messages() const;
+	MTPDgeochats_messagesSliceView c_geochats_messagesSlice() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPgeochats_messages read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDencryptedChatEmptyView {
+public:
+	MTPDencryptedChatEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedChatView
+	}
+
+	MTPint vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDencryptedChatWaitingView {
+public:
+	MTPDencryptedChatWaitingView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedChatView
+	}
+
+	MTPint vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vdate() const;
+	MTPint vadmin_id() const;
+	MTPint vparticipant_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDencryptedChatRequestedView {
+public:
+	MTPDencryptedChatRequestedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedChatView
+	}
+
+	MTPint vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vdate() const;
+	MTPint vadmin_id() const;
+	MTPint vparticipant_id() const;
+	MTPbytes vg_a() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDencryptedChatView {
+public:
+	MTPDencryptedChatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedChatView
+	}
+
+	MTPint vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vdate() const;
+	MTPint vadmin_id() const;
+	MTPint vparticipant_id() const;
+	MTPbytes vg_a_or_b() const;
+	MTPlong vkey_fingerprint() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDencryptedChatDiscardedView {
+public:
+	MTPDencryptedChatDiscardedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedChatView
+	}
+
+	MTPint vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPencryptedChatView { // fields of MTPencryptedChat are read on access
+public:
+	MTPencryptedChatView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDencryptedChatEmptyView c_encryptedChatEmpty() const;
+	MTPDencryptedChatWaitingView c_encryptedChatWaiting() const;
+	MTPDencryptedChatRequestedView c_encryptedChatRequested() const;
+	MTPDencryptedChatView c_encryptedChat() const;
+	MTPDencryptedChatDiscardedView c_encryptedChatDiscarded() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPencryptedChat read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputEncryptedChatView {
+public:
+	MTPDinputEncryptedChatView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputEncryptedChatView
+	}
+
+	MTPint vchat_id() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputEncryptedChatView { // fields of MTPinputEncryptedChat are read on access
+public:
+	MTPinputEncryptedChatView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputEncryptedChat) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputEncryptedChatView c_inputEncryptedChat() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputEncryptedChat read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputEncryptedChat);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDencryptedFileView {
+public:
+	MTPDencryptedFileView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedFileView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vsize() const;
+	MTPint vdc_id() const;
+	MTPint vkey_fingerprint() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPencryptedFileView { // fields of MTPencryptedFile are read on access
+public:
+	MTPencryptedFileView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDencryptedFileView c_encryptedFile() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPencryptedFile read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputEncryptedFileUploadedView {
+public:
+	MTPDinputEncryptedFileUploadedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputEncryptedFileView
+	}
+
+	MTPlong vid() const;
+	MTPint vparts() const;
+	MTPstring vmd5_checksum() const;
+	MTPint vkey_fingerprint() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputEncryptedFileView {
+public:
+	MTPDinputEncryptedFileView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputEncryptedFileView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDinputEncryptedFileBigUploadedView {
+public:
+	MTPDinputEncryptedFileBigUploadedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputEncryptedFileView
+	}
+
+	MTPlong vid() const;
+	MTPint vparts() const;
+	MTPint vkey_fingerprint() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputEncryptedFileView { // fields of MTPinputEncryptedFile are read on access
+public:
+	MTPinputEncryptedFileView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputEncryptedFileUploadedView c_inputEncryptedFileUploaded() const;
+	MTPDinputEncryptedFileView c_inputEncryptedFile() const;
+	MTPDinputEncryptedFileBigUploadedView c_inputEncryptedFileBigUploaded() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputEncryptedFile read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDencryptedMessageView {
+public:
+	MTPDencryptedMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedMessageView
+	}
+
+	MTPlong vrandom_id() const;
+	MTPint vchat_id() const;
+	MTPint vdate() const;
+	MTPbytes vbytes() const;
+	MTPBoxedView<MTPencryptedFileView> vfile() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDencryptedMessageServiceView {
+public:
+	MTPDencryptedMessageServiceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPencryptedMessageView
+	}
+
+	MTPlong vrandom_id() const;
+	MTPint vchat_id() const;
+	MTPint vdate() const;
+	MTPbytes vbytes() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPencryptedMessageView { // fields of MTPencryptedMessage are read on access
+public:
+	MTPencryptedMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDencryptedMessageView c_encryptedMessage() const;
+	MTPDencryptedMessageServiceView c_encryptedMessageService() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPencryptedMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdecryptedMessageLayerView {
+public:
+	MTPDdecryptedMessageLayerView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageLayerView
+	}
+
+	MTPint vlayer() const;
+	MTPBoxedView<MTPdecryptedMessageView> vmessage() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdecryptedMessageLayerView { // fields of MTPdecryptedMessageLayer are read on access
+public:
+	MTPdecryptedMessageLayerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_decryptedMessageLayer) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdecryptedMessageLayerView c_decryptedMessageLayer() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdecryptedMessageLayer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_decryptedMessageLayer);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdecryptedMessageView {
+public:
+	MTPDdecryptedMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageView
+	}
+
+	MTPlong vrandom_id() const;
+	MTPbytes vrandom_bytes() const;
+	MTPstring vmessage() const;
+	MTPBoxedView<MTPdecryptedMessageMediaView> vmedia() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageServiceView {
+public:
+	MTPDdecryptedMessageServiceView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageView
+	}
+
+	MTPlong vrandom_id() const;
+	MTPbytes vrandom_bytes() const;
+	MTPBoxedView<MTPdecryptedMessageActionView> vaction() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdecryptedMessageView { // fields of MTPdecryptedMessage are read on access
+public:
+	MTPdecryptedMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdecryptedMessageView c_decryptedMessage() const;
+	MTPDdecryptedMessageServiceView c_decryptedMessageService() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdecryptedMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdecryptedMessageMediaPhotoView {
+public:
+	MTPDdecryptedMessageMediaPhotoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageMediaView
+	}
+
+	MTPbytes vthumb() const;
+	MTPint vthumb_w() const;
+	MTPint vthumb_h() const;
+	MTPint vw() const;
+	MTPint vh() const;
+	MTPint vsize() const;
+	MTPbytes vkey() const;
+	MTPbytes viv() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageMediaVideoView {
+public:
+	MTPDdecryptedMessageMediaVideoView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageMediaView
+	}
+
+	MTPbytes vthumb() const;
+	MTPint vthumb_w() const;
+	MTPint vthumb_h() const;
+	MTPint vduration() const;
+	MTPstring vmime_type() const;
+	MTPint vw() const;
+	MTPint vh() const;
+	MTPint vsize() const;
+	MTPbytes vkey() const;
+	MTPbytes viv() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageMediaGeoPointView {
+public:
+	MTPDdecryptedMessageMediaGeoPointView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageMediaView
+	}
+
+	MTPdouble vlat() const;
+	MTPdouble vlong() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageMediaContactView {
+public:
+	MTPDdecryptedMessageMediaContactView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageMediaView
+	}
+
+	MTPstring vphone_number() const;
+	MTPstring vfirst_name() const;
+	MTPstring vlast_name() const;
+	MTPint vuser_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageMediaDocumentView {
+public:
+	MTPDdecryptedMessageMediaDocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageMediaView
+	}
+
+	MTPbytes vthumb() const;
+	MTPint vthumb_w() const;
+	MTPint vthumb_h() const;
+	MTPstring vfile_name() const;
+	MTPstring vmime_type() const;
+	MTPint vsize() const;
+	MTPbytes vkey() const;
+	MTPbytes viv() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageMediaAudioView {
+public:
+	MTPDdecryptedMessageMediaAudioView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageMediaView
+	}
+
+	MTPint vduration() const;
+	MTPstring vmime_type() const;
+	MTPint vsize() const;
+	MTPbytes vkey() const;
+	MTPbytes viv() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdecryptedMessageMediaView { // fields of MTPdecryptedMessageMedia are read on access
+public:
+	MTPdecryptedMessageMediaView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdecryptedMessageMediaPhotoView c_decryptedMessageMediaPhoto() const;
+	MTPDdecryptedMessageMediaVideoView c_decryptedMessageMediaVideo() const;
+	MTPDdecryptedMessageMediaGeoPointView c_decryptedMessageMediaGeoPoint() const;
+	MTPDdecryptedMessageMediaContactView c_decryptedMessageMediaContact() const;
+	MTPDdecryptedMessageMediaDocumentView c_decryptedMessageMediaDocument() const;
+	MTPDdecryptedMessageMediaAudioView c_decryptedMessageMediaAudio() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdecryptedMessageMedia read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdecryptedMessageActionSetMessageTTLView {
+public:
+	MTPDdecryptedMessageActionSetMessageTTLView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageActionView
+	}
+
+	MTPint vttl_seconds() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageActionReadMessagesView {
+public:
+	MTPDdecryptedMessageActionReadMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageActionView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vrandom_ids() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageActionDeleteMessagesView {
+public:
+	MTPDdecryptedMessageActionDeleteMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageActionView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vrandom_ids() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageActionScreenshotMessagesView {
+public:
+	MTPDdecryptedMessageActionScreenshotMessagesView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageActionView
+	}
+
+	MTPBoxedView<MTPvectorView<MTPlong > > vrandom_ids() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdecryptedMessageActionNotifyLayerView {
+public:
+	MTPDdecryptedMessageActionNotifyLayerView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdecryptedMessageActionView
+	}
+
+	MTPint vlayer() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdecryptedMessageActionView { // fields of MTPdecryptedMessageAction are read on access
+public:
+	MTPdecryptedMessageActionView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdecryptedMessageActionSetMessageTTLView c_decryptedMessageActionSetMessageTTL() const;
+	MTPDdecryptedMessageActionReadMessagesView c_decryptedMessageActionReadMessages() const;
+	MTPDdecryptedMessageActionDeleteMessagesView c_decryptedMessageActionDeleteMessages() const;
+	MTPDdecryptedMessageActionScreenshotMessagesView c_decryptedMessageActionScreenshotMessages() const;
+	MTPDdecryptedMessageActionNotifyLayerView c_decryptedMessageActionNotifyLayer() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdecryptedMessageAction read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_dhConfigNotModifiedView {
+public:
+	MTPDmessages_dhConfigNotModifiedView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_dhConfigView
+	}
+
+	MTPbytes vrandom() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_dhConfigView {
+public:
+	MTPDmessages_dhConfigView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_dhConfigView
+	}
+
+	MTPint vg() const;
+	MTPbytes vp() const;
+	MTPint vversion() const;
+	MTPbytes vrandom() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_dhConfigView { // fields of MTPmessages_dhConfig are read on access
+public:
+	MTPmessages_dhConfigView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_dhConfigNotModifiedView c_messages_dhConfigNotModified() const;
+	MTPDmessages_dhConfigView c_messages_dhConfig() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_dhConfig read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDmessages_sentEncryptedMessageView {
+public:
+	MTPDmessages_sentEncryptedMessageView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_sentEncryptedMessageView
+	}
+
+	MTPint vdate() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDmessages_sentEncryptedFileView {
+public:
+	MTPDmessages_sentEncryptedFileView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPmessages_sentEncryptedMessageView
+	}
+
+	MTPint vdate() const;
+	MTPBoxedView<MTPencryptedFileView> vfile() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPmessages_sentEncryptedMessageView { // fields of MTPmessages_sentEncryptedMessage are read on access
+public:
+	MTPmessages_sentEncryptedMessageView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDmessages_sentEncryptedMessageView c_messages_sentEncryptedMessage() const;
+	MTPDmessages_sentEncryptedFileView c_messages_sentEncryptedFile() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPmessages_sentEncryptedMessage read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputAudioView {
+public:
+	MTPDinputAudioView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputAudioView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputAudioView { // fields of MTPinputAudio are read on access
+public:
+	MTPinputAudioView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputAudioView c_inputAudio() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputAudio read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDinputDocumentView {
+public:
+	MTPDinputDocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPinputDocumentView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPinputDocumentView { // fields of MTPinputDocument are read on access
+public:
+	MTPinputDocumentView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDinputDocumentView c_inputDocument() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPinputDocument read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDaudioEmptyView {
+public:
+	MTPDaudioEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPaudioView
+	}
+
+	MTPlong vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDaudioView {
+public:
+	MTPDaudioView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPaudioView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+	MTPint vduration() const;
+	MTPstring vmime_type() const;
+	MTPint vsize() const;
+	MTPint vdc_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPaudioView { // fields of MTPaudio are read on access
+public:
+	MTPaudioView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDaudioEmptyView c_audioEmpty() const;
+	MTPDaudioView c_audio() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPaudio read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDdocumentEmptyView {
+public:
+	MTPDdocumentEmptyView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdocumentView
+	}
+
+	MTPlong vid() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPDdocumentView {
+public:
+	MTPDdocumentView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPdocumentView
+	}
+
+	MTPlong vid() const;
+	MTPlong vaccess_hash() const;
+	MTPint vuser_id() const;
+	MTPint vdate() const;
+	MTPstring vfile_name() const;
+	MTPstring vmime_type() const;
+	MTPint vsize() const;
+	MTPBoxedView<MTPphotoSizeView> vthumb() const;
+	MTPint vdc_id() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPdocumentView { // fields of MTPdocument are read on access
+public:
+	MTPdocumentView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDdocumentEmptyView c_documentEmpty() const;
+	MTPDdocumentView c_document() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPdocument read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDhelp_supportView {
+public:
+	MTPDhelp_supportView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPhelp_supportView
+	}
+
+	MTPstring vphone_number() const;
+	MTPBoxedView<MTPuserView> vuser() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPhelp_supportView { // fields of MTPhelp_support are read on access
+public:
+	MTPhelp_supportView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_support) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDhelp_supportView c_help_support() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPhelp_support read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_support);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+class MTPDnotifyPeerView {
+public:
+	MTPDnotifyPeerView(const mtpPrime *from, const mtpPrime *end) : _from(from), _end(end) { // range was checked by MTPnotifyPeerView
+	}
+
+	MTPBoxedView<MTPpeerView> vpeer() const;
+
+private:
+	const mtpPrime *_from, *_end;
+};
+
+class MTPnotifyPeerView { // fields of MTPnotifyPeer are read on access
+public:
+	MTPnotifyPeerView(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) : _from(from), _type(cons) {
+		skip(from, end, cons);
+		_end = from;
+	}
+
+	MTPDnotifyPeerView c_notifyPeer() const;
+
+	mtpTypeId type() const {
+		return _type;
+	}
+	MTPnotifyPeer read() const; // materializes the value, for the consumers that need it whole
+	static void skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+
+private:
+	const mtpPrime *_from, *_end;
+	mtpTypeId _type;
+};
+
+// Lazy views inline methods definition
+
+inline MTPint128 MTPDresPQView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDresPQView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPstring MTPDresPQView::vpq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDresPQView::vserver_public_key_fingerprints() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDresPQView MTPresPQView::c_resPQ() const {
+	return MTPDresPQView(_from, _end);
+}
+
+inline MTPresPQ MTPresPQView::read() const {
+	const mtpPrime *from = _from;
+	return MTPresPQ(from, _end, _type);
+}
+
+inline void MTPresPQView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_resPQ) throw mtpErrorUnexpected(cons, "MTPresPQView");
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+}
+
+inline MTPstring MTPDp_q_inner_dataView::vpq() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDp_q_inner_dataView::vp() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDp_q_inner_dataView::vq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint128 MTPDp_q_inner_dataView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDp_q_inner_dataView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint256 MTPDp_q_inner_dataView::vnew_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint256(from, end);
+}
+
+inline MTPDp_q_inner_dataView MTPp_Q_inner_dataView::c_p_q_inner_data() const {
+	return MTPDp_q_inner_dataView(_from, _end);
+}
+
+inline MTPp_Q_inner_data MTPp_Q_inner_dataView::read() const {
+	const mtpPrime *from = _from;
+	return MTPp_Q_inner_data(from, _end, _type);
+}
+
+inline void MTPp_Q_inner_dataView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_p_q_inner_data) throw mtpErrorUnexpected(cons, "MTPp_Q_inner_dataView");
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint256::skip(from, end);
+}
+
+inline MTPint128 MTPDserver_DH_params_failView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDserver_DH_params_failView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDserver_DH_params_failView::vnew_nonce_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPDserver_DH_params_failView MTPserver_DH_ParamsView::c_server_DH_params_fail() const {
+	if (_type != mtpc_server_DH_params_fail) throw mtpErrorWrongTypeId(_type, mtpc_server_DH_params_fail);
+	return MTPDserver_DH_params_failView(_from, _end);
+}
+
+inline MTPint128 MTPDserver_DH_params_okView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDserver_DH_params_okView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPstring MTPDserver_DH_params_okView::vencrypted_answer() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDserver_DH_params_okView MTPserver_DH_ParamsView::c_server_DH_params_ok() const {
+	if (_type != mtpc_server_DH_params_ok) throw mtpErrorWrongTypeId(_type, mtpc_server_DH_params_ok);
+	return MTPDserver_DH_params_okView(_from, _end);
+}
+
+inline MTPserver_DH_Params MTPserver_DH_ParamsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPserver_DH_Params(from, _end, _type);
+}
+
+inline void MTPserver_DH_ParamsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_server_DH_params_fail:
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+		break;
+		case mtpc_server_DH_params_ok:
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPserver_DH_ParamsView");
+	}
+}
+
+inline MTPint128 MTPDserver_DH_inner_dataView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDserver_DH_inner_dataView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint MTPDserver_DH_inner_dataView::vg() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDserver_DH_inner_dataView::vdh_prime() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDserver_DH_inner_dataView::vg_a() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDserver_DH_inner_dataView::vserver_time() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDserver_DH_inner_dataView MTPserver_DH_inner_dataView::c_server_DH_inner_data() const {
+	return MTPDserver_DH_inner_dataView(_from, _end);
+}
+
+inline MTPserver_DH_inner_data MTPserver_DH_inner_dataView::read() const {
+	const mtpPrime *from = _from;
+	return MTPserver_DH_inner_data(from, _end, _type);
+}
+
+inline void MTPserver_DH_inner_dataView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_server_DH_inner_data) throw mtpErrorUnexpected(cons, "MTPserver_DH_inner_dataView");
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint128 MTPDclient_DH_inner_dataView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDclient_DH_inner_dataView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPlong MTPDclient_DH_inner_dataView::vretry_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDclient_DH_inner_dataView::vg_b() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDclient_DH_inner_dataView MTPclient_DH_Inner_DataView::c_client_DH_inner_data() const {
+	return MTPDclient_DH_inner_dataView(_from, _end);
+}
+
+inline MTPclient_DH_Inner_Data MTPclient_DH_Inner_DataView::read() const {
+	const mtpPrime *from = _from;
+	return MTPclient_DH_Inner_Data(from, _end, _type);
+}
+
+inline void MTPclient_DH_Inner_DataView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_client_DH_inner_data) throw mtpErrorUnexpected(cons, "MTPclient_DH_Inner_DataView");
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_okView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_okView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_okView::vnew_nonce_hash1() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPDdh_gen_okView MTPset_client_DH_params_answerView::c_dh_gen_ok() const {
+	if (_type != mtpc_dh_gen_ok) throw mtpErrorWrongTypeId(_type, mtpc_dh_gen_ok);
+	return MTPDdh_gen_okView(_from, _end);
+}
+
+inline MTPint128 MTPDdh_gen_retryView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_retryView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_retryView::vnew_nonce_hash2() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPDdh_gen_retryView MTPset_client_DH_params_answerView::c_dh_gen_retry() const {
+	if (_type != mtpc_dh_gen_retry) throw mtpErrorWrongTypeId(_type, mtpc_dh_gen_retry);
+	return MTPDdh_gen_retryView(_from, _end);
+}
+
+inline MTPint128 MTPDdh_gen_failView::vnonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_failView::vserver_nonce() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPint128 MTPDdh_gen_failView::vnew_nonce_hash3() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint128::skip(from, end);
+	MTPint128::skip(from, end);
+	return MTPint128(from, end);
+}
+
+inline MTPDdh_gen_failView MTPset_client_DH_params_answerView::c_dh_gen_fail() const {
+	if (_type != mtpc_dh_gen_fail) throw mtpErrorWrongTypeId(_type, mtpc_dh_gen_fail);
+	return MTPDdh_gen_failView(_from, _end);
+}
+
+inline MTPset_client_DH_params_answer MTPset_client_DH_params_answerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPset_client_DH_params_answer(from, _end, _type);
+}
+
+inline void MTPset_client_DH_params_answerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_dh_gen_ok:
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+		break;
+		case mtpc_dh_gen_retry:
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+		break;
+		case mtpc_dh_gen_fail:
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+			MTPint128::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPset_client_DH_params_answerView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDmsgs_ackView::vmsg_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDmsgs_ackView MTPmsgsAckView::c_msgs_ack() const {
+	return MTPDmsgs_ackView(_from, _end);
+}
+
+inline MTPmsgsAck MTPmsgsAckView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmsgsAck(from, _end, _type);
+}
+
+inline void MTPmsgsAckView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_ack) throw mtpErrorUnexpected(cons, "MTPmsgsAckView");
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+}
+
+inline MTPlong MTPDbad_msg_notificationView::vbad_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDbad_msg_notificationView::vbad_msg_seqno() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDbad_msg_notificationView::verror_code() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDbad_msg_notificationView MTPbadMsgNotificationView::c_bad_msg_notification() const {
+	if (_type != mtpc_bad_msg_notification) throw mtpErrorWrongTypeId(_type, mtpc_bad_msg_notification);
+	return MTPDbad_msg_notificationView(_from, _end);
+}
+
+inline MTPlong MTPDbad_server_saltView::vbad_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDbad_server_saltView::vbad_msg_seqno() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDbad_server_saltView::verror_code() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDbad_server_saltView::vnew_server_salt() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDbad_server_saltView MTPbadMsgNotificationView::c_bad_server_salt() const {
+	if (_type != mtpc_bad_server_salt) throw mtpErrorWrongTypeId(_type, mtpc_bad_server_salt);
+	return MTPDbad_server_saltView(_from, _end);
+}
+
+inline MTPbadMsgNotification MTPbadMsgNotificationView::read() const {
+	const mtpPrime *from = _from;
+	return MTPbadMsgNotification(from, _end, _type);
+}
+
+inline void MTPbadMsgNotificationView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_bad_msg_notification:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_bad_server_salt:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPbadMsgNotificationView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDmsgs_state_reqView::vmsg_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDmsgs_state_reqView MTPmsgsStateReqView::c_msgs_state_req() const {
+	return MTPDmsgs_state_reqView(_from, _end);
+}
+
+inline MTPmsgsStateReq MTPmsgsStateReqView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmsgsStateReq(from, _end, _type);
+}
+
+inline void MTPmsgsStateReqView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_state_req) throw mtpErrorUnexpected(cons, "MTPmsgsStateReqView");
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+}
+
+inline MTPlong MTPDmsgs_state_infoView::vreq_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDmsgs_state_infoView::vinfo() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDmsgs_state_infoView MTPmsgsStateInfoView::c_msgs_state_info() const {
+	return MTPDmsgs_state_infoView(_from, _end);
+}
+
+inline MTPmsgsStateInfo MTPmsgsStateInfoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmsgsStateInfo(from, _end, _type);
+}
+
+inline void MTPmsgsStateInfoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_state_info) throw mtpErrorUnexpected(cons, "MTPmsgsStateInfoView");
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDmsgs_all_infoView::vmsg_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPstring MTPDmsgs_all_infoView::vinfo() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDmsgs_all_infoView MTPmsgsAllInfoView::c_msgs_all_info() const {
+	return MTPDmsgs_all_infoView(_from, _end);
+}
+
+inline MTPmsgsAllInfo MTPmsgsAllInfoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmsgsAllInfo(from, _end, _type);
+}
+
+inline void MTPmsgsAllInfoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_all_info) throw mtpErrorUnexpected(cons, "MTPmsgsAllInfoView");
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPlong MTPDmsg_detailed_infoView::vmsg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDmsg_detailed_infoView::vanswer_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDmsg_detailed_infoView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmsg_detailed_infoView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmsg_detailed_infoView MTPmsgDetailedInfoView::c_msg_detailed_info() const {
+	if (_type != mtpc_msg_detailed_info) throw mtpErrorWrongTypeId(_type, mtpc_msg_detailed_info);
+	return MTPDmsg_detailed_infoView(_from, _end);
+}
+
+inline MTPlong MTPDmsg_new_detailed_infoView::vanswer_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDmsg_new_detailed_infoView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmsg_new_detailed_infoView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmsg_new_detailed_infoView MTPmsgDetailedInfoView::c_msg_new_detailed_info() const {
+	if (_type != mtpc_msg_new_detailed_info) throw mtpErrorWrongTypeId(_type, mtpc_msg_new_detailed_info);
+	return MTPDmsg_new_detailed_infoView(_from, _end);
+}
+
+inline MTPmsgDetailedInfo MTPmsgDetailedInfoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmsgDetailedInfo(from, _end, _type);
+}
+
+inline void MTPmsgDetailedInfoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_msg_detailed_info:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_msg_new_detailed_info:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmsgDetailedInfoView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDmsg_resend_reqView::vmsg_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDmsg_resend_reqView MTPmsgResendReqView::c_msg_resend_req() const {
+	return MTPDmsg_resend_reqView(_from, _end);
+}
+
+inline MTPmsgResendReq MTPmsgResendReqView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmsgResendReq(from, _end, _type);
+}
+
+inline void MTPmsgResendReqView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msg_resend_req) throw mtpErrorUnexpected(cons, "MTPmsgResendReqView");
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+}
+
+inline MTPint MTPDrpc_errorView::verror_code() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDrpc_errorView::verror_message() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDrpc_errorView MTPrpcErrorView::c_rpc_error() const {
+	return MTPDrpc_errorView(_from, _end);
+}
+
+inline MTPrpcError MTPrpcErrorView::read() const {
+	const mtpPrime *from = _from;
+	return MTPrpcError(from, _end, _type);
+}
+
+inline void MTPrpcErrorView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_rpc_error) throw mtpErrorUnexpected(cons, "MTPrpcErrorView");
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPlong MTPDrpc_answer_droppedView::vmsg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDrpc_answer_droppedView::vseq_no() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDrpc_answer_droppedView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDrpc_answer_droppedView MTPrpcDropAnswerView::c_rpc_answer_dropped() const {
+	if (_type != mtpc_rpc_answer_dropped) throw mtpErrorWrongTypeId(_type, mtpc_rpc_answer_dropped);
+	return MTPDrpc_answer_droppedView(_from, _end);
+}
+
+inline MTPrpcDropAnswer MTPrpcDropAnswerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPrpcDropAnswer(from, _end, _type);
+}
+
+inline void MTPrpcDropAnswerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_rpc_answer_unknown: break;
+		case mtpc_rpc_answer_dropped_running: break;
+		case mtpc_rpc_answer_dropped:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPrpcDropAnswerView");
+	}
+}
+
+inline MTPint MTPDfuture_saltView::vvalid_since() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDfuture_saltView::vvalid_until() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDfuture_saltView::vsalt() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDfuture_saltView MTPfutureSaltView::c_future_salt() const {
+	return MTPDfuture_saltView(_from, _end);
+}
+
+inline MTPfutureSalt MTPfutureSaltView::read() const {
+	const mtpPrime *from = _from;
+	return MTPfutureSalt(from, _end, _type);
+}
+
+inline void MTPfutureSaltView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_future_salt) throw mtpErrorUnexpected(cons, "MTPfutureSaltView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+}
+
+inline MTPlong MTPDfuture_saltsView::vreq_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDfuture_saltsView::vnow() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPvectorView<MTPfutureSaltView > MTPDfuture_saltsView::vsalts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPvectorView<MTPfutureSaltView >(from, end);
+}
+
+inline MTPDfuture_saltsView MTPfutureSaltsView::c_future_salts() const {
+	return MTPDfuture_saltsView(_from, _end);
+}
+
+inline MTPfutureSalts MTPfutureSaltsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPfutureSalts(from, _end, _type);
+}
+
+inline void MTPfutureSaltsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_future_salts) throw mtpErrorUnexpected(cons, "MTPfutureSaltsView");
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPvectorView<MTPfutureSaltView >::skip(from, end);
+}
+
+inline MTPlong MTPDpongView::vmsg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDpongView::vping_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDpongView MTPpongView::c_pong() const {
+	return MTPDpongView(_from, _end);
+}
+
+inline MTPpong MTPpongView::read() const {
+	const mtpPrime *from = _from;
+	return MTPpong(from, _end, _type);
+}
+
+inline void MTPpongView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_pong) throw mtpErrorUnexpected(cons, "MTPpongView");
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+}
+
+inline MTPlong MTPDdestroy_session_okView::vsession_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPDdestroy_session_okView MTPdestroySessionResView::c_destroy_session_ok() const {
+	if (_type != mtpc_destroy_session_ok) throw mtpErrorWrongTypeId(_type, mtpc_destroy_session_ok);
+	return MTPDdestroy_session_okView(_from, _end);
+}
+
+inline MTPlong MTPDdestroy_session_noneView::vsession_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPDdestroy_session_noneView MTPdestroySessionResView::c_destroy_session_none() const {
+	if (_type != mtpc_destroy_session_none) throw mtpErrorWrongTypeId(_type, mtpc_destroy_session_none);
+	return MTPDdestroy_session_noneView(_from, _end);
+}
+
+inline MTPdestroySessionRes MTPdestroySessionResView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdestroySessionRes(from, _end, _type);
+}
+
+inline void MTPdestroySessionResView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_destroy_session_ok:
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_destroy_session_none:
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPdestroySessionResView");
+	}
+}
+
+inline MTPlong MTPDnew_session_createdView::vfirst_msg_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDnew_session_createdView::vunique_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDnew_session_createdView::vserver_salt() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDnew_session_createdView MTPnewSessionView::c_new_session_created() const {
+	return MTPDnew_session_createdView(_from, _end);
+}
+
+inline MTPnewSession MTPnewSessionView::read() const {
+	const mtpPrime *from = _from;
+	return MTPnewSession(from, _end, _type);
+}
+
+inline void MTPnewSessionView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_new_session_created) throw mtpErrorUnexpected(cons, "MTPnewSessionView");
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+}
+
+inline MTPint MTPDhttp_waitView::vmax_delay() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDhttp_waitView::vwait_after() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDhttp_waitView::vmax_wait() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDhttp_waitView MTPhttpWaitView::c_http_wait() const {
+	return MTPDhttp_waitView(_from, _end);
+}
+
+inline MTPhttpWait MTPhttpWaitView::read() const {
+	const mtpPrime *from = _from;
+	return MTPhttpWait(from, _end, _type);
+}
+
+inline void MTPhttpWaitView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_http_wait) throw mtpErrorUnexpected(cons, "MTPhttpWaitView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDinputPeerContactView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDinputPeerContactView MTPinputPeerView::c_inputPeerContact() const {
+	if (_type != mtpc_inputPeerContact) throw mtpErrorWrongTypeId(_type, mtpc_inputPeerContact);
+	return MTPDinputPeerContactView(_from, _end);
+}
+
+inline MTPint MTPDinputPeerForeignView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDinputPeerForeignView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputPeerForeignView MTPinputPeerView::c_inputPeerForeign() const {
+	if (_type != mtpc_inputPeerForeign) throw mtpErrorWrongTypeId(_type, mtpc_inputPeerForeign);
+	return MTPDinputPeerForeignView(_from, _end);
+}
+
+inline MTPint MTPDinputPeerChatView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDinputPeerChatView MTPinputPeerView::c_inputPeerChat() const {
+	if (_type != mtpc_inputPeerChat) throw mtpErrorWrongTypeId(_type, mtpc_inputPeerChat);
+	return MTPDinputPeerChatView(_from, _end);
+}
+
+inline MTPinputPeer MTPinputPeerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputPeer(from, _end, _type);
+}
+
+inline void MTPinputPeerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPeerEmpty: break;
+		case mtpc_inputPeerSelf: break;
+		case mtpc_inputPeerContact:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_inputPeerForeign:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_inputPeerChat:
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputPeerView");
+	}
+}
+
+inline MTPint MTPDinputUserContactView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDinputUserContactView MTPinputUserView::c_inputUserContact() const {
+	if (_type != mtpc_inputUserContact) throw mtpErrorWrongTypeId(_type, mtpc_inputUserContact);
+	return MTPDinputUserContactView(_from, _end);
+}
+
+inline MTPint MTPDinputUserForeignView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDinputUserForeignView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputUserForeignView MTPinputUserView::c_inputUserForeign() const {
+	if (_type != mtpc_inputUserForeign) throw mtpErrorWrongTypeId(_type, mtpc_inputUserForeign);
+	return MTPDinputUserForeignView(_from, _end);
+}
+
+inline MTPinputUser MTPinputUserView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputUser(from, _end, _type);
+}
+
+inline void MTPinputUserView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputUserEmpty: break;
+		case mtpc_inputUserSelf: break;
+		case mtpc_inputUserContact:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_inputUserForeign:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputUserView");
+	}
+}
+
+inline MTPlong MTPDinputPhoneContactView::vclient_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDinputPhoneContactView::vphone() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputPhoneContactView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputPhoneContactView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputPhoneContactView MTPinputContactView::c_inputPhoneContact() const {
+	return MTPDinputPhoneContactView(_from, _end);
+}
+
+inline MTPinputContact MTPinputContactView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputContact(from, _end, _type);
+}
+
+inline void MTPinputContactView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputPhoneContact) throw mtpErrorUnexpected(cons, "MTPinputContactView");
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPlong MTPDinputFileView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDinputFileView::vparts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputFileView::vname() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputFileView::vmd5_checksum() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputFileView MTPinputFileView::c_inputFile() const {
+	if (_type != mtpc_inputFile) throw mtpErrorWrongTypeId(_type, mtpc_inputFile);
+	return MTPDinputFileView(_from, _end);
+}
+
+inline MTPlong MTPDinputFileBigView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDinputFileBigView::vparts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputFileBigView::vname() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputFileBigView MTPinputFileView::c_inputFileBig() const {
+	if (_type != mtpc_inputFileBig) throw mtpErrorWrongTypeId(_type, mtpc_inputFileBig);
+	return MTPDinputFileBigView(_from, _end);
+}
+
+inline MTPinputFile MTPinputFileView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputFile(from, _end, _type);
+}
+
+inline void MTPinputFileView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputFile:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputFileBig:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputFileView");
+	}
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedPhotoView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPDinputMediaUploadedPhotoView MTPinputMediaView::c_inputMediaUploadedPhoto() const {
+	if (_type != mtpc_inputMediaUploadedPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedPhoto);
+	return MTPDinputMediaUploadedPhotoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputPhotoView> MTPDinputMediaPhotoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputPhotoView>(from, end);
+}
+
+inline MTPDinputMediaPhotoView MTPinputMediaView::c_inputMediaPhoto() const {
+	if (_type != mtpc_inputMediaPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaPhoto);
+	return MTPDinputMediaPhotoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputGeoPointView> MTPDinputMediaGeoPointView::vgeo_point() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputGeoPointView>(from, end);
+}
+
+inline MTPDinputMediaGeoPointView MTPinputMediaView::c_inputMediaGeoPoint() const {
+	if (_type != mtpc_inputMediaGeoPoint) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaGeoPoint);
+	return MTPDinputMediaGeoPointView(_from, _end);
+}
+
+inline MTPstring MTPDinputMediaContactView::vphone_number() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputMediaContactView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputMediaContactView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputMediaContactView MTPinputMediaView::c_inputMediaContact() const {
+	if (_type != mtpc_inputMediaContact) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaContact);
+	return MTPDinputMediaContactView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedVideoView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedVideoView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedVideoView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedVideoView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedVideoView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputMediaUploadedVideoView MTPinputMediaView::c_inputMediaUploadedVideo() const {
+	if (_type != mtpc_inputMediaUploadedVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedVideo);
+	return MTPDinputMediaUploadedVideoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedThumbVideoView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedThumbVideoView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedThumbVideoView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedThumbVideoView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedThumbVideoView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedThumbVideoView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputMediaUploadedThumbVideoView MTPinputMediaView::c_inputMediaUploadedThumbVideo() const {
+	if (_type != mtpc_inputMediaUploadedThumbVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedThumbVideo);
+	return MTPDinputMediaUploadedThumbVideoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputVideoView> MTPDinputMediaVideoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputVideoView>(from, end);
+}
+
+inline MTPDinputMediaVideoView MTPinputMediaView::c_inputMediaVideo() const {
+	if (_type != mtpc_inputMediaVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaVideo);
+	return MTPDinputMediaVideoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedAudioView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPint MTPDinputMediaUploadedAudioView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedAudioView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputMediaUploadedAudioView MTPinputMediaView::c_inputMediaUploadedAudio() const {
+	if (_type != mtpc_inputMediaUploadedAudio) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedAudio);
+	return MTPDinputMediaUploadedAudioView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputAudioView> MTPDinputMediaAudioView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputAudioView>(from, end);
+}
+
+inline MTPDinputMediaAudioView MTPinputMediaView::c_inputMediaAudio() const {
+	if (_type != mtpc_inputMediaAudio) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaAudio);
+	return MTPDinputMediaAudioView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedDocumentView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedDocumentView::vfile_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedDocumentView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputMediaUploadedDocumentView MTPinputMediaView::c_inputMediaUploadedDocument() const {
+	if (_type != mtpc_inputMediaUploadedDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedDocument);
+	return MTPDinputMediaUploadedDocumentView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedThumbDocumentView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputMediaUploadedThumbDocumentView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedThumbDocumentView::vfile_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDinputMediaUploadedThumbDocumentView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputMediaUploadedThumbDocumentView MTPinputMediaView::c_inputMediaUploadedThumbDocument() const {
+	if (_type != mtpc_inputMediaUploadedThumbDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedThumbDocument);
+	return MTPDinputMediaUploadedThumbDocumentView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputDocumentView> MTPDinputMediaDocumentView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputDocumentView>(from, end);
+}
+
+inline MTPDinputMediaDocumentView MTPinputMediaView::c_inputMediaDocument() const {
+	if (_type != mtpc_inputMediaDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaDocument);
+	return MTPDinputMediaDocumentView(_from, _end);
+}
+
+inline MTPinputMedia MTPinputMediaView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputMedia(from, _end, _type);
+}
+
+inline void MTPinputMediaView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputMediaEmpty: break;
+		case mtpc_inputMediaUploadedPhoto:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+		break;
+		case mtpc_inputMediaPhoto:
+			MTPBoxedView<MTPinputPhotoView>::skip(from, end);
+		break;
+		case mtpc_inputMediaGeoPoint:
+			MTPBoxedView<MTPinputGeoPointView>::skip(from, end);
+		break;
+		case mtpc_inputMediaContact:
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputMediaUploadedVideo:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputMediaUploadedThumbVideo:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputMediaVideo:
+			MTPBoxedView<MTPinputVideoView>::skip(from, end);
+		break;
+		case mtpc_inputMediaUploadedAudio:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputMediaAudio:
+			MTPBoxedView<MTPinputAudioView>::skip(from, end);
+		break;
+		case mtpc_inputMediaUploadedDocument:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputMediaUploadedThumbDocument:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_inputMediaDocument:
+			MTPBoxedView<MTPinputDocumentView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputMediaView");
+	}
+}
+
+inline MTPBoxedView<MTPinputFileView> MTPDinputChatUploadedPhotoView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputFileView>(from, end);
+}
+
+inline MTPBoxedView<MTPinputPhotoCropView> MTPDinputChatUploadedPhotoView::vcrop() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputFileView>::skip(from, end);
+	return MTPBoxedView<MTPinputPhotoCropView>(from, end);
+}
+
+inline MTPDinputChatUploadedPhotoView MTPinputChatPhotoView::c_inputChatUploadedPhoto() const {
+	if (_type != mtpc_inputChatUploadedPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputChatUploadedPhoto);
+	return MTPDinputChatUploadedPhotoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputPhotoView> MTPDinputChatPhotoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputPhotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPinputPhotoCropView> MTPDinputChatPhotoView::vcrop() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPinputPhotoView>::skip(from, end);
+	return MTPBoxedView<MTPinputPhotoCropView>(from, end);
+}
+
+inline MTPDinputChatPhotoView MTPinputChatPhotoView::c_inputChatPhoto() const {
+	if (_type != mtpc_inputChatPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputChatPhoto);
+	return MTPDinputChatPhotoView(_from, _end);
+}
+
+inline MTPinputChatPhoto MTPinputChatPhotoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputChatPhoto(from, _end, _type);
+}
+
+inline void MTPinputChatPhotoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputChatPhotoEmpty: break;
+		case mtpc_inputChatUploadedPhoto:
+			MTPBoxedView<MTPinputFileView>::skip(from, end);
+			MTPBoxedView<MTPinputPhotoCropView>::skip(from, end);
+		break;
+		case mtpc_inputChatPhoto:
+			MTPBoxedView<MTPinputPhotoView>::skip(from, end);
+			MTPBoxedView<MTPinputPhotoCropView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputChatPhotoView");
+	}
+}
+
+inline MTPdouble MTPDinputGeoPointView::vlat() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPdouble(from, end);
+}
+
+inline MTPdouble MTPDinputGeoPointView::vlong() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	return MTPdouble(from, end);
+}
+
+inline MTPDinputGeoPointView MTPinputGeoPointView::c_inputGeoPoint() const {
+	if (_type != mtpc_inputGeoPoint) throw mtpErrorWrongTypeId(_type, mtpc_inputGeoPoint);
+	return MTPDinputGeoPointView(_from, _end);
+}
+
+inline MTPinputGeoPoint MTPinputGeoPointView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputGeoPoint(from, _end, _type);
+}
+
+inline void MTPinputGeoPointView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputGeoPointEmpty: break;
+		case mtpc_inputGeoPoint:
+			MTPdouble::skip(from, end);
+			MTPdouble::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputGeoPointView");
+	}
+}
+
+inline MTPlong MTPDinputPhotoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputPhotoView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputPhotoView MTPinputPhotoView::c_inputPhoto() const {
+	if (_type != mtpc_inputPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputPhoto);
+	return MTPDinputPhotoView(_from, _end);
+}
+
+inline MTPinputPhoto MTPinputPhotoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputPhoto(from, _end, _type);
+}
+
+inline void MTPinputPhotoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPhotoEmpty: break;
+		case mtpc_inputPhoto:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputPhotoView");
+	}
+}
+
+inline MTPlong MTPDinputVideoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputVideoView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputVideoView MTPinputVideoView::c_inputVideo() const {
+	if (_type != mtpc_inputVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputVideo);
+	return MTPDinputVideoView(_from, _end);
+}
+
+inline MTPinputVideo MTPinputVideoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputVideo(from, _end, _type);
+}
+
+inline void MTPinputVideoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputVideoEmpty: break;
+		case mtpc_inputVideo:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputVideoView");
+	}
+}
+
+inline MTPlong MTPDinputFileLocationView::vvolume_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDinputFileLocationView::vlocal_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDinputFileLocationView::vsecret() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputFileLocationView MTPinputFileLocationView::c_inputFileLocation() const {
+	if (_type != mtpc_inputFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputFileLocation);
+	return MTPDinputFileLocationView(_from, _end);
+}
+
+inline MTPlong MTPDinputVideoFileLocationView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputVideoFileLocationView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputVideoFileLocationView MTPinputFileLocationView::c_inputVideoFileLocation() const {
+	if (_type != mtpc_inputVideoFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputVideoFileLocation);
+	return MTPDinputVideoFileLocationView(_from, _end);
+}
+
+inline MTPlong MTPDinputEncryptedFileLocationView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputEncryptedFileLocationView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputEncryptedFileLocationView MTPinputFileLocationView::c_inputEncryptedFileLocation() const {
+	if (_type != mtpc_inputEncryptedFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFileLocation);
+	return MTPDinputEncryptedFileLocationView(_from, _end);
+}
+
+inline MTPlong MTPDinputAudioFileLocationView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputAudioFileLocationView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputAudioFileLocationView MTPinputFileLocationView::c_inputAudioFileLocation() const {
+	if (_type != mtpc_inputAudioFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputAudioFileLocation);
+	return MTPDinputAudioFileLocationView(_from, _end);
+}
+
+inline MTPlong MTPDinputDocumentFileLocationView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputDocumentFileLocationView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputDocumentFileLocationView MTPinputFileLocationView::c_inputDocumentFileLocation() const {
+	if (_type != mtpc_inputDocumentFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputDocumentFileLocation);
+	return MTPDinputDocumentFileLocationView(_from, _end);
+}
+
+inline MTPinputFileLocation MTPinputFileLocationView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputFileLocation(from, _end, _type);
+}
+
+inline void MTPinputFileLocationView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputFileLocation:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_inputVideoFileLocation:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_inputEncryptedFileLocation:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_inputAudioFileLocation:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_inputDocumentFileLocation:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputFileLocationView");
+	}
+}
+
+inline MTPdouble MTPDinputPhotoCropView::vcrop_left() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPdouble(from, end);
+}
+
+inline MTPdouble MTPDinputPhotoCropView::vcrop_top() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	return MTPdouble(from, end);
+}
+
+inline MTPdouble MTPDinputPhotoCropView::vcrop_width() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	MTPdouble::skip(from, end);
+	return MTPdouble(from, end);
+}
+
+inline MTPDinputPhotoCropView MTPinputPhotoCropView::c_inputPhotoCrop() const {
+	if (_type != mtpc_inputPhotoCrop) throw mtpErrorWrongTypeId(_type, mtpc_inputPhotoCrop);
+	return MTPDinputPhotoCropView(_from, _end);
+}
+
+inline MTPinputPhotoCrop MTPinputPhotoCropView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputPhotoCrop(from, _end, _type);
+}
+
+inline void MTPinputPhotoCropView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPhotoCropAuto: break;
+		case mtpc_inputPhotoCrop:
+			MTPdouble::skip(from, end);
+			MTPdouble::skip(from, end);
+			MTPdouble::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputPhotoCropView");
+	}
+}
+
+inline MTPdouble MTPDinputAppEventView::vtime() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPdouble(from, end);
+}
+
+inline MTPstring MTPDinputAppEventView::vtype() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPlong MTPDinputAppEventView::vpeer() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDinputAppEventView::vdata() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDinputAppEventView MTPinputAppEventView::c_inputAppEvent() const {
+	return MTPDinputAppEventView(_from, _end);
+}
+
+inline MTPinputAppEvent MTPinputAppEventView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputAppEvent(from, _end, _type);
+}
+
+inline void MTPinputAppEventView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputAppEvent) throw mtpErrorUnexpected(cons, "MTPinputAppEventView");
+	MTPdouble::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPint MTPDpeerUserView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDpeerUserView MTPpeerView::c_peerUser() const {
+	if (_type != mtpc_peerUser) throw mtpErrorWrongTypeId(_type, mtpc_peerUser);
+	return MTPDpeerUserView(_from, _end);
+}
+
+inline MTPint MTPDpeerChatView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDpeerChatView MTPpeerView::c_peerChat() const {
+	if (_type != mtpc_peerChat) throw mtpErrorWrongTypeId(_type, mtpc_peerChat);
+	return MTPDpeerChatView(_from, _end);
+}
+
+inline MTPpeer MTPpeerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPpeer(from, _end, _type);
+}
+
+inline void MTPpeerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_peerUser:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_peerChat:
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPpeerView");
+	}
+}
+
+inline MTPstorage_fileType MTPstorage_fileTypeView::read() const {
+	const mtpPrime *from = _from;
+	return MTPstorage_fileType(from, _end, _type);
+}
+
+inline void MTPstorage_fileTypeView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_storage_fileUnknown: break;
+		case mtpc_storage_fileJpeg: break;
+		case mtpc_storage_fileGif: break;
+		case mtpc_storage_filePng: break;
+		case mtpc_storage_filePdf: break;
+		case mtpc_storage_fileMp3: break;
+		case mtpc_storage_fileMov: break;
+		case mtpc_storage_filePartial: break;
+		case mtpc_storage_fileMp4: break;
+		case mtpc_storage_fileWebp: break;
+		default: throw mtpErrorUnexpected(cons, "MTPstorage_fileTypeView");
+	}
+}
+
+inline MTPlong MTPDfileLocationUnavailableView::vvolume_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDfileLocationUnavailableView::vlocal_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDfileLocationUnavailableView::vsecret() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDfileLocationUnavailableView MTPfileLocationView::c_fileLocationUnavailable() const {
+	if (_type != mtpc_fileLocationUnavailable) throw mtpErrorWrongTypeId(_type, mtpc_fileLocationUnavailable);
+	return MTPDfileLocationUnavailableView(_from, _end);
+}
+
+inline MTPint MTPDfileLocationView::vdc_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDfileLocationView::vvolume_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDfileLocationView::vlocal_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDfileLocationView::vsecret() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDfileLocationView MTPfileLocationView::c_fileLocation() const {
+	if (_type != mtpc_fileLocation) throw mtpErrorWrongTypeId(_type, mtpc_fileLocation);
+	return MTPDfileLocationView(_from, _end);
+}
+
+inline MTPfileLocation MTPfileLocationView::read() const {
+	const mtpPrime *from = _from;
+	return MTPfileLocation(from, _end, _type);
+}
+
+inline void MTPfileLocationView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_fileLocationUnavailable:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_fileLocation:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPfileLocationView");
+	}
+}
+
+inline MTPint MTPDuserEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDuserEmptyView MTPuserView::c_userEmpty() const {
+	if (_type != mtpc_userEmpty) throw mtpErrorWrongTypeId(_type, mtpc_userEmpty);
+	return MTPDuserEmptyView(_from, _end);
+}
+
+inline MTPint MTPDuserSelfView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDuserSelfView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserSelfView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserSelfView::vphone() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPuserProfilePhotoView> MTPDuserSelfView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPuserProfilePhotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPuserStatusView> MTPDuserSelfView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+	return MTPBoxedView<MTPuserStatusView>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDuserSelfView::vinactive() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+	MTPBoxedView<MTPuserStatusView>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDuserSelfView MTPuserView::c_userSelf() const {
+	if (_type != mtpc_userSelf) throw mtpErrorWrongTypeId(_type, mtpc_userSelf);
+	return MTPDuserSelfView(_from, _end);
+}
+
+inline MTPint MTPDuserContactView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDuserContactView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserContactView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPlong MTPDuserContactView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDuserContactView::vphone() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPuserProfilePhotoView> MTPDuserContactView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPuserProfilePhotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPuserStatusView> MTPDuserContactView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+	return MTPBoxedView<MTPuserStatusView>(from, end);
+}
+
+inline MTPDuserContactView MTPuserView::c_userContact() const {
+	if (_type != mtpc_userContact) throw mtpErrorWrongTypeId(_type, mtpc_userContact);
+	return MTPDuserContactView(_from, _end);
+}
+
+inline MTPint MTPDuserRequestView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDuserRequestView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserRequestView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPlong MTPDuserRequestView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDuserRequestView::vphone() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPuserProfilePhotoView> MTPDuserRequestView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPuserProfilePhotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPuserStatusView> MTPDuserRequestView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+	return MTPBoxedView<MTPuserStatusView>(from, end);
+}
+
+inline MTPDuserRequestView MTPuserView::c_userRequest() const {
+	if (_type != mtpc_userRequest) throw mtpErrorWrongTypeId(_type, mtpc_userRequest);
+	return MTPDuserRequestView(_from, _end);
+}
+
+inline MTPint MTPDuserForeignView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDuserForeignView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserForeignView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPlong MTPDuserForeignView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPBoxedView<MTPuserProfilePhotoView> MTPDuserForeignView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPBoxedView<MTPuserProfilePhotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPuserStatusView> MTPDuserForeignView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+	return MTPBoxedView<MTPuserStatusView>(from, end);
+}
+
+inline MTPDuserForeignView MTPuserView::c_userForeign() const {
+	if (_type != mtpc_userForeign) throw mtpErrorWrongTypeId(_type, mtpc_userForeign);
+	return MTPDuserForeignView(_from, _end);
+}
+
+inline MTPint MTPDuserDeletedView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDuserDeletedView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserDeletedView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDuserDeletedView MTPuserView::c_userDeleted() const {
+	if (_type != mtpc_userDeleted) throw mtpErrorWrongTypeId(_type, mtpc_userDeleted);
+	return MTPDuserDeletedView(_from, _end);
+}
+
+inline MTPuser MTPuserView::read() const {
+	const mtpPrime *from = _from;
+	return MTPuser(from, _end, _type);
+}
+
+inline void MTPuserView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_userEmpty:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_userSelf:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+			MTPBoxedView<MTPuserStatusView>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+		break;
+		case mtpc_userContact:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+			MTPBoxedView<MTPuserStatusView>::skip(from, end);
+		break;
+		case mtpc_userRequest:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+			MTPBoxedView<MTPuserStatusView>::skip(from, end);
+		break;
+		case mtpc_userForeign:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+			MTPBoxedView<MTPuserStatusView>::skip(from, end);
+		break;
+		case mtpc_userDeleted:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPuserView");
+	}
+}
+
+inline MTPlong MTPDuserProfilePhotoView::vphoto_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPBoxedView<MTPfileLocationView> MTPDuserProfilePhotoView::vphoto_small() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPBoxedView<MTPfileLocationView>(from, end);
+}
+
+inline MTPBoxedView<MTPfileLocationView> MTPDuserProfilePhotoView::vphoto_big() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	return MTPBoxedView<MTPfileLocationView>(from, end);
+}
+
+inline MTPDuserProfilePhotoView MTPuserProfilePhotoView::c_userProfilePhoto() const {
+	if (_type != mtpc_userProfilePhoto) throw mtpErrorWrongTypeId(_type, mtpc_userProfilePhoto);
+	return MTPDuserProfilePhotoView(_from, _end);
+}
+
+inline MTPuserProfilePhoto MTPuserProfilePhotoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPuserProfilePhoto(from, _end, _type);
+}
+
+inline void MTPuserProfilePhotoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_userProfilePhotoEmpty: break;
+		case mtpc_userProfilePhoto:
+			MTPlong::skip(from, end);
+			MTPBoxedView<MTPfileLocationView>::skip(from, end);
+			MTPBoxedView<MTPfileLocationView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPuserProfilePhotoView");
+	}
+}
+
+inline MTPint MTPDuserStatusOnlineView::vexpires() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDuserStatusOnlineView MTPuserStatusView::c_userStatusOnline() const {
+	if (_type != mtpc_userStatusOnline) throw mtpErrorWrongTypeId(_type, mtpc_userStatusOnline);
+	return MTPDuserStatusOnlineView(_from, _end);
+}
+
+inline MTPint MTPDuserStatusOfflineView::vwas_online() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDuserStatusOfflineView MTPuserStatusView::c_userStatusOffline() const {
+	if (_type != mtpc_userStatusOffline) throw mtpErrorWrongTypeId(_type, mtpc_userStatusOffline);
+	return MTPDuserStatusOfflineView(_from, _end);
+}
+
+inline MTPuserStatus MTPuserStatusView::read() const {
+	const mtpPrime *from = _from;
+	return MTPuserStatus(from, _end, _type);
+}
+
+inline void MTPuserStatusView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_userStatusEmpty: break;
+		case mtpc_userStatusOnline:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_userStatusOffline:
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPuserStatusView");
+	}
+}
+
+inline MTPint MTPDchatEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDchatEmptyView MTPchatView::c_chatEmpty() const {
+	if (_type != mtpc_chatEmpty) throw mtpErrorWrongTypeId(_type, mtpc_chatEmpty);
+	return MTPDchatEmptyView(_from, _end);
+}
+
+inline MTPint MTPDchatView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDchatView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPchatPhotoView> MTPDchatView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPchatPhotoView>(from, end);
+}
+
+inline MTPint MTPDchatView::vparticipants_count() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDchatView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDchatView::vleft() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDchatView::vversion() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDchatView MTPchatView::c_chat() const {
+	if (_type != mtpc_chat) throw mtpErrorWrongTypeId(_type, mtpc_chat);
+	return MTPDchatView(_from, _end);
+}
+
+inline MTPint MTPDchatForbiddenView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDchatForbiddenView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDchatForbiddenView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDchatForbiddenView MTPchatView::c_chatForbidden() const {
+	if (_type != mtpc_chatForbidden) throw mtpErrorWrongTypeId(_type, mtpc_chatForbidden);
+	return MTPDchatForbiddenView(_from, _end);
+}
+
+inline MTPint MTPDgeoChatView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDgeoChatView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPstring MTPDgeoChatView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDgeoChatView::vaddress() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDgeoChatView::vvenue() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPgeoPointView> MTPDgeoChatView::vgeo() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPgeoPointView>(from, end);
+}
+
+inline MTPBoxedView<MTPchatPhotoView> MTPDgeoChatView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPgeoPointView>::skip(from, end);
+	return MTPBoxedView<MTPchatPhotoView>(from, end);
+}
+
+inline MTPint MTPDgeoChatView::vparticipants_count() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPgeoPointView>::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPgeoPointView>::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDgeoChatView::vchecked_in() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPgeoPointView>::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDgeoChatView::vversion() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPgeoPointView>::skip(from, end);
+	MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDgeoChatView MTPchatView::c_geoChat() const {
+	if (_type != mtpc_geoChat) throw mtpErrorWrongTypeId(_type, mtpc_geoChat);
+	return MTPDgeoChatView(_from, _end);
+}
+
+inline MTPchat MTPchatView::read() const {
+	const mtpPrime *from = _from;
+	return MTPchat(from, _end, _type);
+}
+
+inline void MTPchatView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatEmpty:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_chat:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_chatForbidden:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_geoChat:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPgeoPointView>::skip(from, end);
+			MTPBoxedView<MTPchatPhotoView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPchatView");
+	}
+}
+
+inline MTPint MTPDchatFullView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPchatParticipantsView> MTPDchatFullView::vparticipants() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPchatParticipantsView>(from, end);
+}
+
+inline MTPBoxedView<MTPphotoView> MTPDchatFullView::vchat_photo() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPchatParticipantsView>::skip(from, end);
+	return MTPBoxedView<MTPphotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPpeerNotifySettingsView> MTPDchatFullView::vnotify_settings() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPchatParticipantsView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	return MTPBoxedView<MTPpeerNotifySettingsView>(from, end);
+}
+
+inline MTPDchatFullView MTPchatFullView::c_chatFull() const {
+	return MTPDchatFullView(_from, _end);
+}
+
+inline MTPchatFull MTPchatFullView::read() const {
+	const mtpPrime *from = _from;
+	return MTPchatFull(from, _end, _type);
+}
+
+inline void MTPchatFullView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_chatFull) throw mtpErrorUnexpected(cons, "MTPchatFullView");
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPchatParticipantsView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+}
+
+inline MTPint MTPDchatParticipantView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDchatParticipantView::vinviter_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDchatParticipantView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDchatParticipantView MTPchatParticipantView::c_chatParticipant() const {
+	return MTPDchatParticipantView(_from, _end);
+}
+
+inline MTPchatParticipant MTPchatParticipantView::read() const {
+	const mtpPrime *from = _from;
+	return MTPchatParticipant(from, _end, _type);
+}
+
+inline void MTPchatParticipantView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_chatParticipant) throw mtpErrorUnexpected(cons, "MTPchatParticipantView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDchatParticipantsForbiddenView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDchatParticipantsForbiddenView MTPchatParticipantsView::c_chatParticipantsForbidden() const {
+	if (_type != mtpc_chatParticipantsForbidden) throw mtpErrorWrongTypeId(_type, mtpc_chatParticipantsForbidden);
+	return MTPDchatParticipantsForbiddenView(_from, _end);
+}
+
+inline MTPint MTPDchatParticipantsView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDchatParticipantsView::vadmin_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatParticipantView> > > MTPDchatParticipantsView::vparticipants() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatParticipantView> > >(from, end);
+}
+
+inline MTPint MTPDchatParticipantsView::vversion() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatParticipantView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDchatParticipantsView MTPchatParticipantsView::c_chatParticipants() const {
+	if (_type != mtpc_chatParticipants) throw mtpErrorWrongTypeId(_type, mtpc_chatParticipants);
+	return MTPDchatParticipantsView(_from, _end);
+}
+
+inline MTPchatParticipants MTPchatParticipantsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPchatParticipants(from, _end, _type);
+}
+
+inline void MTPchatParticipantsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatParticipantsForbidden:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_chatParticipants:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatParticipantView> > >::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPchatParticipantsView");
+	}
+}
+
+inline MTPBoxedView<MTPfileLocationView> MTPDchatPhotoView::vphoto_small() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPfileLocationView>(from, end);
+}
+
+inline MTPBoxedView<MTPfileLocationView> MTPDchatPhotoView::vphoto_big() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	return MTPBoxedView<MTPfileLocationView>(from, end);
+}
+
+inline MTPDchatPhotoView MTPchatPhotoView::c_chatPhoto() const {
+	if (_type != mtpc_chatPhoto) throw mtpErrorWrongTypeId(_type, mtpc_chatPhoto);
+	return MTPDchatPhotoView(_from, _end);
+}
+
+inline MTPchatPhoto MTPchatPhotoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPchatPhoto(from, _end, _type);
+}
+
+inline void MTPchatPhotoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatPhotoEmpty: break;
+		case mtpc_chatPhoto:
+			MTPBoxedView<MTPfileLocationView>::skip(from, end);
+			MTPBoxedView<MTPfileLocationView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPchatPhotoView");
+	}
+}
+
+inline MTPint MTPDmessageEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDmessageEmptyView MTPmessageView::c_messageEmpty() const {
+	if (_type != mtpc_messageEmpty) throw mtpErrorWrongTypeId(_type, mtpc_messageEmpty);
+	return MTPDmessageEmptyView(_from, _end);
+}
+
+inline MTPint MTPDmessageView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessageView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPpeerView> MTPDmessageView::vto_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPpeerView>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDmessageView::vout() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDmessageView::vunread() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDmessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDmessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPmessageMediaView> MTPDmessageView::vmedia() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPmessageMediaView>(from, end);
+}
+
+inline MTPDmessageView MTPmessageView::c_message() const {
+	if (_type != mtpc_message) throw mtpErrorWrongTypeId(_type, mtpc_message);
+	return MTPDmessageView(_from, _end);
+}
+
+inline MTPint MTPDmessageForwardedView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessageForwardedView::vfwd_from_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessageForwardedView::vfwd_date() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessageForwardedView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPpeerView> MTPDmessageForwardedView::vto_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPpeerView>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDmessageForwardedView::vout() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDmessageForwardedView::vunread() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDmessageForwardedView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDmessageForwardedView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPmessageMediaView> MTPDmessageForwardedView::vmedia() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPmessageMediaView>(from, end);
+}
+
+inline MTPDmessageForwardedView MTPmessageView::c_messageForwarded() const {
+	if (_type != mtpc_messageForwarded) throw mtpErrorWrongTypeId(_type, mtpc_messageForwarded);
+	return MTPDmessageForwardedView(_from, _end);
+}
+
+inline MTPint MTPDmessageServiceView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessageServiceView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPpeerView> MTPDmessageServiceView::vto_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPpeerView>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDmessageServiceView::vout() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDmessageServiceView::vunread() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDmessageServiceView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPmessageActionView> MTPDmessageServiceView::vaction() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPmessageActionView>(from, end);
+}
+
+inline MTPDmessageServiceView MTPmessageView::c_messageService() const {
+	if (_type != mtpc_messageService) throw mtpErrorWrongTypeId(_type, mtpc_messageService);
+	return MTPDmessageServiceView(_from, _end);
+}
+
+inline MTPmessage MTPmessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessage(from, _end, _type);
+}
+
+inline void MTPmessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messageEmpty:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_message:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPpeerView>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPmessageMediaView>::skip(from, end);
+		break;
+		case mtpc_messageForwarded:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPpeerView>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPmessageMediaView>::skip(from, end);
+		break;
+		case mtpc_messageService:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPpeerView>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPmessageActionView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessageView");
+	}
+}
+
+inline MTPBoxedView<MTPphotoView> MTPDmessageMediaPhotoView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPphotoView>(from, end);
+}
+
+inline MTPDmessageMediaPhotoView MTPmessageMediaView::c_messageMediaPhoto() const {
+	if (_type != mtpc_messageMediaPhoto) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaPhoto);
+	return MTPDmessageMediaPhotoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvideoView> MTPDmessageMediaVideoView::vvideo() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvideoView>(from, end);
+}
+
+inline MTPDmessageMediaVideoView MTPmessageMediaView::c_messageMediaVideo() const {
+	if (_type != mtpc_messageMediaVideo) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaVideo);
+	return MTPDmessageMediaVideoView(_from, _end);
+}
+
+inline MTPBoxedView<MTPgeoPointView> MTPDmessageMediaGeoView::vgeo() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPgeoPointView>(from, end);
+}
+
+inline MTPDmessageMediaGeoView MTPmessageMediaView::c_messageMediaGeo() const {
+	if (_type != mtpc_messageMediaGeo) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaGeo);
+	return MTPDmessageMediaGeoView(_from, _end);
+}
+
+inline MTPstring MTPDmessageMediaContactView::vphone_number() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDmessageMediaContactView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDmessageMediaContactView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDmessageMediaContactView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessageMediaContactView MTPmessageMediaView::c_messageMediaContact() const {
+	if (_type != mtpc_messageMediaContact) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaContact);
+	return MTPDmessageMediaContactView(_from, _end);
+}
+
+inline MTPbytes MTPDmessageMediaUnsupportedView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPbytes(from, end);
+}
+
+inline MTPDmessageMediaUnsupportedView MTPmessageMediaView::c_messageMediaUnsupported() const {
+	if (_type != mtpc_messageMediaUnsupported) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaUnsupported);
+	return MTPDmessageMediaUnsupportedView(_from, _end);
+}
+
+inline MTPBoxedView<MTPdocumentView> MTPDmessageMediaDocumentView::vdocument() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPdocumentView>(from, end);
+}
+
+inline MTPDmessageMediaDocumentView MTPmessageMediaView::c_messageMediaDocument() const {
+	if (_type != mtpc_messageMediaDocument) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaDocument);
+	return MTPDmessageMediaDocumentView(_from, _end);
+}
+
+inline MTPBoxedView<MTPaudioView> MTPDmessageMediaAudioView::vaudio() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPaudioView>(from, end);
+}
+
+inline MTPDmessageMediaAudioView MTPmessageMediaView::c_messageMediaAudio() const {
+	if (_type != mtpc_messageMediaAudio) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaAudio);
+	return MTPDmessageMediaAudioView(_from, _end);
+}
+
+inline MTPmessageMedia MTPmessageMediaView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessageMedia(from, _end, _type);
+}
+
+inline void MTPmessageMediaView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messageMediaEmpty: break;
+		case mtpc_messageMediaPhoto:
+			MTPBoxedView<MTPphotoView>::skip(from, end);
+		break;
+		case mtpc_messageMediaVideo:
+			MTPBoxedView<MTPvideoView>::skip(from, end);
+		break;
+		case mtpc_messageMediaGeo:
+			MTPBoxedView<MTPgeoPointView>::skip(from, end);
+		break;
+		case mtpc_messageMediaContact:
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messageMediaUnsupported:
+			MTPbytes::skip(from, end);
+		break;
+		case mtpc_messageMediaDocument:
+			MTPBoxedView<MTPdocumentView>::skip(from, end);
+		break;
+		case mtpc_messageMediaAudio:
+			MTPBoxedView<MTPaudioView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessageMediaView");
+	}
+}
+
+inline MTPstring MTPDmessageActionChatCreateView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPint > > MTPDmessageActionChatCreateView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPint > >(from, end);
+}
+
+inline MTPDmessageActionChatCreateView MTPmessageActionView::c_messageActionChatCreate() const {
+	if (_type != mtpc_messageActionChatCreate) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatCreate);
+	return MTPDmessageActionChatCreateView(_from, _end);
+}
+
+inline MTPstring MTPDmessageActionChatEditTitleView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPDmessageActionChatEditTitleView MTPmessageActionView::c_messageActionChatEditTitle() const {
+	if (_type != mtpc_messageActionChatEditTitle) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatEditTitle);
+	return MTPDmessageActionChatEditTitleView(_from, _end);
+}
+
+inline MTPBoxedView<MTPphotoView> MTPDmessageActionChatEditPhotoView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPphotoView>(from, end);
+}
+
+inline MTPDmessageActionChatEditPhotoView MTPmessageActionView::c_messageActionChatEditPhoto() const {
+	if (_type != mtpc_messageActionChatEditPhoto) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatEditPhoto);
+	return MTPDmessageActionChatEditPhotoView(_from, _end);
+}
+
+inline MTPint MTPDmessageActionChatAddUserView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDmessageActionChatAddUserView MTPmessageActionView::c_messageActionChatAddUser() const {
+	if (_type != mtpc_messageActionChatAddUser) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatAddUser);
+	return MTPDmessageActionChatAddUserView(_from, _end);
+}
+
+inline MTPint MTPDmessageActionChatDeleteUserView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDmessageActionChatDeleteUserView MTPmessageActionView::c_messageActionChatDeleteUser() const {
+	if (_type != mtpc_messageActionChatDeleteUser) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatDeleteUser);
+	return MTPDmessageActionChatDeleteUserView(_from, _end);
+}
+
+inline MTPstring MTPDmessageActionGeoChatCreateView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDmessageActionGeoChatCreateView::vaddress() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDmessageActionGeoChatCreateView MTPmessageActionView::c_messageActionGeoChatCreate() const {
+	if (_type != mtpc_messageActionGeoChatCreate) throw mtpErrorWrongTypeId(_type, mtpc_messageActionGeoChatCreate);
+	return MTPDmessageActionGeoChatCreateView(_from, _end);
+}
+
+inline MTPmessageAction MTPmessageActionView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessageAction(from, _end, _type);
+}
+
+inline void MTPmessageActionView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messageActionEmpty: break;
+		case mtpc_messageActionChatCreate:
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+		break;
+		case mtpc_messageActionChatEditTitle:
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_messageActionChatEditPhoto:
+			MTPBoxedView<MTPphotoView>::skip(from, end);
+		break;
+		case mtpc_messageActionChatDeletePhoto: break;
+		case mtpc_messageActionChatAddUser:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messageActionChatDeleteUser:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messageActionGeoChatCreate:
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_messageActionGeoChatCheckin: break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessageActionView");
+	}
+}
+
+inline MTPBoxedView<MTPpeerView> MTPDdialogView::vpeer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPpeerView>(from, end);
+}
+
+inline MTPint MTPDdialogView::vtop_message() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdialogView::vunread_count() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPpeerNotifySettingsView> MTPDdialogView::vnotify_settings() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPpeerNotifySettingsView>(from, end);
+}
+
+inline MTPDdialogView MTPdialogView::c_dialog() const {
+	return MTPDdialogView(_from, _end);
+}
+
+inline MTPdialog MTPdialogView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdialog(from, _end, _type);
+}
+
+inline void MTPdialogView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_dialog) throw mtpErrorUnexpected(cons, "MTPdialogView");
+	MTPBoxedView<MTPpeerView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+}
+
+inline MTPlong MTPDphotoEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPDphotoEmptyView MTPphotoView::c_photoEmpty() const {
+	if (_type != mtpc_photoEmpty) throw mtpErrorWrongTypeId(_type, mtpc_photoEmpty);
+	return MTPDphotoEmptyView(_from, _end);
+}
+
+inline MTPlong MTPDphotoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDphotoView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDphotoView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDphotoView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDphotoView::vcaption() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPgeoPointView> MTPDphotoView::vgeo() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPgeoPointView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > > MTPDphotoView::vsizes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPgeoPointView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > >(from, end);
+}
+
+inline MTPDphotoView MTPphotoView::c_photo() const {
+	if (_type != mtpc_photo) throw mtpErrorWrongTypeId(_type, mtpc_photo);
+	return MTPDphotoView(_from, _end);
+}
+
+inline MTPphoto MTPphotoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPphoto(from, _end, _type);
+}
+
+inline void MTPphotoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_photoEmpty:
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_photo:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPgeoPointView>::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPphotoView");
+	}
+}
+
+inline MTPstring MTPDphotoSizeEmptyView::vtype() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPDphotoSizeEmptyView MTPphotoSizeView::c_photoSizeEmpty() const {
+	if (_type != mtpc_photoSizeEmpty) throw mtpErrorWrongTypeId(_type, mtpc_photoSizeEmpty);
+	return MTPDphotoSizeEmptyView(_from, _end);
+}
+
+inline MTPstring MTPDphotoSizeView::vtype() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPfileLocationView> MTPDphotoSizeView::vlocation() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPfileLocationView>(from, end);
+}
+
+inline MTPint MTPDphotoSizeView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDphotoSizeView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDphotoSizeView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDphotoSizeView MTPphotoSizeView::c_photoSize() const {
+	if (_type != mtpc_photoSize) throw mtpErrorWrongTypeId(_type, mtpc_photoSize);
+	return MTPDphotoSizeView(_from, _end);
+}
+
+inline MTPstring MTPDphotoCachedSizeView::vtype() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPfileLocationView> MTPDphotoCachedSizeView::vlocation() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPfileLocationView>(from, end);
+}
+
+inline MTPint MTPDphotoCachedSizeView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDphotoCachedSizeView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDphotoCachedSizeView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPfileLocationView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDphotoCachedSizeView MTPphotoSizeView::c_photoCachedSize() const {
+	if (_type != mtpc_photoCachedSize) throw mtpErrorWrongTypeId(_type, mtpc_photoCachedSize);
+	return MTPDphotoCachedSizeView(_from, _end);
+}
+
+inline MTPphotoSize MTPphotoSizeView::read() const {
+	const mtpPrime *from = _from;
+	return MTPphotoSize(from, _end, _type);
+}
+
+inline void MTPphotoSizeView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_photoSizeEmpty:
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_photoSize:
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPfileLocationView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_photoCachedSize:
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPfileLocationView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPphotoSizeView");
+	}
+}
+
+inline MTPlong MTPDvideoEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPDvideoEmptyView MTPvideoView::c_videoEmpty() const {
+	if (_type != mtpc_videoEmpty) throw mtpErrorWrongTypeId(_type, mtpc_videoEmpty);
+	return MTPDvideoEmptyView(_from, _end);
+}
+
+inline MTPlong MTPDvideoView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDvideoView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDvideoView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDvideoView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDvideoView::vcaption() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDvideoView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDvideoView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDvideoView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPphotoSizeView> MTPDvideoView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPphotoSizeView>(from, end);
+}
+
+inline MTPint MTPDvideoView::vdc_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPphotoSizeView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDvideoView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPphotoSizeView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDvideoView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPphotoSizeView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDvideoView MTPvideoView::c_video() const {
+	if (_type != mtpc_video) throw mtpErrorWrongTypeId(_type, mtpc_video);
+	return MTPDvideoView(_from, _end);
+}
+
+inline MTPvideo MTPvideoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPvideo(from, _end, _type);
+}
+
+inline void MTPvideoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_videoEmpty:
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_video:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPphotoSizeView>::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPvideoView");
+	}
+}
+
+inline MTPdouble MTPDgeoPointView::vlong() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPdouble(from, end);
+}
+
+inline MTPdouble MTPDgeoPointView::vlat() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	return MTPdouble(from, end);
+}
+
+inline MTPDgeoPointView MTPgeoPointView::c_geoPoint() const {
+	if (_type != mtpc_geoPoint) throw mtpErrorWrongTypeId(_type, mtpc_geoPoint);
+	return MTPDgeoPointView(_from, _end);
+}
+
+inline MTPgeoPoint MTPgeoPointView::read() const {
+	const mtpPrime *from = _from;
+	return MTPgeoPoint(from, _end, _type);
+}
+
+inline void MTPgeoPointView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_geoPointEmpty: break;
+		case mtpc_geoPoint:
+			MTPdouble::skip(from, end);
+			MTPdouble::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPgeoPointView");
+	}
+}
+
+inline MTPBoxedView<MTPbool> MTPDauth_checkedPhoneView::vphone_registered() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDauth_checkedPhoneView::vphone_invited() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDauth_checkedPhoneView MTPauth_checkedPhoneView::c_auth_checkedPhone() const {
+	return MTPDauth_checkedPhoneView(_from, _end);
+}
+
+inline MTPauth_checkedPhone MTPauth_checkedPhoneView::read() const {
+	const mtpPrime *from = _from;
+	return MTPauth_checkedPhone(from, _end, _type);
+}
+
+inline void MTPauth_checkedPhoneView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_checkedPhone) throw mtpErrorUnexpected(cons, "MTPauth_checkedPhoneView");
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDauth_sentCodeView::vphone_registered() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPstring MTPDauth_sentCodeView::vphone_code_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDauth_sentCodeView::vsend_call_timeout() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDauth_sentCodeView::vis_password() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDauth_sentCodeView MTPauth_sentCodeView::c_auth_sentCode() const {
+	return MTPDauth_sentCodeView(_from, _end);
+}
+
+inline MTPauth_sentCode MTPauth_sentCodeView::read() const {
+	const mtpPrime *from = _from;
+	return MTPauth_sentCode(from, _end, _type);
+}
+
+inline void MTPauth_sentCodeView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_sentCode) throw mtpErrorUnexpected(cons, "MTPauth_sentCodeView");
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+}
+
+inline MTPint MTPDauth_authorizationView::vexpires() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPuserView> MTPDauth_authorizationView::vuser() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPuserView>(from, end);
+}
+
+inline MTPDauth_authorizationView MTPauth_authorizationView::c_auth_authorization() const {
+	return MTPDauth_authorizationView(_from, _end);
+}
+
+inline MTPauth_authorization MTPauth_authorizationView::read() const {
+	const mtpPrime *from = _from;
+	return MTPauth_authorization(from, _end, _type);
+}
+
+inline void MTPauth_authorizationView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_authorization) throw mtpErrorUnexpected(cons, "MTPauth_authorizationView");
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPuserView>::skip(from, end);
+}
+
+inline MTPint MTPDauth_exportedAuthorizationView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDauth_exportedAuthorizationView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDauth_exportedAuthorizationView MTPauth_exportedAuthorizationView::c_auth_exportedAuthorization() const {
+	return MTPDauth_exportedAuthorizationView(_from, _end);
+}
+
+inline MTPauth_exportedAuthorization MTPauth_exportedAuthorizationView::read() const {
+	const mtpPrime *from = _from;
+	return MTPauth_exportedAuthorization(from, _end, _type);
+}
+
+inline void MTPauth_exportedAuthorizationView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_exportedAuthorization) throw mtpErrorUnexpected(cons, "MTPauth_exportedAuthorizationView");
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+}
+
+inline MTPBoxedView<MTPinputPeerView> MTPDinputNotifyPeerView::vpeer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputPeerView>(from, end);
+}
+
+inline MTPDinputNotifyPeerView MTPinputNotifyPeerView::c_inputNotifyPeer() const {
+	if (_type != mtpc_inputNotifyPeer) throw mtpErrorWrongTypeId(_type, mtpc_inputNotifyPeer);
+	return MTPDinputNotifyPeerView(_from, _end);
+}
+
+inline MTPBoxedView<MTPinputGeoChatView> MTPDinputNotifyGeoChatPeerView::vpeer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPinputGeoChatView>(from, end);
+}
+
+inline MTPDinputNotifyGeoChatPeerView MTPinputNotifyPeerView::c_inputNotifyGeoChatPeer() const {
+	if (_type != mtpc_inputNotifyGeoChatPeer) throw mtpErrorWrongTypeId(_type, mtpc_inputNotifyGeoChatPeer);
+	return MTPDinputNotifyGeoChatPeerView(_from, _end);
+}
+
+inline MTPinputNotifyPeer MTPinputNotifyPeerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputNotifyPeer(from, _end, _type);
+}
+
+inline void MTPinputNotifyPeerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputNotifyPeer:
+			MTPBoxedView<MTPinputPeerView>::skip(from, end);
+		break;
+		case mtpc_inputNotifyUsers: break;
+		case mtpc_inputNotifyChats: break;
+		case mtpc_inputNotifyAll: break;
+		case mtpc_inputNotifyGeoChatPeer:
+			MTPBoxedView<MTPinputGeoChatView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputNotifyPeerView");
+	}
+}
+
+inline MTPinputPeerNotifyEvents MTPinputPeerNotifyEventsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputPeerNotifyEvents(from, _end, _type);
+}
+
+inline void MTPinputPeerNotifyEventsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPeerNotifyEventsEmpty: break;
+		case mtpc_inputPeerNotifyEventsAll: break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputPeerNotifyEventsView");
+	}
+}
+
+inline MTPint MTPDinputPeerNotifySettingsView::vmute_until() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputPeerNotifySettingsView::vsound() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDinputPeerNotifySettingsView::vshow_previews() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDinputPeerNotifySettingsView::vevents_mask() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDinputPeerNotifySettingsView MTPinputPeerNotifySettingsView::c_inputPeerNotifySettings() const {
+	return MTPDinputPeerNotifySettingsView(_from, _end);
+}
+
+inline MTPinputPeerNotifySettings MTPinputPeerNotifySettingsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputPeerNotifySettings(from, _end, _type);
+}
+
+inline void MTPinputPeerNotifySettingsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputPeerNotifySettings) throw mtpErrorUnexpected(cons, "MTPinputPeerNotifySettingsView");
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPpeerNotifyEvents MTPpeerNotifyEventsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPpeerNotifyEvents(from, _end, _type);
+}
+
+inline void MTPpeerNotifyEventsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_peerNotifyEventsEmpty: break;
+		case mtpc_peerNotifyEventsAll: break;
+		default: throw mtpErrorUnexpected(cons, "MTPpeerNotifyEventsView");
+	}
+}
+
+inline MTPint MTPDpeerNotifySettingsView::vmute_until() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDpeerNotifySettingsView::vsound() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDpeerNotifySettingsView::vshow_previews() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDpeerNotifySettingsView::vevents_mask() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDpeerNotifySettingsView MTPpeerNotifySettingsView::c_peerNotifySettings() const {
+	if (_type != mtpc_peerNotifySettings) throw mtpErrorWrongTypeId(_type, mtpc_peerNotifySettings);
+	return MTPDpeerNotifySettingsView(_from, _end);
+}
+
+inline MTPpeerNotifySettings MTPpeerNotifySettingsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPpeerNotifySettings(from, _end, _type);
+}
+
+inline void MTPpeerNotifySettingsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_peerNotifySettingsEmpty: break;
+		case mtpc_peerNotifySettings:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPpeerNotifySettingsView");
+	}
+}
+
+inline MTPint MTPDwallPaperView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDwallPaperView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > > MTPDwallPaperView::vsizes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > >(from, end);
+}
+
+inline MTPint MTPDwallPaperView::vcolor() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDwallPaperView MTPwallPaperView::c_wallPaper() const {
+	if (_type != mtpc_wallPaper) throw mtpErrorWrongTypeId(_type, mtpc_wallPaper);
+	return MTPDwallPaperView(_from, _end);
+}
+
+inline MTPint MTPDwallPaperSolidView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDwallPaperSolidView::vtitle() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDwallPaperSolidView::vbg_color() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDwallPaperSolidView::vcolor() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDwallPaperSolidView MTPwallPaperView::c_wallPaperSolid() const {
+	if (_type != mtpc_wallPaperSolid) throw mtpErrorWrongTypeId(_type, mtpc_wallPaperSolid);
+	return MTPDwallPaperSolidView(_from, _end);
+}
+
+inline MTPwallPaper MTPwallPaperView::read() const {
+	const mtpPrime *from = _from;
+	return MTPwallPaper(from, _end, _type);
+}
+
+inline void MTPwallPaperView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_wallPaper:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoSizeView> > >::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_wallPaperSolid:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPwallPaperView");
+	}
+}
+
+inline MTPBoxedView<MTPuserView> MTPDuserFullView::vuser() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPuserView>(from, end);
+}
+
+inline MTPBoxedView<MTPcontacts_linkView> MTPDuserFullView::vlink() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	return MTPBoxedView<MTPcontacts_linkView>(from, end);
+}
+
+inline MTPBoxedView<MTPphotoView> MTPDuserFullView::vprofile_photo() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_linkView>::skip(from, end);
+	return MTPBoxedView<MTPphotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPpeerNotifySettingsView> MTPDuserFullView::vnotify_settings() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_linkView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	return MTPBoxedView<MTPpeerNotifySettingsView>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDuserFullView::vblocked() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_linkView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPstring MTPDuserFullView::vreal_first_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_linkView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDuserFullView::vreal_last_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_linkView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDuserFullView MTPuserFullView::c_userFull() const {
+	return MTPDuserFullView(_from, _end);
+}
+
+inline MTPuserFull MTPuserFullView::read() const {
+	const mtpPrime *from = _from;
+	return MTPuserFull(from, _end, _type);
+}
+
+inline void MTPuserFullView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_userFull) throw mtpErrorUnexpected(cons, "MTPuserFullView");
+	MTPBoxedView<MTPuserView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_linkView>::skip(from, end);
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+}
+
+inline MTPint MTPDcontactView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDcontactView::vmutual() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDcontactView MTPcontactView::c_contact() const {
+	return MTPDcontactView(_from, _end);
+}
+
+inline MTPcontact MTPcontactView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontact(from, _end, _type);
+}
+
+inline void MTPcontactView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contact) throw mtpErrorUnexpected(cons, "MTPcontactView");
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+}
+
+inline MTPint MTPDimportedContactView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDimportedContactView::vclient_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDimportedContactView MTPimportedContactView::c_importedContact() const {
+	return MTPDimportedContactView(_from, _end);
+}
+
+inline MTPimportedContact MTPimportedContactView::read() const {
+	const mtpPrime *from = _from;
+	return MTPimportedContact(from, _end, _type);
+}
+
+inline void MTPimportedContactView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_importedContact) throw mtpErrorUnexpected(cons, "MTPimportedContactView");
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+}
+
+inline MTPint MTPDcontactBlockedView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDcontactBlockedView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDcontactBlockedView MTPcontactBlockedView::c_contactBlocked() const {
+	return MTPDcontactBlockedView(_from, _end);
+}
+
+inline MTPcontactBlocked MTPcontactBlockedView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontactBlocked(from, _end, _type);
+}
+
+inline void MTPcontactBlockedView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactBlocked) throw mtpErrorUnexpected(cons, "MTPcontactBlockedView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDcontactFoundView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDcontactFoundView MTPcontactFoundView::c_contactFound() const {
+	return MTPDcontactFoundView(_from, _end);
+}
+
+inline MTPcontactFound MTPcontactFoundView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontactFound(from, _end, _type);
+}
+
+inline void MTPcontactFoundView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactFound) throw mtpErrorUnexpected(cons, "MTPcontactFoundView");
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDcontactSuggestedView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDcontactSuggestedView::vmutual_contacts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDcontactSuggestedView MTPcontactSuggestedView::c_contactSuggested() const {
+	return MTPDcontactSuggestedView(_from, _end);
+}
+
+inline MTPcontactSuggested MTPcontactSuggestedView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontactSuggested(from, _end, _type);
+}
+
+inline void MTPcontactSuggestedView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactSuggested) throw mtpErrorUnexpected(cons, "MTPcontactSuggestedView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDcontactStatusView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDcontactStatusView::vexpires() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDcontactStatusView MTPcontactStatusView::c_contactStatus() const {
+	return MTPDcontactStatusView(_from, _end);
+}
+
+inline MTPcontactStatus MTPcontactStatusView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontactStatus(from, _end, _type);
+}
+
+inline void MTPcontactStatusView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactStatus) throw mtpErrorUnexpected(cons, "MTPcontactStatusView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDchatLocatedView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDchatLocatedView::vdistance() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDchatLocatedView MTPchatLocatedView::c_chatLocated() const {
+	return MTPDchatLocatedView(_from, _end);
+}
+
+inline MTPchatLocated MTPchatLocatedView::read() const {
+	const mtpPrime *from = _from;
+	return MTPchatLocated(from, _end, _type);
+}
+
+inline void MTPchatLocatedView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_chatLocated) throw mtpErrorUnexpected(cons, "MTPchatLocatedView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDcontacts_foreignLinkRequestedView::vhas_phone() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDcontacts_foreignLinkRequestedView MTPcontacts_foreignLinkView::c_contacts_foreignLinkRequested() const {
+	if (_type != mtpc_contacts_foreignLinkRequested) throw mtpErrorWrongTypeId(_type, mtpc_contacts_foreignLinkRequested);
+	return MTPDcontacts_foreignLinkRequestedView(_from, _end);
+}
+
+inline MTPcontacts_foreignLink MTPcontacts_foreignLinkView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_foreignLink(from, _end, _type);
+}
+
+inline void MTPcontacts_foreignLinkView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contacts_foreignLinkUnknown: break;
+		case mtpc_contacts_foreignLinkRequested:
+			MTPBoxedView<MTPbool>::skip(from, end);
+		break;
+		case mtpc_contacts_foreignLinkMutual: break;
+		default: throw mtpErrorUnexpected(cons, "MTPcontacts_foreignLinkView");
+	}
+}
+
+inline MTPBoxedView<MTPbool> MTPDcontacts_myLinkRequestedView::vcontact() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDcontacts_myLinkRequestedView MTPcontacts_myLinkView::c_contacts_myLinkRequested() const {
+	if (_type != mtpc_contacts_myLinkRequested) throw mtpErrorWrongTypeId(_type, mtpc_contacts_myLinkRequested);
+	return MTPDcontacts_myLinkRequestedView(_from, _end);
+}
+
+inline MTPcontacts_myLink MTPcontacts_myLinkView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_myLink(from, _end, _type);
+}
+
+inline void MTPcontacts_myLinkView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contacts_myLinkEmpty: break;
+		case mtpc_contacts_myLinkRequested:
+			MTPBoxedView<MTPbool>::skip(from, end);
+		break;
+		case mtpc_contacts_myLinkContact: break;
+		default: throw mtpErrorUnexpected(cons, "MTPcontacts_myLinkView");
+	}
+}
+
+inline MTPBoxedView<MTPcontacts_myLinkView> MTPDcontacts_linkView::vmy_link() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPcontacts_myLinkView>(from, end);
+}
+
+inline MTPBoxedView<MTPcontacts_foreignLinkView> MTPDcontacts_linkView::vforeign_link() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPcontacts_myLinkView>::skip(from, end);
+	return MTPBoxedView<MTPcontacts_foreignLinkView>(from, end);
+}
+
+inline MTPBoxedView<MTPuserView> MTPDcontacts_linkView::vuser() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPcontacts_myLinkView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_foreignLinkView>::skip(from, end);
+	return MTPBoxedView<MTPuserView>(from, end);
+}
+
+inline MTPDcontacts_linkView MTPcontacts_linkView::c_contacts_link() const {
+	return MTPDcontacts_linkView(_from, _end);
+}
+
+inline MTPcontacts_link MTPcontacts_linkView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_link(from, _end, _type);
+}
+
+inline void MTPcontacts_linkView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_link) throw mtpErrorUnexpected(cons, "MTPcontacts_linkView");
+	MTPBoxedView<MTPcontacts_myLinkView>::skip(from, end);
+	MTPBoxedView<MTPcontacts_foreignLinkView>::skip(from, end);
+	MTPBoxedView<MTPuserView>::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactView> > > MTPDcontacts_contactsView::vcontacts() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDcontacts_contactsView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDcontacts_contactsView MTPcontacts_contactsView::c_contacts_contacts() const {
+	if (_type != mtpc_contacts_contacts) throw mtpErrorWrongTypeId(_type, mtpc_contacts_contacts);
+	return MTPDcontacts_contactsView(_from, _end);
+}
+
+inline MTPcontacts_contacts MTPcontacts_contactsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_contacts(from, _end, _type);
+}
+
+inline void MTPcontacts_contactsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contacts_contacts:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		case mtpc_contacts_contactsNotModified: break;
+		default: throw mtpErrorUnexpected(cons, "MTPcontacts_contactsView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPimportedContactView> > > MTPDcontacts_importedContactsView::vimported() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPimportedContactView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDcontacts_importedContactsView::vretry_contacts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPimportedContactView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDcontacts_importedContactsView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPimportedContactView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDcontacts_importedContactsView MTPcontacts_importedContactsView::c_contacts_importedContacts() const {
+	return MTPDcontacts_importedContactsView(_from, _end);
+}
+
+inline MTPcontacts_importedContacts MTPcontacts_importedContactsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_importedContacts(from, _end, _type);
+}
+
+inline void MTPcontacts_importedContactsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_importedContacts) throw mtpErrorUnexpected(cons, "MTPcontacts_importedContactsView");
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPimportedContactView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > > MTPDcontacts_blockedView::vblocked() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDcontacts_blockedView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDcontacts_blockedView MTPcontacts_blockedView::c_contacts_blocked() const {
+	if (_type != mtpc_contacts_blocked) throw mtpErrorWrongTypeId(_type, mtpc_contacts_blocked);
+	return MTPDcontacts_blockedView(_from, _end);
+}
+
+inline MTPint MTPDcontacts_blockedSliceView::vcount() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > > MTPDcontacts_blockedSliceView::vblocked() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDcontacts_blockedSliceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDcontacts_blockedSliceView MTPcontacts_blockedView::c_contacts_blockedSlice() const {
+	if (_type != mtpc_contacts_blockedSlice) throw mtpErrorWrongTypeId(_type, mtpc_contacts_blockedSlice);
+	return MTPDcontacts_blockedSliceView(_from, _end);
+}
+
+inline MTPcontacts_blocked MTPcontacts_blockedView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_blocked(from, _end, _type);
+}
+
+inline void MTPcontacts_blockedView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contacts_blocked:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		case mtpc_contacts_blockedSlice:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactBlockedView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPcontacts_blockedView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactFoundView> > > MTPDcontacts_foundView::vresults() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactFoundView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDcontacts_foundView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactFoundView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDcontacts_foundView MTPcontacts_foundView::c_contacts_found() const {
+	return MTPDcontacts_foundView(_from, _end);
+}
+
+inline MTPcontacts_found MTPcontacts_foundView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_found(from, _end, _type);
+}
+
+inline void MTPcontacts_foundView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_found) throw mtpErrorUnexpected(cons, "MTPcontacts_foundView");
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactFoundView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactSuggestedView> > > MTPDcontacts_suggestedView::vresults() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactSuggestedView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDcontacts_suggestedView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactSuggestedView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDcontacts_suggestedView MTPcontacts_suggestedView::c_contacts_suggested() const {
+	return MTPDcontacts_suggestedView(_from, _end);
+}
+
+inline MTPcontacts_suggested MTPcontacts_suggestedView::read() const {
+	const mtpPrime *from = _from;
+	return MTPcontacts_suggested(from, _end, _type);
+}
+
+inline void MTPcontacts_suggestedView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_suggested) throw mtpErrorUnexpected(cons, "MTPcontacts_suggestedView");
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontactSuggestedView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > > MTPDmessages_dialogsView::vdialogs() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDmessages_dialogsView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_dialogsView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_dialogsView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_dialogsView MTPmessages_dialogsView::c_messages_dialogs() const {
+	if (_type != mtpc_messages_dialogs) throw mtpErrorWrongTypeId(_type, mtpc_messages_dialogs);
+	return MTPDmessages_dialogsView(_from, _end);
+}
+
+inline MTPint MTPDmessages_dialogsSliceView::vcount() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > > MTPDmessages_dialogsSliceView::vdialogs() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDmessages_dialogsSliceView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_dialogsSliceView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_dialogsSliceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_dialogsSliceView MTPmessages_dialogsView::c_messages_dialogsSlice() const {
+	if (_type != mtpc_messages_dialogsSlice) throw mtpErrorWrongTypeId(_type, mtpc_messages_dialogsSlice);
+	return MTPDmessages_dialogsSliceView(_from, _end);
+}
+
+inline MTPmessages_dialogs MTPmessages_dialogsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_dialogs(from, _end, _type);
+}
+
+inline void MTPmessages_dialogsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_dialogs:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		case mtpc_messages_dialogsSlice:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdialogView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_dialogsView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDmessages_messagesView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_messagesView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_messagesView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_messagesView MTPmessages_messagesView::c_messages_messages() const {
+	if (_type != mtpc_messages_messages) throw mtpErrorWrongTypeId(_type, mtpc_messages_messages);
+	return MTPDmessages_messagesView(_from, _end);
+}
+
+inline MTPint MTPDmessages_messagesSliceView::vcount() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDmessages_messagesSliceView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_messagesSliceView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_messagesSliceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_messagesSliceView MTPmessages_messagesView::c_messages_messagesSlice() const {
+	if (_type != mtpc_messages_messagesSlice) throw mtpErrorWrongTypeId(_type, mtpc_messages_messagesSlice);
+	return MTPDmessages_messagesSliceView(_from, _end);
+}
+
+inline MTPmessages_messages MTPmessages_messagesView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_messages(from, _end, _type);
+}
+
+inline void MTPmessages_messagesView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_messages:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		case mtpc_messages_messagesSlice:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_messagesView");
+	}
+}
+
+inline MTPBoxedView<MTPmessageView> MTPDmessages_messageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPmessageView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_messageView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_messageView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_messageView MTPmessages_messageView::c_messages_message() const {
+	if (_type != mtpc_messages_message) throw mtpErrorWrongTypeId(_type, mtpc_messages_message);
+	return MTPDmessages_messageView(_from, _end);
+}
+
+inline MTPmessages_message MTPmessages_messageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_message(from, _end, _type);
+}
+
+inline void MTPmessages_messageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_messageEmpty: break;
+		case mtpc_messages_message:
+			MTPBoxedView<MTPmessageView>::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_messageView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDmessages_statedMessagesView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_statedMessagesView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_statedMessagesView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessagesView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessagesView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_statedMessagesView MTPmessages_statedMessagesView::c_messages_statedMessages() const {
+	if (_type != mtpc_messages_statedMessages) throw mtpErrorWrongTypeId(_type, mtpc_messages_statedMessages);
+	return MTPDmessages_statedMessagesView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDmessages_statedMessagesLinksView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_statedMessagesLinksView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_statedMessagesLinksView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > > MTPDmessages_statedMessagesLinksView::vlinks() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessagesLinksView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessagesLinksView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_statedMessagesLinksView MTPmessages_statedMessagesView::c_messages_statedMessagesLinks() const {
+	if (_type != mtpc_messages_statedMessagesLinks) throw mtpErrorWrongTypeId(_type, mtpc_messages_statedMessagesLinks);
+	return MTPDmessages_statedMessagesLinksView(_from, _end);
+}
+
+inline MTPmessages_statedMessages MTPmessages_statedMessagesView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_statedMessages(from, _end, _type);
+}
+
+inline void MTPmessages_statedMessagesView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_statedMessages:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messages_statedMessagesLinks:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_statedMessagesView");
+	}
+}
+
+inline MTPBoxedView<MTPmessageView> MTPDmessages_statedMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPmessageView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_statedMessageView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_statedMessageView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessageView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessageView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_statedMessageView MTPmessages_statedMessageView::c_messages_statedMessage() const {
+	if (_type != mtpc_messages_statedMessage) throw mtpErrorWrongTypeId(_type, mtpc_messages_statedMessage);
+	return MTPDmessages_statedMessageView(_from, _end);
+}
+
+inline MTPBoxedView<MTPmessageView> MTPDmessages_statedMessageLinkView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPmessageView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_statedMessageLinkView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_statedMessageLinkView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > > MTPDmessages_statedMessageLinkView::vlinks() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessageLinkView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_statedMessageLinkView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_statedMessageLinkView MTPmessages_statedMessageView::c_messages_statedMessageLink() const {
+	if (_type != mtpc_messages_statedMessageLink) throw mtpErrorWrongTypeId(_type, mtpc_messages_statedMessageLink);
+	return MTPDmessages_statedMessageLinkView(_from, _end);
+}
+
+inline MTPmessages_statedMessage MTPmessages_statedMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_statedMessage(from, _end, _type);
+}
+
+inline void MTPmessages_statedMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_statedMessage:
+			MTPBoxedView<MTPmessageView>::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messages_statedMessageLink:
+			MTPBoxedView<MTPmessageView>::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_statedMessageView");
+	}
+}
+
+inline MTPint MTPDmessages_sentMessageView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_sentMessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_sentMessageView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_sentMessageView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_sentMessageView MTPmessages_sentMessageView::c_messages_sentMessage() const {
+	if (_type != mtpc_messages_sentMessage) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentMessage);
+	return MTPDmessages_sentMessageView(_from, _end);
+}
+
+inline MTPint MTPDmessages_sentMessageLinkView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_sentMessageLinkView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_sentMessageLinkView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_sentMessageLinkView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > > MTPDmessages_sentMessageLinkView::vlinks() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >(from, end);
+}
+
+inline MTPDmessages_sentMessageLinkView MTPmessages_sentMessageView::c_messages_sentMessageLink() const {
+	if (_type != mtpc_messages_sentMessageLink) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentMessageLink);
+	return MTPDmessages_sentMessageLinkView(_from, _end);
+}
+
+inline MTPmessages_sentMessage MTPmessages_sentMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_sentMessage(from, _end, _type);
+}
+
+inline void MTPmessages_sentMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_sentMessage:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messages_sentMessageLink:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPcontacts_linkView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_sentMessageView");
+	}
+}
+
+inline MTPBoxedView<MTPchatView> MTPDmessages_chatView::vchat() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPchatView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_chatView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPchatView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_chatView MTPmessages_chatView::c_messages_chat() const {
+	return MTPDmessages_chatView(_from, _end);
+}
+
+inline MTPmessages_chat MTPmessages_chatView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_chat(from, _end, _type);
+}
+
+inline void MTPmessages_chatView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_chat) throw mtpErrorUnexpected(cons, "MTPmessages_chatView");
+	MTPBoxedView<MTPchatView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_chatsView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_chatsView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_chatsView MTPmessages_chatsView::c_messages_chats() const {
+	return MTPDmessages_chatsView(_from, _end);
+}
+
+inline MTPmessages_chats MTPmessages_chatsView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_chats(from, _end, _type);
+}
+
+inline void MTPmessages_chatsView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_chats) throw mtpErrorUnexpected(cons, "MTPmessages_chatsView");
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPchatFullView> MTPDmessages_chatFullView::vfull_chat() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPchatFullView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDmessages_chatFullView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPchatFullView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDmessages_chatFullView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPchatFullView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDmessages_chatFullView MTPmessages_chatFullView::c_messages_chatFull() const {
+	return MTPDmessages_chatFullView(_from, _end);
+}
+
+inline MTPmessages_chatFull MTPmessages_chatFullView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_chatFull(from, _end, _type);
+}
+
+inline void MTPmessages_chatFullView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_chatFull) throw mtpErrorUnexpected(cons, "MTPmessages_chatFullView");
+	MTPBoxedView<MTPchatFullView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPint MTPDmessages_affectedHistoryView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_affectedHistoryView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDmessages_affectedHistoryView::voffset() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_affectedHistoryView MTPmessages_affectedHistoryView::c_messages_affectedHistory() const {
+	return MTPDmessages_affectedHistoryView(_from, _end);
+}
+
+inline MTPmessages_affectedHistory MTPmessages_affectedHistoryView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_affectedHistory(from, _end, _type);
+}
+
+inline void MTPmessages_affectedHistoryView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_affectedHistory) throw mtpErrorUnexpected(cons, "MTPmessages_affectedHistoryView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPmessagesFilter MTPmessagesFilterView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessagesFilter(from, _end, _type);
+}
+
+inline void MTPmessagesFilterView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputMessagesFilterEmpty: break;
+		case mtpc_inputMessagesFilterPhotos: break;
+		case mtpc_inputMessagesFilterVideo: break;
+		case mtpc_inputMessagesFilterPhotoVideo: break;
+		case mtpc_inputMessagesFilterDocument: break;
+		case mtpc_inputMessagesFilterAudio: break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessagesFilterView");
+	}
+}
+
+inline MTPBoxedView<MTPmessageView> MTPDupdateNewMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPmessageView>(from, end);
+}
+
+inline MTPint MTPDupdateNewMessageView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPmessageView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateNewMessageView MTPupdateView::c_updateNewMessage() const {
+	if (_type != mtpc_updateNewMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateNewMessage);
+	return MTPDupdateNewMessageView(_from, _end);
+}
+
+inline MTPint MTPDupdateMessageIDView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDupdateMessageIDView::vrandom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDupdateMessageIDView MTPupdateView::c_updateMessageID() const {
+	if (_type != mtpc_updateMessageID) throw mtpErrorWrongTypeId(_type, mtpc_updateMessageID);
+	return MTPDupdateMessageIDView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPint > > MTPDupdateReadMessagesView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPint > >(from, end);
+}
+
+inline MTPint MTPDupdateReadMessagesView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateReadMessagesView MTPupdateView::c_updateReadMessages() const {
+	if (_type != mtpc_updateReadMessages) throw mtpErrorWrongTypeId(_type, mtpc_updateReadMessages);
+	return MTPDupdateReadMessagesView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPint > > MTPDupdateDeleteMessagesView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPint > >(from, end);
+}
+
+inline MTPint MTPDupdateDeleteMessagesView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateDeleteMessagesView MTPupdateView::c_updateDeleteMessages() const {
+	if (_type != mtpc_updateDeleteMessages) throw mtpErrorWrongTypeId(_type, mtpc_updateDeleteMessages);
+	return MTPDupdateDeleteMessagesView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPint > > MTPDupdateRestoreMessagesView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPint > >(from, end);
+}
+
+inline MTPint MTPDupdateRestoreMessagesView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateRestoreMessagesView MTPupdateView::c_updateRestoreMessages() const {
+	if (_type != mtpc_updateRestoreMessages) throw mtpErrorWrongTypeId(_type, mtpc_updateRestoreMessages);
+	return MTPDupdateRestoreMessagesView(_from, _end);
+}
+
+inline MTPint MTPDupdateUserTypingView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDupdateUserTypingView MTPupdateView::c_updateUserTyping() const {
+	if (_type != mtpc_updateUserTyping) throw mtpErrorWrongTypeId(_type, mtpc_updateUserTyping);
+	return MTPDupdateUserTypingView(_from, _end);
+}
+
+inline MTPint MTPDupdateChatUserTypingView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateChatUserTypingView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateChatUserTypingView MTPupdateView::c_updateChatUserTyping() const {
+	if (_type != mtpc_updateChatUserTyping) throw mtpErrorWrongTypeId(_type, mtpc_updateChatUserTyping);
+	return MTPDupdateChatUserTypingView(_from, _end);
+}
+
+inline MTPBoxedView<MTPchatParticipantsView> MTPDupdateChatParticipantsView::vparticipants() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPchatParticipantsView>(from, end);
+}
+
+inline MTPDupdateChatParticipantsView MTPupdateView::c_updateChatParticipants() const {
+	if (_type != mtpc_updateChatParticipants) throw mtpErrorWrongTypeId(_type, mtpc_updateChatParticipants);
+	return MTPDupdateChatParticipantsView(_from, _end);
+}
+
+inline MTPint MTPDupdateUserStatusView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPuserStatusView> MTPDupdateUserStatusView::vstatus() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPuserStatusView>(from, end);
+}
+
+inline MTPDupdateUserStatusView MTPupdateView::c_updateUserStatus() const {
+	if (_type != mtpc_updateUserStatus) throw mtpErrorWrongTypeId(_type, mtpc_updateUserStatus);
+	return MTPDupdateUserStatusView(_from, _end);
+}
+
+inline MTPint MTPDupdateUserNameView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDupdateUserNameView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDupdateUserNameView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDupdateUserNameView MTPupdateView::c_updateUserName() const {
+	if (_type != mtpc_updateUserName) throw mtpErrorWrongTypeId(_type, mtpc_updateUserName);
+	return MTPDupdateUserNameView(_from, _end);
+}
+
+inline MTPint MTPDupdateUserPhotoView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateUserPhotoView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPuserProfilePhotoView> MTPDupdateUserPhotoView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPuserProfilePhotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDupdateUserPhotoView::vprevious() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDupdateUserPhotoView MTPupdateView::c_updateUserPhoto() const {
+	if (_type != mtpc_updateUserPhoto) throw mtpErrorWrongTypeId(_type, mtpc_updateUserPhoto);
+	return MTPDupdateUserPhotoView(_from, _end);
+}
+
+inline MTPint MTPDupdateContactRegisteredView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateContactRegisteredView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateContactRegisteredView MTPupdateView::c_updateContactRegistered() const {
+	if (_type != mtpc_updateContactRegistered) throw mtpErrorWrongTypeId(_type, mtpc_updateContactRegistered);
+	return MTPDupdateContactRegisteredView(_from, _end);
+}
+
+inline MTPint MTPDupdateContactLinkView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPcontacts_myLinkView> MTPDupdateContactLinkView::vmy_link() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPcontacts_myLinkView>(from, end);
+}
+
+inline MTPBoxedView<MTPcontacts_foreignLinkView> MTPDupdateContactLinkView::vforeign_link() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPcontacts_myLinkView>::skip(from, end);
+	return MTPBoxedView<MTPcontacts_foreignLinkView>(from, end);
+}
+
+inline MTPDupdateContactLinkView MTPupdateView::c_updateContactLink() const {
+	if (_type != mtpc_updateContactLink) throw mtpErrorWrongTypeId(_type, mtpc_updateContactLink);
+	return MTPDupdateContactLinkView(_from, _end);
+}
+
+inline MTPint MTPDupdateActivationView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDupdateActivationView MTPupdateView::c_updateActivation() const {
+	if (_type != mtpc_updateActivation) throw mtpErrorWrongTypeId(_type, mtpc_updateActivation);
+	return MTPDupdateActivationView(_from, _end);
+}
+
+inline MTPlong MTPDupdateNewAuthorizationView::vauth_key_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDupdateNewAuthorizationView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDupdateNewAuthorizationView::vdevice() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDupdateNewAuthorizationView::vlocation() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDupdateNewAuthorizationView MTPupdateView::c_updateNewAuthorization() const {
+	if (_type != mtpc_updateNewAuthorization) throw mtpErrorWrongTypeId(_type, mtpc_updateNewAuthorization);
+	return MTPDupdateNewAuthorizationView(_from, _end);
+}
+
+inline MTPBoxedView<MTPgeoChatMessageView> MTPDupdateNewGeoChatMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPgeoChatMessageView>(from, end);
+}
+
+inline MTPDupdateNewGeoChatMessageView MTPupdateView::c_updateNewGeoChatMessage() const {
+	if (_type != mtpc_updateNewGeoChatMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateNewGeoChatMessage);
+	return MTPDupdateNewGeoChatMessageView(_from, _end);
+}
+
+inline MTPBoxedView<MTPencryptedMessageView> MTPDupdateNewEncryptedMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPencryptedMessageView>(from, end);
+}
+
+inline MTPint MTPDupdateNewEncryptedMessageView::vqts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPencryptedMessageView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateNewEncryptedMessageView MTPupdateView::c_updateNewEncryptedMessage() const {
+	if (_type != mtpc_updateNewEncryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateNewEncryptedMessage);
+	return MTPDupdateNewEncryptedMessageView(_from, _end);
+}
+
+inline MTPint MTPDupdateEncryptedChatTypingView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDupdateEncryptedChatTypingView MTPupdateView::c_updateEncryptedChatTyping() const {
+	if (_type != mtpc_updateEncryptedChatTyping) throw mtpErrorWrongTypeId(_type, mtpc_updateEncryptedChatTyping);
+	return MTPDupdateEncryptedChatTypingView(_from, _end);
+}
+
+inline MTPBoxedView<MTPencryptedChatView> MTPDupdateEncryptionView::vchat() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPencryptedChatView>(from, end);
+}
+
+inline MTPint MTPDupdateEncryptionView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPencryptedChatView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateEncryptionView MTPupdateView::c_updateEncryption() const {
+	if (_type != mtpc_updateEncryption) throw mtpErrorWrongTypeId(_type, mtpc_updateEncryption);
+	return MTPDupdateEncryptionView(_from, _end);
+}
+
+inline MTPint MTPDupdateEncryptedMessagesReadView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateEncryptedMessagesReadView::vmax_date() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateEncryptedMessagesReadView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateEncryptedMessagesReadView MTPupdateView::c_updateEncryptedMessagesRead() const {
+	if (_type != mtpc_updateEncryptedMessagesRead) throw mtpErrorWrongTypeId(_type, mtpc_updateEncryptedMessagesRead);
+	return MTPDupdateEncryptedMessagesReadView(_from, _end);
+}
+
+inline MTPint MTPDupdateChatParticipantAddView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateChatParticipantAddView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateChatParticipantAddView::vinviter_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateChatParticipantAddView::vversion() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateChatParticipantAddView MTPupdateView::c_updateChatParticipantAdd() const {
+	if (_type != mtpc_updateChatParticipantAdd) throw mtpErrorWrongTypeId(_type, mtpc_updateChatParticipantAdd);
+	return MTPDupdateChatParticipantAddView(_from, _end);
+}
+
+inline MTPint MTPDupdateChatParticipantDeleteView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateChatParticipantDeleteView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateChatParticipantDeleteView::vversion() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateChatParticipantDeleteView MTPupdateView::c_updateChatParticipantDelete() const {
+	if (_type != mtpc_updateChatParticipantDelete) throw mtpErrorWrongTypeId(_type, mtpc_updateChatParticipantDelete);
+	return MTPDupdateChatParticipantDeleteView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > > MTPDupdateDcOptionsView::vdc_options() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > >(from, end);
+}
+
+inline MTPDupdateDcOptionsView MTPupdateView::c_updateDcOptions() const {
+	if (_type != mtpc_updateDcOptions) throw mtpErrorWrongTypeId(_type, mtpc_updateDcOptions);
+	return MTPDupdateDcOptionsView(_from, _end);
+}
+
+inline MTPint MTPDupdateUserBlockedView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDupdateUserBlockedView::vblocked() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPDupdateUserBlockedView MTPupdateView::c_updateUserBlocked() const {
+	if (_type != mtpc_updateUserBlocked) throw mtpErrorWrongTypeId(_type, mtpc_updateUserBlocked);
+	return MTPDupdateUserBlockedView(_from, _end);
+}
+
+inline MTPBoxedView<MTPnotifyPeerView> MTPDupdateNotifySettingsView::vpeer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPnotifyPeerView>(from, end);
+}
+
+inline MTPBoxedView<MTPpeerNotifySettingsView> MTPDupdateNotifySettingsView::vnotify_settings() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPnotifyPeerView>::skip(from, end);
+	return MTPBoxedView<MTPpeerNotifySettingsView>(from, end);
+}
+
+inline MTPDupdateNotifySettingsView MTPupdateView::c_updateNotifySettings() const {
+	if (_type != mtpc_updateNotifySettings) throw mtpErrorWrongTypeId(_type, mtpc_updateNotifySettings);
+	return MTPDupdateNotifySettingsView(_from, _end);
+}
+
+inline MTPupdate MTPupdateView::read() const {
+	const mtpPrime *from = _from;
+	return MTPupdate(from, _end, _type);
+}
+
+inline void MTPupdateView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_updateNewMessage:
+			MTPBoxedView<MTPmessageView>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateMessageID:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_updateReadMessages:
+			MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateDeleteMessages:
+			MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateRestoreMessages:
+			MTPBoxedView<MTPvectorView<MTPint > >::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateUserTyping:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateChatUserTyping:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateChatParticipants:
+			MTPBoxedView<MTPchatParticipantsView>::skip(from, end);
+		break;
+		case mtpc_updateUserStatus:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPuserStatusView>::skip(from, end);
+		break;
+		case mtpc_updateUserName:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_updateUserPhoto:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPuserProfilePhotoView>::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+		break;
+		case mtpc_updateContactRegistered:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateContactLink:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPcontacts_myLinkView>::skip(from, end);
+			MTPBoxedView<MTPcontacts_foreignLinkView>::skip(from, end);
+		break;
+		case mtpc_updateActivation:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateNewAuthorization:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_updateNewGeoChatMessage:
+			MTPBoxedView<MTPgeoChatMessageView>::skip(from, end);
+		break;
+		case mtpc_updateNewEncryptedMessage:
+			MTPBoxedView<MTPencryptedMessageView>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateEncryptedChatTyping:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateEncryption:
+			MTPBoxedView<MTPencryptedChatView>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateEncryptedMessagesRead:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateChatParticipantAdd:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateChatParticipantDelete:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateDcOptions:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > >::skip(from, end);
+		break;
+		case mtpc_updateUserBlocked:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+		break;
+		case mtpc_updateNotifySettings:
+			MTPBoxedView<MTPnotifyPeerView>::skip(from, end);
+			MTPBoxedView<MTPpeerNotifySettingsView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPupdateView");
+	}
+}
+
+inline MTPint MTPDupdates_stateView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdates_stateView::vqts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdates_stateView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdates_stateView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdates_stateView::vunread_count() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdates_stateView MTPupdates_stateView::c_updates_state() const {
+	return MTPDupdates_stateView(_from, _end);
+}
+
+inline MTPupdates_state MTPupdates_stateView::read() const {
+	const mtpPrime *from = _from;
+	return MTPupdates_state(from, _end, _type);
+}
+
+inline void MTPupdates_stateView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_updates_state) throw mtpErrorUnexpected(cons, "MTPupdates_stateView");
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDupdates_differenceEmptyView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdates_differenceEmptyView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdates_differenceEmptyView MTPupdates_differenceView::c_updates_differenceEmpty() const {
+	if (_type != mtpc_updates_differenceEmpty) throw mtpErrorWrongTypeId(_type, mtpc_updates_differenceEmpty);
+	return MTPDupdates_differenceEmptyView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDupdates_differenceView::vnew_messages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > > MTPDupdates_differenceView::vnew_encrypted_messages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > MTPDupdates_differenceView::vother_updates() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDupdates_differenceView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDupdates_differenceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPupdates_stateView> MTPDupdates_differenceView::vstate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPBoxedView<MTPupdates_stateView>(from, end);
+}
+
+inline MTPDupdates_differenceView MTPupdates_differenceView::c_updates_difference() const {
+	if (_type != mtpc_updates_difference) throw mtpErrorWrongTypeId(_type, mtpc_updates_difference);
+	return MTPDupdates_differenceView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > > MTPDupdates_differenceSliceView::vnew_messages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > > MTPDupdates_differenceSliceView::vnew_encrypted_messages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > MTPDupdates_differenceSliceView::vother_updates() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDupdates_differenceSliceView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDupdates_differenceSliceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPupdates_stateView> MTPDupdates_differenceSliceView::vintermediate_state() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPBoxedView<MTPupdates_stateView>(from, end);
+}
+
+inline MTPDupdates_differenceSliceView MTPupdates_differenceView::c_updates_differenceSlice() const {
+	if (_type != mtpc_updates_differenceSlice) throw mtpErrorWrongTypeId(_type, mtpc_updates_differenceSlice);
+	return MTPDupdates_differenceSliceView(_from, _end);
+}
+
+inline MTPupdates_difference MTPupdates_differenceView::read() const {
+	const mtpPrime *from = _from;
+	return MTPupdates_difference(from, _end, _type);
+}
+
+inline void MTPupdates_differenceView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_updates_differenceEmpty:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updates_difference:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPBoxedView<MTPupdates_stateView>::skip(from, end);
+		break;
+		case mtpc_updates_differenceSlice:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPmessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPencryptedMessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPBoxedView<MTPupdates_stateView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPupdates_differenceView");
+	}
+}
+
+inline MTPint MTPDupdateShortMessageView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortMessageView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDupdateShortMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDupdateShortMessageView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortMessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortMessageView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateShortMessageView MTPupdatesView::c_updateShortMessage() const {
+	if (_type != mtpc_updateShortMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateShortMessage);
+	return MTPDupdateShortMessageView(_from, _end);
+}
+
+inline MTPint MTPDupdateShortChatMessageView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortChatMessageView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortChatMessageView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDupdateShortChatMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDupdateShortChatMessageView::vpts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortChatMessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdateShortChatMessageView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateShortChatMessageView MTPupdatesView::c_updateShortChatMessage() const {
+	if (_type != mtpc_updateShortChatMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateShortChatMessage);
+	return MTPDupdateShortChatMessageView(_from, _end);
+}
+
+inline MTPBoxedView<MTPupdateView> MTPDupdateShortView::vupdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPupdateView>(from, end);
+}
+
+inline MTPint MTPDupdateShortView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPupdateView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdateShortView MTPupdatesView::c_updateShort() const {
+	if (_type != mtpc_updateShort) throw mtpErrorWrongTypeId(_type, mtpc_updateShort);
+	return MTPDupdateShortView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > MTPDupdatesCombinedView::vupdates() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDupdatesCombinedView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDupdatesCombinedView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPint MTPDupdatesCombinedView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdatesCombinedView::vseq_start() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdatesCombinedView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdatesCombinedView MTPupdatesView::c_updatesCombined() const {
+	if (_type != mtpc_updatesCombined) throw mtpErrorWrongTypeId(_type, mtpc_updatesCombined);
+	return MTPDupdatesCombinedView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > > MTPDupdatesView::vupdates() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDupdatesView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDupdatesView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPint MTPDupdatesView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDupdatesView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDupdatesView MTPupdatesView::c_updates() const {
+	if (_type != mtpc_updates) throw mtpErrorWrongTypeId(_type, mtpc_updates);
+	return MTPDupdatesView(_from, _end);
+}
+
+inline MTPupdates MTPupdatesView::read() const {
+	const mtpPrime *from = _from;
+	return MTPupdates(from, _end, _type);
+}
+
+inline void MTPupdatesView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_updatesTooLong: break;
+		case mtpc_updateShortMessage:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateShortChatMessage:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updateShort:
+			MTPBoxedView<MTPupdateView>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updatesCombined:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_updates:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPupdateView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPupdatesView");
+	}
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > > MTPDphotos_photosView::vphotos() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDphotos_photosView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDphotos_photosView MTPphotos_photosView::c_photos_photos() const {
+	if (_type != mtpc_photos_photos) throw mtpErrorWrongTypeId(_type, mtpc_photos_photos);
+	return MTPDphotos_photosView(_from, _end);
+}
+
+inline MTPint MTPDphotos_photosSliceView::vcount() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > > MTPDphotos_photosSliceView::vphotos() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDphotos_photosSliceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDphotos_photosSliceView MTPphotos_photosView::c_photos_photosSlice() const {
+	if (_type != mtpc_photos_photosSlice) throw mtpErrorWrongTypeId(_type, mtpc_photos_photosSlice);
+	return MTPDphotos_photosSliceView(_from, _end);
+}
+
+inline MTPphotos_photos MTPphotos_photosView::read() const {
+	const mtpPrime *from = _from;
+	return MTPphotos_photos(from, _end, _type);
+}
+
+inline void MTPphotos_photosView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_photos_photos:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		case mtpc_photos_photosSlice:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPphotoView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPphotos_photosView");
+	}
+}
+
+inline MTPBoxedView<MTPphotoView> MTPDphotos_photoView::vphoto() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPphotoView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDphotos_photoView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDphotos_photoView MTPphotos_photoView::c_photos_photo() const {
+	return MTPDphotos_photoView(_from, _end);
+}
+
+inline MTPphotos_photo MTPphotos_photoView::read() const {
+	const mtpPrime *from = _from;
+	return MTPphotos_photo(from, _end, _type);
+}
+
+inline void MTPphotos_photoView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_photos_photo) throw mtpErrorUnexpected(cons, "MTPphotos_photoView");
+	MTPBoxedView<MTPphotoView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPstorage_fileTypeView> MTPDupload_fileView::vtype() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPstorage_fileTypeView>(from, end);
+}
+
+inline MTPint MTPDupload_fileView::vmtime() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPstorage_fileTypeView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDupload_fileView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPstorage_fileTypeView>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDupload_fileView MTPupload_fileView::c_upload_file() const {
+	return MTPDupload_fileView(_from, _end);
+}
+
+inline MTPupload_file MTPupload_fileView::read() const {
+	const mtpPrime *from = _from;
+	return MTPupload_file(from, _end, _type);
+}
+
+inline void MTPupload_fileView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_upload_file) throw mtpErrorUnexpected(cons, "MTPupload_fileView");
+	MTPBoxedView<MTPstorage_fileTypeView>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+}
+
+inline MTPint MTPDdcOptionView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDdcOptionView::vhostname() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDdcOptionView::vip_address() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDdcOptionView::vport() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDdcOptionView MTPdcOptionView::c_dcOption() const {
+	return MTPDdcOptionView(_from, _end);
+}
+
+inline MTPdcOption MTPdcOptionView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdcOption(from, _end, _type);
+}
+
+inline void MTPdcOptionView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_dcOption) throw mtpErrorUnexpected(cons, "MTPdcOptionView");
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDconfigView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDconfigView::vtest_mode() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPint MTPDconfigView::vthis_dc() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > > MTPDconfigView::vdc_options() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > >(from, end);
+}
+
+inline MTPint MTPDconfigView::vchat_size_max() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDconfigView::vbroadcast_size_max() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDconfigView MTPconfigView::c_config() const {
+	return MTPDconfigView(_from, _end);
+}
+
+inline MTPconfig MTPconfigView::read() const {
+	const mtpPrime *from = _from;
+	return MTPconfig(from, _end, _type);
+}
+
+inline void MTPconfigView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_config) throw mtpErrorUnexpected(cons, "MTPconfigView");
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPdcOptionView> > >::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPstring MTPDnearestDcView::vcountry() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDnearestDcView::vthis_dc() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDnearestDcView::vnearest_dc() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDnearestDcView MTPnearestDcView::c_nearestDc() const {
+	return MTPDnearestDcView(_from, _end);
+}
+
+inline MTPnearestDc MTPnearestDcView::read() const {
+	const mtpPrime *from = _from;
+	return MTPnearestDc(from, _end, _type);
+}
+
+inline void MTPnearestDcView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_nearestDc) throw mtpErrorUnexpected(cons, "MTPnearestDcView");
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPint MTPDhelp_appUpdateView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPbool> MTPDhelp_appUpdateView::vcritical() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPbool>(from, end);
+}
+
+inline MTPstring MTPDhelp_appUpdateView::vurl() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDhelp_appUpdateView::vtext() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPbool>::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPDhelp_appUpdateView MTPhelp_appUpdateView::c_help_appUpdate() const {
+	if (_type != mtpc_help_appUpdate) throw mtpErrorWrongTypeId(_type, mtpc_help_appUpdate);
+	return MTPDhelp_appUpdateView(_from, _end);
+}
+
+inline MTPhelp_appUpdate MTPhelp_appUpdateView::read() const {
+	const mtpPrime *from = _from;
+	return MTPhelp_appUpdate(from, _end, _type);
+}
+
+inline void MTPhelp_appUpdateView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_help_appUpdate:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPbool>::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+		break;
+		case mtpc_help_noAppUpdate: break;
+		default: throw mtpErrorUnexpected(cons, "MTPhelp_appUpdateView");
+	}
+}
+
+inline MTPstring MTPDhelp_inviteTextView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPDhelp_inviteTextView MTPhelp_inviteTextView::c_help_inviteText() const {
+	return MTPDhelp_inviteTextView(_from, _end);
+}
+
+inline MTPhelp_inviteText MTPhelp_inviteTextView::read() const {
+	const mtpPrime *from = _from;
+	return MTPhelp_inviteText(from, _end, _type);
+}
+
+inline void MTPhelp_inviteTextView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_help_inviteText) throw mtpErrorUnexpected(cons, "MTPhelp_inviteTextView");
+	MTPstring::skip(from, end);
+}
+
+inline MTPint MTPDinputGeoChatView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDinputGeoChatView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputGeoChatView MTPinputGeoChatView::c_inputGeoChat() const {
+	return MTPDinputGeoChatView(_from, _end);
+}
+
+inline MTPinputGeoChat MTPinputGeoChatView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputGeoChat(from, _end, _type);
+}
+
+inline void MTPinputGeoChatView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputGeoChat) throw mtpErrorUnexpected(cons, "MTPinputGeoChatView");
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageEmptyView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDgeoChatMessageEmptyView MTPgeoChatMessageView::c_geoChatMessageEmpty() const {
+	if (_type != mtpc_geoChatMessageEmpty) throw mtpErrorWrongTypeId(_type, mtpc_geoChatMessageEmpty);
+	return MTPDgeoChatMessageEmptyView(_from, _end);
+}
+
+inline MTPint MTPDgeoChatMessageView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDgeoChatMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPmessageMediaView> MTPDgeoChatMessageView::vmedia() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPmessageMediaView>(from, end);
+}
+
+inline MTPDgeoChatMessageView MTPgeoChatMessageView::c_geoChatMessage() const {
+	if (_type != mtpc_geoChatMessage) throw mtpErrorWrongTypeId(_type, mtpc_geoChatMessage);
+	return MTPDgeoChatMessageView(_from, _end);
+}
+
+inline MTPint MTPDgeoChatMessageServiceView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageServiceView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageServiceView::vfrom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDgeoChatMessageServiceView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPmessageActionView> MTPDgeoChatMessageServiceView::vaction() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPmessageActionView>(from, end);
+}
+
+inline MTPDgeoChatMessageServiceView MTPgeoChatMessageView::c_geoChatMessageService() const {
+	if (_type != mtpc_geoChatMessageService) throw mtpErrorWrongTypeId(_type, mtpc_geoChatMessageService);
+	return MTPDgeoChatMessageServiceView(_from, _end);
+}
+
+inline MTPgeoChatMessage MTPgeoChatMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPgeoChatMessage(from, _end, _type);
+}
+
+inline void MTPgeoChatMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_geoChatMessageEmpty:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_geoChatMessage:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPmessageMediaView>::skip(from, end);
+		break;
+		case mtpc_geoChatMessageService:
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPmessageActionView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPgeoChatMessageView");
+	}
+}
+
+inline MTPBoxedView<MTPgeoChatMessageView> MTPDgeochats_statedMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPgeoChatMessageView>(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDgeochats_statedMessageView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPgeoChatMessageView>::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDgeochats_statedMessageView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPgeoChatMessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPint MTPDgeochats_statedMessageView::vseq() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPgeoChatMessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDgeochats_statedMessageView MTPgeochats_statedMessageView::c_geochats_statedMessage() const {
+	return MTPDgeochats_statedMessageView(_from, _end);
+}
+
+inline MTPgeochats_statedMessage MTPgeochats_statedMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPgeochats_statedMessage(from, _end, _type);
+}
+
+inline void MTPgeochats_statedMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_geochats_statedMessage) throw mtpErrorUnexpected(cons, "MTPgeochats_statedMessageView");
+	MTPBoxedView<MTPgeoChatMessageView>::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+	MTPint::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > > MTPDgeochats_locatedView::vresults() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > > MTPDgeochats_locatedView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDgeochats_locatedView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDgeochats_locatedView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDgeochats_locatedView MTPgeochats_locatedView::c_geochats_located() const {
+	return MTPDgeochats_locatedView(_from, _end);
+}
+
+inline MTPgeochats_located MTPgeochats_locatedView::read() const {
+	const mtpPrime *from = _from;
+	return MTPgeochats_located(from, _end, _type);
+}
+
+inline void MTPgeochats_locatedView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_geochats_located) throw mtpErrorUnexpected(cons, "MTPgeochats_locatedView");
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatLocatedView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > > MTPDgeochats_messagesView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDgeochats_messagesView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDgeochats_messagesView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDgeochats_messagesView MTPgeochats_messagesView::c_geochats_messages() const {
+	if (_type != mtpc_geochats_messages) throw mtpErrorWrongTypeId(_type, mtpc_geochats_messages);
+	return MTPDgeochats_messagesView(_from, _end);
+}
+
+inline MTPint MTPDgeochats_messagesSliceView::vcount() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > > MTPDgeochats_messagesSliceView::vmessages() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > > MTPDgeochats_messagesSliceView::vchats() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >(from, end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > > MTPDgeochats_messagesSliceView::vusers() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+	MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+	return MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >(from, end);
+}
+
+inline MTPDgeochats_messagesSliceView MTPgeochats_messagesView::c_geochats_messagesSlice() const {
+	if (_type != mtpc_geochats_messagesSlice) throw mtpErrorWrongTypeId(_type, mtpc_geochats_messagesSlice);
+	return MTPDgeochats_messagesSliceView(_from, _end);
+}
+
+inline MTPgeochats_messages MTPgeochats_messagesView::read() const {
+	const mtpPrime *from = _from;
+	return MTPgeochats_messages(from, _end, _type);
+}
+
+inline void MTPgeochats_messagesView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_geochats_messages:
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		case mtpc_geochats_messagesSlice:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPgeoChatMessageView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPchatView> > >::skip(from, end);
+			MTPBoxedView<MTPvectorView<MTPBoxedView<MTPuserView> > >::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPgeochats_messagesView");
+	}
+}
+
+inline MTPint MTPDencryptedChatEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDencryptedChatEmptyView MTPencryptedChatView::c_encryptedChatEmpty() const {
+	if (_type != mtpc_encryptedChatEmpty) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatEmpty);
+	return MTPDencryptedChatEmptyView(_from, _end);
+}
+
+inline MTPint MTPDencryptedChatWaitingView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDencryptedChatWaitingView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDencryptedChatWaitingView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedChatWaitingView::vadmin_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedChatWaitingView::vparticipant_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDencryptedChatWaitingView MTPencryptedChatView::c_encryptedChatWaiting() const {
+	if (_type != mtpc_encryptedChatWaiting) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatWaiting);
+	return MTPDencryptedChatWaitingView(_from, _end);
+}
+
+inline MTPint MTPDencryptedChatRequestedView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDencryptedChatRequestedView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDencryptedChatRequestedView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedChatRequestedView::vadmin_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedChatRequestedView::vparticipant_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDencryptedChatRequestedView::vg_a() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDencryptedChatRequestedView MTPencryptedChatView::c_encryptedChatRequested() const {
+	if (_type != mtpc_encryptedChatRequested) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatRequested);
+	return MTPDencryptedChatRequestedView(_from, _end);
+}
+
+inline MTPint MTPDencryptedChatView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDencryptedChatView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDencryptedChatView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedChatView::vadmin_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedChatView::vparticipant_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDencryptedChatView::vg_a_or_b() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPlong MTPDencryptedChatView::vkey_fingerprint() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDencryptedChatView MTPencryptedChatView::c_encryptedChat() const {
+	if (_type != mtpc_encryptedChat) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChat);
+	return MTPDencryptedChatView(_from, _end);
+}
+
+inline MTPint MTPDencryptedChatDiscardedView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDencryptedChatDiscardedView MTPencryptedChatView::c_encryptedChatDiscarded() const {
+	if (_type != mtpc_encryptedChatDiscarded) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatDiscarded);
+	return MTPDencryptedChatDiscardedView(_from, _end);
+}
+
+inline MTPencryptedChat MTPencryptedChatView::read() const {
+	const mtpPrime *from = _from;
+	return MTPencryptedChat(from, _end, _type);
+}
+
+inline void MTPencryptedChatView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_encryptedChatEmpty:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_encryptedChatWaiting:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_encryptedChatRequested:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		case mtpc_encryptedChat:
+			MTPint::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_encryptedChatDiscarded:
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPencryptedChatView");
+	}
+}
+
+inline MTPint MTPDinputEncryptedChatView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPlong MTPDinputEncryptedChatView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputEncryptedChatView MTPinputEncryptedChatView::c_inputEncryptedChat() const {
+	return MTPDinputEncryptedChatView(_from, _end);
+}
+
+inline MTPinputEncryptedChat MTPinputEncryptedChatView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputEncryptedChat(from, _end, _type);
+}
+
+inline void MTPinputEncryptedChatView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputEncryptedChat) throw mtpErrorUnexpected(cons, "MTPinputEncryptedChatView");
+	MTPint::skip(from, end);
+	MTPlong::skip(from, end);
+}
+
+inline MTPlong MTPDencryptedFileView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDencryptedFileView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDencryptedFileView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedFileView::vdc_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedFileView::vkey_fingerprint() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDencryptedFileView MTPencryptedFileView::c_encryptedFile() const {
+	if (_type != mtpc_encryptedFile) throw mtpErrorWrongTypeId(_type, mtpc_encryptedFile);
+	return MTPDencryptedFileView(_from, _end);
+}
+
+inline MTPencryptedFile MTPencryptedFileView::read() const {
+	const mtpPrime *from = _from;
+	return MTPencryptedFile(from, _end, _type);
+}
+
+inline void MTPencryptedFileView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_encryptedFileEmpty: break;
+		case mtpc_encryptedFile:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPencryptedFileView");
+	}
+}
+
+inline MTPlong MTPDinputEncryptedFileUploadedView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDinputEncryptedFileUploadedView::vparts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDinputEncryptedFileUploadedView::vmd5_checksum() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDinputEncryptedFileUploadedView::vkey_fingerprint() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDinputEncryptedFileUploadedView MTPinputEncryptedFileView::c_inputEncryptedFileUploaded() const {
+	if (_type != mtpc_inputEncryptedFileUploaded) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFileUploaded);
+	return MTPDinputEncryptedFileUploadedView(_from, _end);
+}
+
+inline MTPlong MTPDinputEncryptedFileView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputEncryptedFileView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputEncryptedFileView MTPinputEncryptedFileView::c_inputEncryptedFile() const {
+	if (_type != mtpc_inputEncryptedFile) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFile);
+	return MTPDinputEncryptedFileView(_from, _end);
+}
+
+inline MTPlong MTPDinputEncryptedFileBigUploadedView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDinputEncryptedFileBigUploadedView::vparts() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDinputEncryptedFileBigUploadedView::vkey_fingerprint() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDinputEncryptedFileBigUploadedView MTPinputEncryptedFileView::c_inputEncryptedFileBigUploaded() const {
+	if (_type != mtpc_inputEncryptedFileBigUploaded) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFileBigUploaded);
+	return MTPDinputEncryptedFileBigUploadedView(_from, _end);
+}
+
+inline MTPinputEncryptedFile MTPinputEncryptedFileView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputEncryptedFile(from, _end, _type);
+}
+
+inline void MTPinputEncryptedFileView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputEncryptedFileEmpty: break;
+		case mtpc_inputEncryptedFileUploaded:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_inputEncryptedFile:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_inputEncryptedFileBigUploaded:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputEncryptedFileView");
+	}
+}
+
+inline MTPlong MTPDencryptedMessageView::vrandom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDencryptedMessageView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedMessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDencryptedMessageView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPBoxedView<MTPencryptedFileView> MTPDencryptedMessageView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPBoxedView<MTPencryptedFileView>(from, end);
+}
+
+inline MTPDencryptedMessageView MTPencryptedMessageView::c_encryptedMessage() const {
+	if (_type != mtpc_encryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_encryptedMessage);
+	return MTPDencryptedMessageView(_from, _end);
+}
+
+inline MTPlong MTPDencryptedMessageServiceView::vrandom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDencryptedMessageServiceView::vchat_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDencryptedMessageServiceView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDencryptedMessageServiceView::vbytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDencryptedMessageServiceView MTPencryptedMessageView::c_encryptedMessageService() const {
+	if (_type != mtpc_encryptedMessageService) throw mtpErrorWrongTypeId(_type, mtpc_encryptedMessageService);
+	return MTPDencryptedMessageServiceView(_from, _end);
+}
+
+inline MTPencryptedMessage MTPencryptedMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPencryptedMessage(from, _end, _type);
+}
+
+inline void MTPencryptedMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_encryptedMessage:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPBoxedView<MTPencryptedFileView>::skip(from, end);
+		break;
+		case mtpc_encryptedMessageService:
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPencryptedMessageView");
+	}
+}
+
+inline MTPint MTPDdecryptedMessageLayerView::vlayer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPdecryptedMessageView> MTPDdecryptedMessageLayerView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPdecryptedMessageView>(from, end);
+}
+
+inline MTPDdecryptedMessageLayerView MTPdecryptedMessageLayerView::c_decryptedMessageLayer() const {
+	return MTPDdecryptedMessageLayerView(_from, _end);
+}
+
+inline MTPdecryptedMessageLayer MTPdecryptedMessageLayerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdecryptedMessageLayer(from, _end, _type);
+}
+
+inline void MTPdecryptedMessageLayerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_decryptedMessageLayer) throw mtpErrorUnexpected(cons, "MTPdecryptedMessageLayerView");
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPdecryptedMessageView>::skip(from, end);
+}
+
+inline MTPlong MTPDdecryptedMessageView::vrandom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageView::vrandom_bytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageView::vmessage() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPdecryptedMessageMediaView> MTPDdecryptedMessageView::vmedia() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPbytes::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPdecryptedMessageMediaView>(from, end);
+}
+
+inline MTPDdecryptedMessageView MTPdecryptedMessageView::c_decryptedMessage() const {
+	if (_type != mtpc_decryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessage);
+	return MTPDdecryptedMessageView(_from, _end);
+}
+
+inline MTPlong MTPDdecryptedMessageServiceView::vrandom_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageServiceView::vrandom_bytes() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPBoxedView<MTPdecryptedMessageActionView> MTPDdecryptedMessageServiceView::vaction() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPBoxedView<MTPdecryptedMessageActionView>(from, end);
+}
+
+inline MTPDdecryptedMessageServiceView MTPdecryptedMessageView::c_decryptedMessageService() const {
+	if (_type != mtpc_decryptedMessageService) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageService);
+	return MTPDdecryptedMessageServiceView(_from, _end);
+}
+
+inline MTPdecryptedMessage MTPdecryptedMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdecryptedMessage(from, _end, _type);
+}
+
+inline void MTPdecryptedMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_decryptedMessage:
+			MTPlong::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPBoxedView<MTPdecryptedMessageMediaView>::skip(from, end);
+		break;
+		case mtpc_decryptedMessageService:
+			MTPlong::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPBoxedView<MTPdecryptedMessageActionView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPdecryptedMessageView");
+	}
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaPhotoView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPbytes(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaPhotoView::vthumb_w() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaPhotoView::vthumb_h() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaPhotoView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaPhotoView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaPhotoView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaPhotoView::vkey() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaPhotoView::viv() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDdecryptedMessageMediaPhotoView MTPdecryptedMessageMediaView::c_decryptedMessageMediaPhoto() const {
+	if (_type != mtpc_decryptedMessageMediaPhoto) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageMediaPhoto);
+	return MTPDdecryptedMessageMediaPhotoView(_from, _end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaVideoView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPbytes(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaVideoView::vthumb_w() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaVideoView::vthumb_h() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaVideoView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaVideoView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaVideoView::vw() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaVideoView::vh() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaVideoView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaVideoView::vkey() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaVideoView::viv() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDdecryptedMessageMediaVideoView MTPdecryptedMessageMediaView::c_decryptedMessageMediaVideo() const {
+	if (_type != mtpc_decryptedMessageMediaVideo) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageMediaVideo);
+	return MTPDdecryptedMessageMediaVideoView(_from, _end);
+}
+
+inline MTPdouble MTPDdecryptedMessageMediaGeoPointView::vlat() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPdouble(from, end);
+}
+
+inline MTPdouble MTPDdecryptedMessageMediaGeoPointView::vlong() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPdouble::skip(from, end);
+	return MTPdouble(from, end);
+}
+
+inline MTPDdecryptedMessageMediaGeoPointView MTPdecryptedMessageMediaView::c_decryptedMessageMediaGeoPoint() const {
+	if (_type != mtpc_decryptedMessageMediaGeoPoint) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageMediaGeoPoint);
+	return MTPDdecryptedMessageMediaGeoPointView(_from, _end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaContactView::vphone_number() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaContactView::vfirst_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaContactView::vlast_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaContactView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDdecryptedMessageMediaContactView MTPdecryptedMessageMediaView::c_decryptedMessageMediaContact() const {
+	if (_type != mtpc_decryptedMessageMediaContact) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageMediaContact);
+	return MTPDdecryptedMessageMediaContactView(_from, _end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaDocumentView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPbytes(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaDocumentView::vthumb_w() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaDocumentView::vthumb_h() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaDocumentView::vfile_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaDocumentView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaDocumentView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaDocumentView::vkey() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaDocumentView::viv() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDdecryptedMessageMediaDocumentView MTPdecryptedMessageMediaView::c_decryptedMessageMediaDocument() const {
+	if (_type != mtpc_decryptedMessageMediaDocument) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageMediaDocument);
+	return MTPDdecryptedMessageMediaDocumentView(_from, _end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaAudioView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDdecryptedMessageMediaAudioView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDdecryptedMessageMediaAudioView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaAudioView::vkey() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPbytes MTPDdecryptedMessageMediaAudioView::viv() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDdecryptedMessageMediaAudioView MTPdecryptedMessageMediaView::c_decryptedMessageMediaAudio() const {
+	if (_type != mtpc_decryptedMessageMediaAudio) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageMediaAudio);
+	return MTPDdecryptedMessageMediaAudioView(_from, _end);
+}
+
+inline MTPdecryptedMessageMedia MTPdecryptedMessageMediaView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdecryptedMessageMedia(from, _end, _type);
+}
+
+inline void MTPdecryptedMessageMediaView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_decryptedMessageMediaEmpty: break;
+		case mtpc_decryptedMessageMediaPhoto:
+			MTPbytes::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		case mtpc_decryptedMessageMediaVideo:
+			MTPbytes::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		case mtpc_decryptedMessageMediaGeoPoint:
+			MTPdouble::skip(from, end);
+			MTPdouble::skip(from, end);
+		break;
+		case mtpc_decryptedMessageMediaContact:
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		case mtpc_decryptedMessageMediaDocument:
+			MTPbytes::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		case mtpc_decryptedMessageMediaAudio:
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPdecryptedMessageMediaView");
+	}
+}
+
+inline MTPint MTPDdecryptedMessageActionSetMessageTTLView::vttl_seconds() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDdecryptedMessageActionSetMessageTTLView MTPdecryptedMessageActionView::c_decryptedMessageActionSetMessageTTL() const {
+	if (_type != mtpc_decryptedMessageActionSetMessageTTL) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageActionSetMessageTTL);
+	return MTPDdecryptedMessageActionSetMessageTTLView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDdecryptedMessageActionReadMessagesView::vrandom_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDdecryptedMessageActionReadMessagesView MTPdecryptedMessageActionView::c_decryptedMessageActionReadMessages() const {
+	if (_type != mtpc_decryptedMessageActionReadMessages) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageActionReadMessages);
+	return MTPDdecryptedMessageActionReadMessagesView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDdecryptedMessageActionDeleteMessagesView::vrandom_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDdecryptedMessageActionDeleteMessagesView MTPdecryptedMessageActionView::c_decryptedMessageActionDeleteMessages() const {
+	if (_type != mtpc_decryptedMessageActionDeleteMessages) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageActionDeleteMessages);
+	return MTPDdecryptedMessageActionDeleteMessagesView(_from, _end);
+}
+
+inline MTPBoxedView<MTPvectorView<MTPlong > > MTPDdecryptedMessageActionScreenshotMessagesView::vrandom_ids() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPvectorView<MTPlong > >(from, end);
+}
+
+inline MTPDdecryptedMessageActionScreenshotMessagesView MTPdecryptedMessageActionView::c_decryptedMessageActionScreenshotMessages() const {
+	if (_type != mtpc_decryptedMessageActionScreenshotMessages) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageActionScreenshotMessages);
+	return MTPDdecryptedMessageActionScreenshotMessagesView(_from, _end);
+}
+
+inline MTPint MTPDdecryptedMessageActionNotifyLayerView::vlayer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDdecryptedMessageActionNotifyLayerView MTPdecryptedMessageActionView::c_decryptedMessageActionNotifyLayer() const {
+	if (_type != mtpc_decryptedMessageActionNotifyLayer) throw mtpErrorWrongTypeId(_type, mtpc_decryptedMessageActionNotifyLayer);
+	return MTPDdecryptedMessageActionNotifyLayerView(_from, _end);
+}
+
+inline MTPdecryptedMessageAction MTPdecryptedMessageActionView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdecryptedMessageAction(from, _end, _type);
+}
+
+inline void MTPdecryptedMessageActionView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_decryptedMessageActionSetMessageTTL:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_decryptedMessageActionReadMessages:
+			MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+		break;
+		case mtpc_decryptedMessageActionDeleteMessages:
+			MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+		break;
+		case mtpc_decryptedMessageActionScreenshotMessages:
+			MTPBoxedView<MTPvectorView<MTPlong > >::skip(from, end);
+		break;
+		case mtpc_decryptedMessageActionFlushHistory: break;
+		case mtpc_decryptedMessageActionNotifyLayer:
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPdecryptedMessageActionView");
+	}
+}
+
+inline MTPbytes MTPDmessages_dhConfigNotModifiedView::vrandom() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPbytes(from, end);
+}
+
+inline MTPDmessages_dhConfigNotModifiedView MTPmessages_dhConfigView::c_messages_dhConfigNotModified() const {
+	if (_type != mtpc_messages_dhConfigNotModified) throw mtpErrorWrongTypeId(_type, mtpc_messages_dhConfigNotModified);
+	return MTPDmessages_dhConfigNotModifiedView(_from, _end);
+}
+
+inline MTPint MTPDmessages_dhConfigView::vg() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDmessages_dhConfigView::vp() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPint MTPDmessages_dhConfigView::vversion() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPbytes MTPDmessages_dhConfigView::vrandom() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	MTPbytes::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPbytes(from, end);
+}
+
+inline MTPDmessages_dhConfigView MTPmessages_dhConfigView::c_messages_dhConfig() const {
+	if (_type != mtpc_messages_dhConfig) throw mtpErrorWrongTypeId(_type, mtpc_messages_dhConfig);
+	return MTPDmessages_dhConfigView(_from, _end);
+}
+
+inline MTPmessages_dhConfig MTPmessages_dhConfigView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_dhConfig(from, _end, _type);
+}
+
+inline void MTPmessages_dhConfigView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_dhConfigNotModified:
+			MTPbytes::skip(from, end);
+		break;
+		case mtpc_messages_dhConfig:
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+			MTPint::skip(from, end);
+			MTPbytes::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_dhConfigView");
+	}
+}
+
+inline MTPint MTPDmessages_sentEncryptedMessageView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPDmessages_sentEncryptedMessageView MTPmessages_sentEncryptedMessageView::c_messages_sentEncryptedMessage() const {
+	if (_type != mtpc_messages_sentEncryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentEncryptedMessage);
+	return MTPDmessages_sentEncryptedMessageView(_from, _end);
+}
+
+inline MTPint MTPDmessages_sentEncryptedFileView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPencryptedFileView> MTPDmessages_sentEncryptedFileView::vfile() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPencryptedFileView>(from, end);
+}
+
+inline MTPDmessages_sentEncryptedFileView MTPmessages_sentEncryptedMessageView::c_messages_sentEncryptedFile() const {
+	if (_type != mtpc_messages_sentEncryptedFile) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentEncryptedFile);
+	return MTPDmessages_sentEncryptedFileView(_from, _end);
+}
+
+inline MTPmessages_sentEncryptedMessage MTPmessages_sentEncryptedMessageView::read() const {
+	const mtpPrime *from = _from;
+	return MTPmessages_sentEncryptedMessage(from, _end, _type);
+}
+
+inline void MTPmessages_sentEncryptedMessageView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_sentEncryptedMessage:
+			MTPint::skip(from, end);
+		break;
+		case mtpc_messages_sentEncryptedFile:
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPencryptedFileView>::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPmessages_sentEncryptedMessageView");
+	}
+}
+
+inline MTPlong MTPDinputAudioView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputAudioView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputAudioView MTPinputAudioView::c_inputAudio() const {
+	if (_type != mtpc_inputAudio) throw mtpErrorWrongTypeId(_type, mtpc_inputAudio);
+	return MTPDinputAudioView(_from, _end);
+}
+
+inline MTPinputAudio MTPinputAudioView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputAudio(from, _end, _type);
+}
+
+inline void MTPinputAudioView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputAudioEmpty: break;
+		case mtpc_inputAudio:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputAudioView");
+	}
+}
+
+inline MTPlong MTPDinputDocumentView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDinputDocumentView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPDinputDocumentView MTPinputDocumentView::c_inputDocument() const {
+	if (_type != mtpc_inputDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputDocument);
+	return MTPDinputDocumentView(_from, _end);
+}
+
+inline MTPinputDocument MTPinputDocumentView::read() const {
+	const mtpPrime *from = _from;
+	return MTPinputDocument(from, _end, _type);
+}
+
+inline void MTPinputDocumentView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputDocumentEmpty: break;
+		case mtpc_inputDocument:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPinputDocumentView");
+	}
+}
+
+inline MTPlong MTPDaudioEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPDaudioEmptyView MTPaudioView::c_audioEmpty() const {
+	if (_type != mtpc_audioEmpty) throw mtpErrorWrongTypeId(_type, mtpc_audioEmpty);
+	return MTPDaudioEmptyView(_from, _end);
+}
+
+inline MTPlong MTPDaudioView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDaudioView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDaudioView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDaudioView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDaudioView::vduration() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDaudioView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDaudioView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDaudioView::vdc_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDaudioView MTPaudioView::c_audio() const {
+	if (_type != mtpc_audio) throw mtpErrorWrongTypeId(_type, mtpc_audio);
+	return MTPDaudioView(_from, _end);
+}
+
+inline MTPaudio MTPaudioView::read() const {
+	const mtpPrime *from = _from;
+	return MTPaudio(from, _end, _type);
+}
+
+inline void MTPaudioView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_audioEmpty:
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_audio:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPaudioView");
+	}
+}
+
+inline MTPlong MTPDdocumentEmptyView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPDdocumentEmptyView MTPdocumentView::c_documentEmpty() const {
+	if (_type != mtpc_documentEmpty) throw mtpErrorWrongTypeId(_type, mtpc_documentEmpty);
+	return MTPDdocumentEmptyView(_from, _end);
+}
+
+inline MTPlong MTPDdocumentView::vid() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPlong(from, end);
+}
+
+inline MTPlong MTPDdocumentView::vaccess_hash() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	return MTPlong(from, end);
+}
+
+inline MTPint MTPDdocumentView::vuser_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPint MTPDdocumentView::vdate() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPstring MTPDdocumentView::vfile_name() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPstring MTPDdocumentView::vmime_type() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPstring(from, end);
+}
+
+inline MTPint MTPDdocumentView::vsize() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPBoxedView<MTPphotoSizeView> MTPDdocumentView::vthumb() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	return MTPBoxedView<MTPphotoSizeView>(from, end);
+}
+
+inline MTPint MTPDdocumentView::vdc_id() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPlong::skip(from, end);
+	MTPlong::skip(from, end);
+	MTPint::skip(from, end);
+	MTPint::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPstring::skip(from, end);
+	MTPint::skip(from, end);
+	MTPBoxedView<MTPphotoSizeView>::skip(from, end);
+	return MTPint(from, end);
+}
+
+inline MTPDdocumentView MTPdocumentView::c_document() const {
+	if (_type != mtpc_document) throw mtpErrorWrongTypeId(_type, mtpc_document);
+	return MTPDdocumentView(_from, _end);
+}
+
+inline MTPdocument MTPdocumentView::read() const {
+	const mtpPrime *from = _from;
+	return MTPdocument(from, _end, _type);
+}
+
+inline void MTPdocumentView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_documentEmpty:
+			MTPlong::skip(from, end);
+		break;
+		case mtpc_document:
+			MTPlong::skip(from, end);
+			MTPlong::skip(from, end);
+			MTPint::skip(from, end);
+			MTPint::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPstring::skip(from, end);
+			MTPint::skip(from, end);
+			MTPBoxedView<MTPphotoSizeView>::skip(from, end);
+			MTPint::skip(from, end);
+		break;
+		default: throw mtpErrorUnexpected(cons, "MTPdocumentView");
+	}
+}
+
+inline MTPstring MTPDhelp_supportView::vphone_number() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPstring(from, end);
+}
+
+inline MTPBoxedView<MTPuserView> MTPDhelp_supportView::vuser() const {
+	const mtpPrime *from = _from, *end = _end;
+	MTPstring::skip(from, end);
+	return MTPBoxedView<MTPuserView>(from, end);
+}
+
+inline MTPDhelp_supportView MTPhelp_supportView::c_help_support() const {
+	return MTPDhelp_supportView(_from, _end);
+}
+
+inline MTPhelp_support MTPhelp_supportView::read() const {
+	const mtpPrime *from = _from;
+	return MTPhelp_support(from, _end, _type);
+}
+
+inline void MTPhelp_supportView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_help_support) throw mtpErrorUnexpected(cons, "MTPhelp_supportView");
+	MTPstring::skip(from, end);
+	MTPBoxedView<MTPuserView>::skip(from, end);
+}
+
+inline MTPBoxedView<MTPpeerView> MTPDnotifyPeerView::vpeer() const {
+	const mtpPrime *from = _from, *end = _end;
+	return MTPBoxedView<MTPpeerView>(from, end);
+}
+
+inline MTPDnotifyPeerView MTPnotifyPeerView::c_notifyPeer() const {
+	if (_type != mtpc_notifyPeer) throw mtpErrorWrongTypeId(_type, mtpc_notifyPeer);
+	return MTPDnotifyPeerView(_from, _end);
+}
+
+inline MTPnotifyPeer MTPnotifyPeerView::read() const {
+	const mtpPrime *from = _from;
+	return MTPnotifyPeer(from, _end, _type);
+}
+
+inline void MTPnotifyPeerView::skip(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_notifyPeer:
+			MTPBoxedView<MTPpeerView>::skip(from, end);
+		break;
+		case mtpc_notifyUsers: break;
+		case mtpc_notifyChats: break;
+		case mtpc_notifyAll: break;
+		default: throw mtpErrorUnexpected(cons, "MTPnotifyPeerView");
+	}
+}
+
 // Human-readable text serialization
 #if (defined _DEBUG || defined _WITH_DEBUG)
 
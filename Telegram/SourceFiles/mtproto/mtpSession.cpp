@@ -21,26 +21,16 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 void MTPSessionData::clear() {
 	RPCCallbackClears clearCallbacks;
 	{
-		QReadLocker locker1(haveSentMutex()), locker2(toResendMutex()), locker3(haveReceivedMutex()), locker4(wereAckedMutex());
-		mtpResponseMap::const_iterator end = haveReceived.cend();
-		clearCallbacks.reserve(haveSent.size() + wereAcked.size());
+		QReadLocker locker1(haveSentMutex()), locker2(toResendMutex()), locker3(wereAckedMutex());
+		clearCallbacks.reserve(haveSent.size() + toResend.size() + wereAcked.size());
 		for (mtpRequestMap::const_iterator i = haveSent.cbegin(), e = haveSent.cend(); i != e; ++i) {
-			mtpRequestId requestId = i.value()->requestId;
-			if (haveReceived.find(requestId) == end) {
-				clearCallbacks.push_back(requestId);
-			}
+			clearCallbacks.push_back(i.value()->requestId);
 		}
 		for (mtpRequestIdsMap::const_iterator i = toResend.cbegin(), e = toResend.cend(); i != e; ++i) {
-			mtpRequestId requestId = i.value();
-			if (haveReceived.find(requestId) == end) {
-				clearCallbacks.push_back(requestId);
-			}
+			clearCallbacks.push_back(i.value());
 		}
 		for (mtpRequestIdsMap::const_iterator i = wereAcked.cbegin(), e = wereAcked.cend(); i != e; ++i) {
-			mtpRequestId requestId = i.value();
-			if (haveReceived.find(requestId) == end) {
-				clearCallbacks.push_back(requestId);
-			}
+			clearCallbacks.push_back(i.value());
 		}
 	}
 	{
@@ -59,11 +49,86 @@ void MTPSessionData::clear() {
 		QWriteLocker locker(receivedIdsMutex());
 		receivedIds.clear();
 	}
-	_mtp_internal::clearCallbacksDelayed(clearCallbacks);
+	if (!clearCallbacks.isEmpty()) { // cleared after all the responses that were already received are processed
+		ReceivedItem item;
+		item.clears = clearCallbacks;
+		queueReceived(item);
+	}
+}
+
+void MTPSessionData::queueReceived(const ReceivedItem &item) {
+	haveReceived.push(item);
+	if (!haveReceivedSignalled.fetchAndStoreOrdered(1)) {
+		DEBUG_LOG(("MTP Info: emitting needToReceive() - need to parse in another thread"));
+		emit _owner->needToReceive();
+	}
 }
 
+bool MTPSessionData::takeReceived(ReceivedItem &item) {
+	return haveReceived.pop(item);
+}
+
+bool MTPSessionData::useFutureSalt(int32 now) {
+	QWriteLocker locker(&lock);
+	int32 expired = 0;
+	while (expired < _futureSalts.size() && _futureSalts.at(expired).validUntil <= now) {
+		++expired;
+	}
+	if (expired) _futureSalts.remove(0, expired);
+
+	if (_futureSalts.isEmpty() || _futureSalts.front().validSince > now || _futureSalts.front().salt == _salt) return false;
+
+	DEBUG_LOG(("MTP Info: switching to future salt %1, valid until %2").arg(_futureSalts.front().salt).arg(_futureSalts.front().validUntil));
+	_salt = _futureSalts.front().salt;
+	return true;
+}
 
-MTProtoSession::MTProtoSession() : data(this), dcId(0), dc(0), msSendCall(0), msWait(0) {
+bool MTPSessionData::needFutureSalts(int32 now) const {
+	QReadLocker locker(&lock);
+	return _futureSalts.isEmpty() || _futureSalts.back().validUntil < now + MTPFutureSaltsRequestBefore;
+}
+
+void MTPSessionData::saveState(mtpSessionState &state) const {
+	QReadLocker locker(&lock);
+	state.keyId = authKey ? authKey->keyId() : 0;
+	state.session = _session;
+	state.salt = _salt;
+	state.messagesSent = _messagesSent;
+	state.futureSalts = _futureSalts;
+}
+
+void MTPSessionData::restoreState(const mtpSessionState &state) {
+	{
+		QWriteLocker locker(&lock);
+		DEBUG_LOG(("MTP Info: restoring server_session %1, salt %2, messages sent %3, future salts %4").arg(state.session).arg(state.salt).arg(state.messagesSent).arg(state.futureSalts.size()));
+		_session = state.session;
+		_salt = state.salt;
+		_messagesSent = state.messagesSent;
+		_futureSalts = state.futureSalts;
+	}
+	useFutureSalt(unixtime());
+}
+
+void MTPSessionData::rttSample(uint64 ms) {
+	QWriteLocker locker(&rttLock);
+	int64 rtt = qMax(int64(ms), int64(1));
+	if (!_srtt) {
+		_srtt = rtt;
+		_rttvar = rtt / 2;
+	} else {
+		_rttvar = (3 * _rttvar + qAbs(_srtt - rtt)) / 4;
+		_srtt = (7 * _srtt + rtt) / 8;
+	}
+}
+
+uint64 MTPSessionData::resendTimeout() const {
+	QReadLocker locker(&rttLock);
+	if (!_srtt) return MTPCheckResendTimeout;
+
+	return snap(uint64(_srtt + 4 * _rttvar), uint64(MTPResendTimeoutMin), uint64(MTPResendTimeoutMax));
+}
+
+MTProtoSession::MTProtoSession() : data(this), dcId(0), dc(0), msSendCall(0), msWait(0), msFutureSaltsRequest(0) {
 }
 
 void MTProtoSession::start(int32 dcenter, uint32 connects) {
@@ -80,12 +145,15 @@ void MTProtoSession::start(int32 dcenter, uint32 connects) {
 	msSendCall = msWait = 0;
 
 	connect(&timeouter, SIGNAL(timeout()), this, SLOT(checkRequestsByTimer()));
-	timeouter.start(1000);
+	connect(this, SIGNAL(needToCheckRequests(int)), this, SLOT(onNeedToCheckRequests(int)));
+	timeouter.setSingleShot(true);
+	timeouter.start(MTPCheckRequestsIntervalMax);
 
 	connect(&sender, SIGNAL(timeout()), this, SIGNAL(needToSend()));
 	connect(this, SIGNAL(startSendTimer(int)), &sender, SLOT(start(int)));
 	connect(this, SIGNAL(stopSendTimer()), &sender, SLOT(stop()));
 	connect(this, SIGNAL(needToSendAsync()), this, SIGNAL(needToSend()));
+	connect(this, SIGNAL(needToReceive()), this, SLOT(tryToReceive()), Qt::QueuedConnection);
 	sender.setSingleShot(true);
 
 	MTProtoDCMap &dcs(mtpDCMap());
@@ -115,6 +183,11 @@ void MTProtoSession::start(int32 dcenter, uint32 connects) {
 			ReadLockerAttempt lock(keyMutex());
 			data.setKey(lock ? dc->getKey() : mtpAuthKeyPtr(0));
 
+			mtpSessionState state;
+			if (data.getKey() && mtpRestoreSessionState(dcId, state) && state.keyId == data.getKey()->keyId()) {
+				data.restoreState(state); // the first request goes with a known salt, no bad_server_salt round-trip
+			}
+
 			connect(dc.data(), SIGNAL(authKeyCreated()), this, SLOT(authKeyCreatedForDC()));
 		}
 	}
@@ -131,14 +204,30 @@ void MTProtoSession::stop() {
 		connections.back()->stop();
 		connections.pop_back();
 	}
+	if (dcId && data.getKey()) {
+		mtpSessionState state;
+		data.saveState(state);
+		mtpSaveSessionState(dcId, state);
+	}
 }
 
 void MTProtoSession::checkRequestsByTimer() {
+	uint64 resendTimeout = data.resendTimeout(), resendWaiting = qMin(uint64(MTPCheckResendWaiting), resendTimeout / 4);
+
+	int32 now = unixtime();
+	data.useFutureSalt(now);
+	if (getState() == MTProtoConnection::Connected && data.needFutureSalts(now) && getms() >= msFutureSaltsRequest) {
+		DEBUG_LOG(("MTP Info: requesting future salts for dc %1").arg(dcId));
+		msFutureSaltsRequest = getms() + MTPFutureSaltsRequestRetry;
+		send(MTPGet_future_salts(MTP_int(MTPFutureSaltsCount)), RPCResponseHandler(), resendWaiting);
+	}
+
 	MTPMsgsStateReq stateRequest(MTP_msgs_state_req(MTP_vector<MTPlong>(0)));
 	QVector<MTPlong> &stateRequestIds(stateRequest._msgs_state_req().vmsg_ids._vector().v);
 
 	QVector<mtpMsgId> resendingIds;
 	QVector<mtpMsgId> removingIds; // remove very old (10 minutes) containers and resend requests
+	uint64 msNextCheck = 0; // closest resend timeout end among the requests that wait for ack
 
 	{
 		QReadLocker locker(data.haveSentMutex());
@@ -148,7 +237,7 @@ void MTProtoSession::checkRequestsByTimer() {
 		for (mtpRequestMap::iterator i = haveSent.begin(), e = haveSent.end(); i != e; ++i) {
 			mtpRequest &req(i.value());
 			if (req->msDate > 0) {
-				if (req->msDate + MTPCheckResendTimeout < ms) { // need to resend or check state
+				if (req->msDate + resendTimeout <= ms) { // need to resend or check state
 					if (mtpRequestData::messageSize(req) < MTPResendThreshold) { // resend
 						resendingIds.reserve(haveSentCount);
 						resendingIds.push_back(i.key());
@@ -156,7 +245,10 @@ void MTProtoSession::checkRequestsByTimer() {
 						req->msDate = ms;
 						stateRequestIds.reserve(haveSentCount);
 						stateRequestIds.push_back(MTP_long(i.key()));
+						if (!msNextCheck || ms + resendTimeout < msNextCheck) msNextCheck = ms + resendTimeout;
 					}
+				} else if (!msNextCheck || req->msDate + resendTimeout < msNextCheck) {
+					msNextCheck = req->msDate + resendTimeout;
 				}
 			} else if (unixtime() > (int32)(i.key() >> 32) + MTPContainerLives) {
 				removingIds.reserve(haveSentCount);
@@ -167,11 +259,11 @@ void MTProtoSession::checkRequestsByTimer() {
 
 	if (stateRequestIds.size()) {
 		DEBUG_LOG(("MTP Info: requesting state of msgs: %1").arg(logVectorLong(stateRequestIds)));
-		send(stateRequest, RPCResponseHandler(), MTPCheckResendWaiting);
+		send(stateRequest, RPCResponseHandler(), resendWaiting);
 	}
 	for (uint32 i = 0, l = resendingIds.size(); i < l; ++i) {
 		DEBUG_LOG(("MTP Info: resending request %1").arg(resendingIds[i]));
-		resend(resendingIds[i], MTPCheckResendWaiting);
+		resend(resendingIds[i], resendWaiting);
 	}
 	uint32 removingIdsCount = removingIds.size();
 	if (removingIdsCount) {
@@ -191,6 +283,15 @@ void MTProtoSession::checkRequestsByTimer() {
 		}
 		_mtp_internal::clearCallbacksDelayed(clearCallbacks);
 	}
+
+	uint64 ms = getms();
+	onNeedToCheckRequests((msNextCheck && msNextCheck < ms + MTPCheckRequestsIntervalMax) ? int(msNextCheck > ms ? msNextCheck - ms : 0) : int(MTPCheckRequestsIntervalMax));
+}
+
+void MTProtoSession::onNeedToCheckRequests(int msec) {
+	if (!timeouter.isActive() || timeouter.remainingTime() > msec) {
+		timeouter.start(msec);
+	}
 }
 
 void MTProtoSession::onConnectionStateChange(qint32 newState) {
@@ -202,13 +303,10 @@ void MTProtoSession::onResetDone() {
 }
 
 void MTProtoSession::cancel(mtpRequestId requestId) {
-	QWriteLocker locker(data.toSendMutex());
-	mtpPreRequestMap &toSend(data.toSendMap());
-	mtpPreRequestMap::iterator i = toSend.find(requestId);
-	if (i != toSend.end()) toSend.erase(i);
+	data.queueToSendCancel(requestId);
 }
 
-int32 MTProtoSession::requestState(mtpRequestId requestId) const {
+int32 MTProtoSession::requestState(mtpRequestId requestId) {
 	MTProtoConnections::const_iterator j = connections.cbegin(), e = connections.cend();
 	int32 result = MTP::RequestSent;
 	for (; j != e; ++j) {
@@ -230,14 +328,19 @@ int32 MTProtoSession::requestState(mtpRequestId requestId) const {
 	}
 	if (!requestId) return MTP::RequestSent;
 
-	QWriteLocker locker(data.toSendMutex());
-	const mtpPreRequestMap &toSend(data.toSendMap());
-	mtpPreRequestMap::const_iterator i = toSend.constFind(requestId);
-	if (i != toSend.cend()) {
+	if (!data.toSendMutex()->tryLockForRead()) { // some connection is sending right now, dont wait for it
+		return MTP::RequestSending;
+	}
+	const MTPSessionData &constData(data);
+	const mtpPreRequestMap &toSend(constData.toSendMap());
+	bool sending = (toSend.constFind(requestId) != toSend.cend());
+	data.toSendMutex()->unlock();
+
+	if (!sending && data.hasQueuedToSend()) { // the request may be still queued, the queue is taken in connection thread, not here
+		emit needToTakeQueued();
 		return MTP::RequestSending;
-	} else {
-		return MTP::RequestSent;
 	}
+	return sending ? MTP::RequestSending : MTP::RequestSent;
 }
 
 int32 MTProtoSession::getState() const {
@@ -300,6 +403,7 @@ mtpRequestId MTProtoSession::resend(mtpMsgId msgId, uint64 msCanWait, bool force
 		}
 		return 0xFFFFFFFF;
 	} else if (!mtpRequestData::isStateRequest(request)) {
+		_mtp_internal::statsResent(dcId, mtpRequestData::methodType(request));
 		request->msDate = forceContainer ? 0 : getms();
 		sendPrepared(request, msCanWait, false);
 		{
@@ -328,15 +432,13 @@ void MTProtoSession::resendAll() {
 }
 
 void MTProtoSession::sendPrepared(const mtpRequest &request, uint64 msCanWait, bool newRequest) { // returns true, if emit of needToSend() is needed
-	{
-		QWriteLocker locker(data.toSendMutex());
-		data.toSendMap().insert(request->requestId, request);
-
-		if (newRequest) {
-			*(mtpMsgId*)(request->data() + 4) = 0;
-			*(request->data() + 6) = 0;
-		}
+	if (newRequest) {
+		*(mtpMsgId*)(request->data() + 4) = 0;
+		*(request->data() + 6) = 0;
 	}
+	request->usQueued = getus();
+	data.queueToSend(request);
+	emit needToCheckRequests(int(msCanWait + data.resendTimeout())); // check for ack when its resend timeout ends
 
 	DEBUG_LOG(("MTP Info: added, requestId %1").arg(request->requestId));
 
@@ -411,23 +513,24 @@ int32 MTProtoSession::getDC() const {
 }
 
 void MTProtoSession::tryToReceive() {
-	while (true) {
-		mtpRequestId requestId;
-		mtpResponse response;
-		{
-			QWriteLocker locker(data.haveReceivedMutex());
-			mtpResponseMap &responses(data.haveReceivedMap());
-			mtpResponseMap::iterator i = responses.begin();
-			if (i == responses.end()) return;
-
-			requestId = i.key();
-			response = i.value();
-			responses.erase(i);
-		}
-		if (requestId <= 0) {
-			_mtp_internal::globalCallback(response.constData(), response.constData() + response.size());
+	data.startTakeReceived();
+
+	MTPSessionData::ReceivedItem item;
+	while (data.takeReceived(item)) {
+		if (!item.clears.isEmpty()) {
+			for (RPCCallbackClears::const_iterator i = item.clears.cbegin(), e = item.clears.cend(); i != e; ++i) {
+				_mtp_internal::clearCallbacks(i->requestId, i->errorCode);
+			}
+		} else if (item.requestId <= 0) {
+			uint64 usDispatch = getus();
+			_mtp_internal::globalCallback(item.response.constData(), item.response.constData() + item.response.size());
+			_mtp_internal::statsReceived(dcId, 0, item.response.size() * sizeof(mtpPrime), 0, item.usReceived ? (usDispatch - item.usReceived) : 0, getus() - usDispatch);
 		} else {
-			_mtp_internal::execCallback(requestId, response.constData(), response.constData() + response.size());
+			uint64 usSent = 0;
+			mtpTypeId method = _mtp_internal::requestStatsInfo(item.requestId, usSent); // before the callback removes the request
+			uint64 usDispatch = getus();
+			_mtp_internal::execCallback(item.requestId, item.response.constData(), item.response.constData() + item.response.size(), item.parsed);
+			_mtp_internal::statsReceived(dcId, method, item.response.size() * sizeof(mtpPrime), (usSent && usSent < item.usReceived) ? (item.usReceived - usSent) : 0, item.usReceived ? (usDispatch - item.usReceived) : 0, getus() - usDispatch);
 		}
 	}
 }
@@ -28,8 +28,8 @@ public:
 	
 	MTPSessionData(MTProtoSession *creator)
 	: _session(0), _salt(0)
-	, _messagesSent(0), fakeRequestId(-2000000000)
-	, _owner(creator), keyChecked(false) {
+	, _messagesSent(0)
+	, _owner(creator), keyChecked(false), _srtt(0), _rttvar(0), haveReceivedSignalled(0) {
 	}
 
 	void setSession(uint64 session) {
@@ -55,6 +55,19 @@ public:
 		return _salt;
 	}
 
+	void setFutureSalts(const mtpFutureSalts &salts) {
+		QWriteLocker locker(&lock);
+		_futureSalts = salts;
+	}
+	bool useFutureSalt(int32 now); // drops expired future salts and switches to the one valid now, returns true if the salt was changed
+	bool needFutureSalts(int32 now) const; // known future salts end in less than MTPFutureSaltsRequestBefore seconds
+
+	void saveState(mtpSessionState &state) const;
+	void restoreState(const mtpSessionState &state);
+
+	void rttSample(uint64 ms); // time from send till ack of the last sent request in a batch of acks (pong included)
+	uint64 resendTimeout() const; // after this time without ack we resend the request or ask for its state
+
 	const mtpAuthKeyPtr &getKey() const {
 		return authKey;
 	}
@@ -95,14 +108,31 @@ public:
 	QReadWriteLock *receivedIdsMutex() const {
 		return &receivedIdsLock;
 	}
-	QReadWriteLock *haveReceivedMutex() const {
-		return &haveReceivedLock;
-	}
 
-	mtpPreRequestMap &toSendMap() {
+	void queueToSend(const mtpRequest &request) { // lock-free, the request is moved to toSendMap() by the connection thread
+		toSendQueued.ref();
+		toSendQueue.push(ToSendItem(request));
+	}
+	void queueToSendCancel(mtpRequestId requestId) { // lock-free, the request is removed from toSendMap() by the connection thread
+		toSendQueued.ref();
+		toSendQueue.push(ToSendItem(mtpRequest(), requestId));
+	}
+	bool hasQueuedToSend() const {
+		return toSendQueued.load() > 0;
+	}
+	mtpPreRequestMap &toSendMap() { // must be locked for write by toSendMutex(), only in connection threads
+		ToSendItem item;
+		while (toSendQueue.pop(item)) {
+			if (item.request) {
+				toSend.insert(item.request->requestId, item.request);
+			} else {
+				toSend.remove(item.cancelRequestId);
+			}
+			toSendQueued.deref();
+		}
 		return toSend;
 	}
-	const mtpPreRequestMap &toSendMap() const {
+	const mtpPreRequestMap &toSendMap() const { // must be locked for read by toSendMutex(), queued requests are not taken here
 		return toSend;
 	}
 	mtpRequestMap &haveSentMap() {
@@ -129,20 +159,19 @@ public:
 	const mtpRequestIdsMap &wereAckedMap() const {
 		return wereAcked;
 	}
-	mtpResponseMap &haveReceivedMap() {
-		return haveReceived;
-	}
-	const mtpResponseMap &haveReceivedMap() const {
-		return haveReceived;
-	}
-
-	mtpRequestId nextFakeRequestId() { // must be locked by haveReceivedMutex()
-		if (haveReceived.isEmpty() || haveReceived.cbegin().key() > 0) {
-			fakeRequestId = -2000000000;
-		} else {
-			++fakeRequestId;
+	struct ReceivedItem {
+		ReceivedItem(mtpRequestId requestId = 0, const mtpResponse &response = mtpResponse()) : requestId(requestId), response(response), usReceived(response.isEmpty() ? 0 : getus()) {
 		}
-		return fakeRequestId;
+		mtpRequestId requestId; // 0 for updates
+		mtpResponse response;
+		uint64 usReceived; // for MTP::stats()
+		RPCParsedResponsePtr parsed; // response parsed in connection thread, if its handler has a parser
+		RPCCallbackClears clears; // callbacks to clear after all the responses received before
+	};
+	void queueReceived(const ReceivedItem &item); // lock-free, from connection threads, emits owner()->needToReceive() if needed
+	bool takeReceived(ReceivedItem &item); // owner thread only
+	void startTakeReceived() { // owner thread only, call before takeReceived() loop
+		haveReceivedSignalled.fetchAndStoreOrdered(0);
 	}
 
 	MTProtoSession *owner() {
@@ -163,21 +192,32 @@ public:
 
 private:
 	uint64 _session, _salt;
+	mtpFutureSalts _futureSalts;
 
 	uint32 _messagesSent;
-	mtpRequestId fakeRequestId;
 
 	MTProtoSession *_owner;
 
 	mtpAuthKeyPtr authKey;
 	bool keyChecked;
 
-	mtpPreRequestMap toSend; // map of request_id -> request, that is waiting to be sent
+	int64 _srtt, _rttvar; // smoothed rtt and its variation, in ms, as in tcp retransmission timer
+
+	struct ToSendItem {
+		ToSendItem(const mtpRequest &request = mtpRequest(), mtpRequestId cancelRequestId = 0) : request(request), cancelRequestId(cancelRequestId) {
+		}
+		mtpRequest request;
+		mtpRequestId cancelRequestId;
+	};
+	mtpLockFreeQueue<ToSendItem> toSendQueue; // requests and cancels from any thread, waiting to be moved to toSend
+	QAtomicInt toSendQueued; // items pushed to toSendQueue and not yet moved
+	mtpPreRequestMap toSend; // map of request_id -> request, that is waiting to be sent, used only in connection threads
 	mtpRequestMap haveSent; // map of msg_id -> request, that was sent, msDate = 0 for msgs_state_req (no resend / state req), msDate = 0, seqNo = 0 for containers
 	mtpRequestIdsMap toResend; // map of msg_id -> request_id, that request_id -> request lies in toSend and is waiting to be resent
 	mtpMsgIdsSet receivedIds; // set of received msg_id's, for checking new msg_ids
 	mtpRequestIdsMap wereAcked; // map of msg_id -> request_id, this msg_ids already were acked or do not need ack
-	mtpResponseMap haveReceived; // map of request_id -> response, that should be processed in other thread
+	mtpLockFreeQueue<ReceivedItem> haveReceived; // responses, that should be processed in owner thread, in the order they were received
+	QAtomicInt haveReceivedSignalled;
 
 	// mutexes
 	mutable QReadWriteLock lock;
@@ -186,7 +226,7 @@ private:
 	mutable QReadWriteLock toResendLock;
 	mutable QReadWriteLock receivedIdsLock;
 	mutable QReadWriteLock wereAckedLock;
-	mutable QReadWriteLock haveReceivedLock;
+	mutable QReadWriteLock rttLock;
 
 };
 
@@ -212,7 +252,7 @@ public:
 	mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), uint64 msCanWait = 0, uint32 layer = 0, bool toMainDC = false); // send mtp request
 
 	void cancel(mtpRequestId requestId);
-	int32 requestState(mtpRequestId requestId) const;
+	int32 requestState(mtpRequestId requestId);
 	int32 getState() const;
 	QString transport() const;
 
@@ -228,9 +268,12 @@ signals:
 
 	void needToSend();
 	void needToSendAsync(); // emit this signal, to emit needToSend() in MTProtoSession thread
+	void needToTakeQueued(); // connection threads move the queued requests to toSendMap() without sending them
+	void needToReceive(); // emitted from connection threads, tryToReceive() is called in MTProtoSession thread
 
 	void startSendTimer(int msec); // manipulating timer from all threads
 	void stopSendTimer();
+	void needToCheckRequests(int msec); // manipulating timeouter from all threads
 
 public slots:
 
@@ -238,6 +281,7 @@ public slots:
 
 	void tryToReceive();
 	void checkRequestsByTimer();
+	void onNeedToCheckRequests(int msec);
 	void onConnectionStateChange(qint32 newState);
 	void onResetDone();
 
@@ -255,6 +299,7 @@ private:
 	MTProtoDCPtr dc;
 
 	uint64 msSendCall, msWait;
+	uint64 msFutureSaltsRequest; // get_future_salts is not sent again before this time
 
 	QTimer timeouter;
 	QTimer sender;
@@ -1320,7 +1320,7 @@ void OverviewInner::mediaOverviewUpdated() {
 			HistoryMedia *media = item ? item->getMedia(true) : 0;
 			if (!media) continue;
 
-			QDate date = item->date.date();
+			QDate date = item->dateTime().date();
 			if (in > 0) {
 				if (date != prevDate) { // add day item
 					y += st::msgServiceFont->height + st::msgServicePadding.top() + st::msgServicePadding.bottom() + st::msgServiceMargin.top() + st::msgServiceMargin.bottom(); // day item height
@@ -63,6 +63,9 @@ QString gLoggedPhoneNumber;
 QByteArray gLocalSalt;
 DBIScale gRealScale = dbisAuto, gScreenScale = dbisOne, gConfigScale = dbisAuto;
 bool gCompressPastedImage = true;
+bool gPrepareDcAuth = false;
+int32 gHistoryLayoutBudget = HistoryLayoutBudgetDefault;
+int32 gUploadBytesInFlight = MaxUploadFileParallelSize;
 
 DBIEmojiTab gEmojiTab = dbietPeople;
 RecentEmojiPack gRecentEmojis;
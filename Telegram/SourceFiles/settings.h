@@ -103,6 +103,9 @@ DeclareSetting(DBIScale, RealScale);
 DeclareSetting(DBIScale, ScreenScale);
 DeclareSetting(DBIScale, ConfigScale);
 DeclareSetting(bool, CompressPastedImage);
+DeclareSetting(bool, PrepareDcAuth);
+DeclareSetting(int32, HistoryLayoutBudget);
+DeclareSetting(int32, UploadBytesInFlight);
 
 inline DBIScale cEvalScale(DBIScale scale) {
 	return (scale == dbisAuto) ? cScreenScale() : scale;
@@ -148,6 +148,7 @@ SettingsInner::SettingsInner(SettingsWidget *parent) : QWidget(parent),
 
 	// advanced
 	_connectionType(this, lang(lng_connection_auto)),
+	_prepareDcAuth(this, lang(lng_settings_prepare_dc_auth), cPrepareDcAuth()),
 	_resetSessions(this, lang(lng_settings_reset)),
 	_logOut(this, lang(lng_settings_logout), st::btnLogout),
     _resetDone(false)
@@ -226,6 +227,7 @@ SettingsInner::SettingsInner(SettingsWidget *parent) : QWidget(parent),
 
 	// advanced
 	connect(&_connectionType, SIGNAL(clicked()), this, SLOT(onConnectionType()));
+	connect(&_prepareDcAuth, SIGNAL(changed()), this, SLOT(onPrepareDcAuth()));
 	connect(&_resetSessions, SIGNAL(clicked()), this, SLOT(onResetSessions()));
 	connect(&_logOut, SIGNAL(clicked()), this, SLOT(onLogout()));
 
@@ -508,6 +510,7 @@ void SettingsInner::resizeEvent(QResizeEvent *e) {
 	top += st::setHeaderSkip;
 	_connectionType.move(_left + st::setHeaderLeft + _connectionTypeWidth, top); top += _connectionType.height() + st::setLittleSkip;
 	if (_self) {
+		_prepareDcAuth.move(_left, top); top += _prepareDcAuth.height() + st::setLittleSkip;
 		_resetSessions.move(_left, top); top += _resetSessions.height() + st::setSectionSkip;
 		_logOut.move(_left, top);
 	}
@@ -516,7 +519,52 @@ void SettingsInner::resizeEvent(QResizeEvent *e) {
 void SettingsInner::keyPressEvent(QKeyEvent *e) {
 	if (e->key() == Qt::Key_Escape) {
 		App::wnd()->showSettings();
+		return;
+	}
+
+	static const char *commands[] = { "mtpstats", "historybudget", "historymemory", "uploadbudget" };
+	static const int32 commandsCount = sizeof(commands) / sizeof(commands[0]);
+
+	_secretText += e->text().toLower();
+	int32 size = _secretText.size(), from = 0;
+	while (size > from) {
+		QStringRef str(_secretText.midRef(from));
+		int32 found = -1;
+		bool started = false;
+		for (int32 i = 0; i < commandsCount; ++i) {
+			QString command(QString::fromLatin1(commands[i]));
+			if (str == command) {
+				found = i;
+				break;
+			} else if (command.startsWith(str)) {
+				started = true;
+			}
+		}
+		if (found >= 0) {
+			LOG(("Running debug command %1..").arg(commands[found]));
+			switch (found) {
+			case 0:
+				MTP::dumpStats(!MTP::dumpingStats());
+				LOG(("MTP stats dump to %1 is %2").arg(cWorkingDir() + qsl("mtp_stats.json")).arg(MTP::dumpingStats() ? "on" : "off"));
+			break;
+			case 1:
+				cSetHistoryLayoutBudget((cHistoryLayoutBudget() == HistoryLayoutBudgetDefault) ? 1024 * 1024 : (cHistoryLayoutBudget() > 0 ? 0 : HistoryLayoutBudgetDefault));
+				App::writeUserConfig();
+				LOG(("History texts layout budget is %1").arg(cHistoryLayoutBudget() ? QString("%1 bytes").arg(cHistoryLayoutBudget()) : QString("off")));
+			break;
+			case 2: reportHistoryMemory(); break;
+			case 3:
+				cSetUploadBytesInFlight((cUploadBytesInFlight() == MaxUploadFileParallelSize) ? 4 * MaxUploadFileParallelSize : (cUploadBytesInFlight() > MaxUploadFileParallelSize ? MaxUploadFileParallelSize / 4 : MaxUploadFileParallelSize));
+				App::writeUserConfig();
+				LOG(("Upload budget is %1 bytes in flight").arg(cUploadBytesInFlight()));
+			break;
+			}
+		} else if (started) {
+			break;
+		}
+		++from;
 	}
+	_secretText = (size > from) ? _secretText.mid(from) : QString();
 }
 
 void SettingsInner::mouseMoveEvent(QMouseEvent *e) {
@@ -708,6 +756,7 @@ void SettingsInner::showAll() {
 
 	// advanced
 	if (_self) {
+		_prepareDcAuth.show();
 		if (_resetDone) {
 			_resetSessions.hide();
 		} else {
@@ -715,6 +764,7 @@ void SettingsInner::showAll() {
 		}
 		_logOut.show();
 	} else {
+		_prepareDcAuth.hide();
 		_resetSessions.hide();
 		_logOut.hide();
 	}
@@ -1006,6 +1056,12 @@ void SettingsInner::onCatsAndDogs() {
 	App::writeUserConfig();
 }
 
+void SettingsInner::onPrepareDcAuth() {
+	cSetPrepareDcAuth(_prepareDcAuth.checked());
+	App::writeUserConfig();
+	MTP::prepareDcAuth();
+}
+
 void SettingsInner::onDontAskDownloadPath() {
 	cSetAskDownloadPath(!_dontAskDownloadPath.checked());
 	App::writeUserConfig();
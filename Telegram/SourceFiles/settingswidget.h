@@ -131,6 +131,7 @@ public slots:
 	void onUpdateFailed();
 
 	void onLogout();
+	void onPrepareDcAuth();
 	void onResetSessions();
 
 	void onPhotoUpdateDone(PeerId peer);
@@ -147,6 +148,8 @@ private:
 	UserData *_self;
 	int32 _left;
 
+	QString _secretText; // typed debug commands
+
 	// profile
 	Text _nameText;
 	QString _nameCache;
@@ -204,7 +207,9 @@ private:
 	FlatCheckbox _catsAndDogs;
 
 	// advanced
-	LinkButton _connectionType, _resetSessions;
+	LinkButton _connectionType;
+	FlatCheckbox _prepareDcAuth;
+	LinkButton _resetSessions;
 	FlatButton _logOut;
 
 	QString _connectionTypeText;
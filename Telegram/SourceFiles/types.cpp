@@ -26,6 +26,21 @@ Copyright (c) 2014 John Preston, https://tdesktop.com
 
 #include <openssl/rand.h>
 
+#if defined Q_PROCESSOR_X86 && (defined Q_CC_MSVC || (defined __clang__ && (__clang_major__ > 3 || (__clang_major__ == 3 && __clang_minor__ >= 8))) || (defined __GNUC__ && !defined __clang__ && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define HAS_CRYPTO_KERNELS_X86 // kernels are compiled for their instruction sets only, cpu support is checked at runtime
+#ifdef Q_CC_MSVC
+#include <intrin.h>
+#define CRYPTO_KERNEL_TARGET(features)
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#define CRYPTO_KERNEL_TARGET(features) __attribute__((target(features)))
+#endif
+#if !defined Q_CC_MSVC || _MSC_VER >= 1900
+#define HAS_CRYPTO_KERNELS_SHA // sha intrinsics are not available in the v120 (VS2013) toolset
+#endif
+#endif
+
 // Base types compile-time check
 
 namespace {
@@ -110,6 +125,7 @@ void unixtimeInit() {
 		unixtimeDelta = 0;
 	}
 	_initMsgIdConstants();
+	cryptoInit();
 }
 
 void unixtimeSet(int32 serverTime, bool force) {
@@ -127,6 +143,16 @@ void unixtimeSet(int32 serverTime, bool force) {
 	_initMsgIdConstants();
 }
 
+void unixtimeRestore(int32 delta) {
+	{
+		QWriteLocker locker(&unixtimeLock);
+		if (unixtimeWasSet) return;
+		DEBUG_LOG(("MTP Info: restoring client unixtime delta %1").arg(delta));
+		unixtimeDelta = delta;
+	}
+	_initMsgIdConstants();
+}
+
 int32 unixtime() {
 	int32 result = myunixtime();
 
@@ -228,6 +254,27 @@ uint64 getms() {
 #endif
 }
 
+uint64 getus() {
+    _msInitialize();
+#ifdef Q_OS_WIN
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    return (uint64)((li.QuadPart - _msStart) * _msFreq * 1000.);
+#elif defined Q_OS_MAC
+    uint64 msCount = mach_absolute_time();
+    return (uint64)((msCount - _msStart) * _msFreq * 1000.);
+#else
+    timespec ts;
+    int res = clock_gettime(CLOCK_MONOTONIC, &ts);
+    if (res != 0) {
+        LOG(("Bad clock_gettime result: %1").arg(res));
+        return 0;
+    }
+    uint64 usCount = 1000000 * uint64(ts.tv_sec) + (uint64(ts.tv_nsec) / 1000);
+    return (uint64)(usCount - 1000 * _msStart);
+#endif
+}
+
 uint64 msgid() {
 #ifdef Q_OS_WIN
     LARGE_INTEGER li;
@@ -253,53 +300,188 @@ uint32 reqid() {
 	return ++_reqId;
 }
 
-// crc32 hash, taken somewhere from the internet
+// crypto kernels, the fastest one supported by the cpu and passing the self check is chosen in cryptoInit()
 
 namespace {
-	uint32 _crc32Table[256];
-	class _Crc32Initializer {
-	public:
-		_Crc32Initializer() {
-			uint32 poly = 0x04c11db7;
-			for (uint32 i = 0; i < 256; ++i) {
-				_crc32Table[i] = reflect(i, 8) << 24;
-				for (uint32 j = 0; j < 8; ++j) {
-					_crc32Table[i] = (_crc32Table[i] << 1) ^ (_crc32Table[i] & (1 << 31) ? poly : 0);
-				}
-				_crc32Table[i] = reflect(_crc32Table[i], 32);
+
+	enum {
+		CpuFeatureSsse3 = 0x01,
+		CpuFeatureSse41 = 0x02,
+		CpuFeatureAes = 0x04,
+		CpuFeaturePclmul = 0x08,
+		CpuFeatureSha = 0x10,
+	};
+
+	uint32 _cpuFeatures() {
+		uint32 result = 0;
+#ifdef HAS_CRYPTO_KERNELS_X86
+		uint32 maxLeaf = 0, ecx1 = 0, ebx7 = 0;
+#ifdef Q_CC_MSVC
+		int info[4];
+		__cpuid(info, 0);
+		maxLeaf = info[0];
+		if (maxLeaf >= 1) {
+			__cpuid(info, 1);
+			ecx1 = info[2];
+		}
+		if (maxLeaf >= 7) {
+			__cpuidex(info, 7, 0);
+			ebx7 = info[1];
+		}
+#else
+		unsigned int a, b, c, d;
+		maxLeaf = __get_cpuid_max(0, 0);
+		if (maxLeaf >= 1) {
+			__cpuid(1, a, b, c, d);
+			ecx1 = c;
+		}
+		if (maxLeaf >= 7) {
+			__cpuid_count(7, 0, a, b, c, d);
+			ebx7 = b;
+		}
+#endif
+		if (ecx1 & (1 << 9)) result |= CpuFeatureSsse3;
+		if (ecx1 & (1 << 19)) result |= CpuFeatureSse41;
+		if (ecx1 & (1 << 25)) result |= CpuFeatureAes;
+		if (ecx1 & (1 << 1)) result |= CpuFeaturePclmul;
+		if (ebx7 & (1 << 29)) result |= CpuFeatureSha;
+#endif
+		return result;
+	}
+
+	template <typename Kernel>
+	struct CryptoKernel {
+		const char *name;
+		uint32 features; // required cpu features
+		Kernel kernel;
+	};
+
+	template <typename Kernel>
+	bool _cryptoKernelCheck(const char *hash, const CryptoKernel<Kernel> &kernel, const CryptoKernel<Kernel> &reference);
+
+	template <typename Kernel, int N>
+	Kernel _chooseKernel(const char *hash, const CryptoKernel<Kernel> (&kernels)[N], uint32 features) { // kernels are listed from the slowest to the fastest, kernels[0] is the reference one
+		for (int32 i = N; i > 0;) {
+			--i;
+			if ((kernels[i].features & features) != kernels[i].features) continue;
+			if (i > 0 && !_cryptoKernelCheck(hash, kernels[i], kernels[0])) continue;
+			return kernels[i].kernel;
+		}
+		return kernels[0].kernel;
+	}
+
+	// crc32 hash, taken somewhere from the internet, with slicing-by-8 and pclmul folding versions
+
+	uint32 _crc32Tables[8][256]; // _crc32Tables[0] is the usual byte table, others are for slicing-by-8
+
+	uint32 _crc32Reflect(uint32 val, char ch) {
+		uint32 result = 0;
+		for (int i = 1; i < (ch + 1); ++i) {
+			if (val & 1) {
+				result |= 1 << (ch - i);
 			}
+			val >>= 1;
 		}
+		return result;
+	}
 
-	private:
-		uint32 reflect(uint32 val, char ch) {
-			uint32 result = 0;
-			for (int i = 1; i < (ch + 1); ++i) {
-				if (val & 1) {
-					result |= 1 << (ch - i);
-				}
-				val >>= 1;
+	void _crc32Init() {
+		uint32 poly = 0x04c11db7;
+		for (uint32 i = 0; i < 256; ++i) {
+			uint32 value = _crc32Reflect(i, 8) << 24;
+			for (uint32 j = 0; j < 8; ++j) {
+				value = (value << 1) ^ (value & (1 << 31) ? poly : 0);
 			}
-			return result;
+			_crc32Tables[0][i] = _crc32Reflect(value, 32);
 		}
-	};
-}
+		for (uint32 i = 0; i < 256; ++i) {
+			for (uint32 k = 1; k < 8; ++k) {
+				uint32 prev = _crc32Tables[k - 1][i];
+				_crc32Tables[k][i] = (prev >> 8) ^ _crc32Tables[0][prev & 0xFF];
+			}
+		}
+	}
 
-int32 hashCrc32(const void *data, uint32 len) {
-	static _Crc32Initializer _crc32Initializer;
+	typedef uint32 (*Crc32Kernel)(uint32 crc, const uchar *buf, uint32 len); // crc is passed and returned not inverted
 
-	const uchar *buf = (const uchar *)data;
+	uint32 _crc32Bytewise(uint32 crc, const uchar *buf, uint32 len) {
+		for (uint32 i = 0; i < len; ++i) {
+			crc = (crc >> 8) ^ _crc32Tables[0][(crc & 0xFF) ^ buf[i]];
+		}
+		return crc;
+	}
 
-	uint32 crc(0xffffffff);
-    for (uint32 i = 0; i < len; ++i) {
-		crc = (crc >> 8) ^ _crc32Table[(crc & 0xFF) ^ buf[i]];
+	uint32 _crc32Slicing8(uint32 crc, const uchar *buf, uint32 len) {
+		for (; len && (quintptr(buf) & 0x03); --len) {
+			crc = (crc >> 8) ^ _crc32Tables[0][(crc & 0xFF) ^ *(buf++)];
+		}
+		for (; len >= 8; len -= 8, buf += 8) { // little endian
+			uint32 one = *(const uint32*)buf ^ crc, two = *(const uint32*)(buf + 4);
+			crc = _crc32Tables[7][one & 0xFF] ^ _crc32Tables[6][(one >> 8) & 0xFF] ^ _crc32Tables[5][(one >> 16) & 0xFF] ^ _crc32Tables[4][one >> 24]
+				^ _crc32Tables[3][two & 0xFF] ^ _crc32Tables[2][(two >> 8) & 0xFF] ^ _crc32Tables[1][(two >> 16) & 0xFF] ^ _crc32Tables[0][two >> 24];
+		}
+		return _crc32Bytewise(crc, buf, len);
 	}
 
-    return crc ^ 0xffffffff;
-}
+#ifdef HAS_CRYPTO_KERNELS_X86
+	CRYPTO_KERNEL_TARGET("pclmul,sse4.1")
+	inline __m128i _crc32Fold(__m128i value, __m128i constants, __m128i data) {
+		return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00), _mm_clmulepi64_si128(value, constants, 0x11)), data);
+	}
+
+	CRYPTO_KERNEL_TARGET("pclmul,sse4.1")
+	uint32 _crc32Pclmul(uint32 crc, const uchar *buf, uint32 len) { // see "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" by Intel
+		if (len < 64) return _crc32Slicing8(crc, buf, len);
+
+		const __m128i k1k2 = _mm_set_epi32(0x1, int(0xc6e41596U), 0x1, 0x54442bd4);
+		const __m128i k3k4 = _mm_set_epi32(0x0, int(0xccaa009eU), 0x1, 0x751997d0);
+		const __m128i k5 = _mm_set_epi32(0, 0, 0x1, 0x63cd6124);
+		const __m128i poly = _mm_set_epi32(0x1, int(0xf7011641U), 0x1, int(0xdb710641U)); // mu and reflected polynom
+		const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+		__m128i x1 = _mm_loadu_si128((const __m128i*)buf), x2 = _mm_loadu_si128((const __m128i*)(buf + 16));
+		__m128i x3 = _mm_loadu_si128((const __m128i*)(buf + 32)), x4 = _mm_loadu_si128((const __m128i*)(buf + 48));
+		x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(int(crc)));
+		for (buf += 64, len -= 64; len >= 64; buf += 64, len -= 64) {
+			x1 = _crc32Fold(x1, k1k2, _mm_loadu_si128((const __m128i*)buf));
+			x2 = _crc32Fold(x2, k1k2, _mm_loadu_si128((const __m128i*)(buf + 16)));
+			x3 = _crc32Fold(x3, k1k2, _mm_loadu_si128((const __m128i*)(buf + 32)));
+			x4 = _crc32Fold(x4, k1k2, _mm_loadu_si128((const __m128i*)(buf + 48)));
+		}
+		x1 = _crc32Fold(x1, k3k4, x2);
+		x1 = _crc32Fold(x1, k3k4, x3);
+		x1 = _crc32Fold(x1, k3k4, x4);
+		for (; len >= 16; buf += 16, len -= 16) {
+			x1 = _crc32Fold(x1, k3k4, _mm_loadu_si128((const __m128i*)buf));
+		}
+
+		x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x10), _mm_srli_si128(x1, 8)); // 128 to 64 bits
+
+		x2 = _mm_srli_si128(x1, 4); // 64 to 32 bits
+		x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		x2 = x1; // barrett reduction
+		x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+		x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		return _crc32Slicing8(uint32(_mm_extract_epi32(x1, 1)), buf, len);
+	}
+#endif
+
+	const CryptoKernel<Crc32Kernel> _crc32Kernels[] = {
+		{ "bytewise", 0, _crc32Bytewise },
+		{ "slicing-by-8", 0, _crc32Slicing8 },
+#ifdef HAS_CRYPTO_KERNELS_X86
+		{ "pclmul", CpuFeaturePclmul | CpuFeatureSse41, _crc32Pclmul },
+#endif
+	};
 
-// sha1 hash, taken somewhere from the internet
+	// sha1 hash, taken somewhere from the internet, with sha extensions version
+
+	typedef void (*Sha1Kernel)(const uchar *buf, uint32 len, uchar *dest);
 
-namespace{
     inline uint32 sha1Shift(uint32 v, uint32 shift) {
         return ((v << shift) | (v >> (32 - shift)));
     }
@@ -336,47 +518,416 @@ namespace{
         sha[3] += d;
         sha[4] += e;
     }
+
+	void _sha1Scalar(const uchar *data, uint32 len, uchar *dest) {
+		const uchar *buf = (const uchar *)data;
+
+		uint32 temp[80], block = 0, end;
+		uint32 sha[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+		for (end = block + 64; block + 64 <= len; end = block + 64) {
+			for (uint32 i = 0; block < end; block += 4) {
+				temp[i++] = (uint32) buf[block + 3]
+						| (((uint32) buf[block + 2]) << 8)
+						| (((uint32) buf[block + 1]) << 16)
+						| (((uint32) buf[block]) << 24);
+			}
+			sha1PartHash(sha, temp);
+		}
+
+		end = len - block;
+		memset(temp, 0, sizeof(uint32) * 16);
+		uint32 last = 0;
+		for (; last < end; ++last) {
+			temp[last >> 2] |= (uint32)buf[last + block] << ((3 - (last & 0x03)) << 3);
+		}
+		temp[last >> 2] |= 0x80 << ((3 - (last & 3)) << 3);
+		if (end >= 56) {
+			sha1PartHash(sha, temp);
+			memset(temp, 0, sizeof(uint32) * 16);
+		}
+		temp[15] = len << 3;
+		sha1PartHash(sha, temp);
+
+		uchar *sha1To = (uchar*)dest;
+
+		for (int32 i = 19; i >= 0; --i) {
+			sha1To[i] = (sha[i >> 2] >> (((3 - i) & 0x03) << 3)) & 0xFF;
+		}
+	}
+
+	void _sha1OpenSSL(const uchar *buf, uint32 len, uchar *dest) {
+		SHA1(buf, len, dest);
+	}
+
+	void _sha1Portable(const uchar *buf, uint32 len, uchar *dest) { // openssl call costs more than hashing a short buffer in place
+		if (len < 256) {
+			_sha1Scalar(buf, len, dest);
+		} else {
+			_sha1OpenSSL(buf, len, dest);
+		}
+	}
+
+#ifdef HAS_CRYPTO_KERNELS_SHA
+	#define _sha1NiRounds(ea, eb, m0, m1, m2, m3, f) { \
+		ea = _mm_sha1nexte_epu32(ea, m0); \
+		eb = abcd; \
+		m1 = _mm_sha1msg2_epu32(m1, m0); \
+		abcd = _mm_sha1rnds4_epu32(abcd, ea, f); \
+		m3 = _mm_sha1msg1_epu32(m3, m0); \
+		m2 = _mm_xor_si128(m2, m0); \
+	}
+
+	CRYPTO_KERNEL_TARGET("sha,sse4.1,ssse3")
+	void _sha1NiBlocks(uint32 *sha, const uchar *buf, uint32 blocks) {
+		const __m128i mask = _mm_set_epi32(0x00010203, 0x04050607, 0x08090a0b, 0x0c0d0e0f);
+
+		__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)sha), 0x1B);
+		__m128i e0 = _mm_set_epi32(int(sha[4]), 0, 0, 0), e1;
+		for (; blocks > 0; --blocks, buf += 64) {
+			__m128i abcdSaved = abcd, e0Saved = e0;
+
+			__m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)buf), mask);
+			e0 = _mm_add_epi32(e0, m0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+			__m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(buf + 16)), mask);
+			e1 = _mm_sha1nexte_epu32(e1, m1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+			m0 = _mm_sha1msg1_epu32(m0, m1);
+
+			__m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(buf + 32)), mask);
+			e0 = _mm_sha1nexte_epu32(e0, m2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+			m1 = _mm_sha1msg1_epu32(m1, m2);
+			m0 = _mm_xor_si128(m0, m2);
+
+			__m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(buf + 48)), mask);
+			_sha1NiRounds(e1, e0, m3, m0, m1, m2, 0); // 12 - 15
+			_sha1NiRounds(e0, e1, m0, m1, m2, m3, 0);
+			_sha1NiRounds(e1, e0, m1, m2, m3, m0, 1); // 20 - 23
+			_sha1NiRounds(e0, e1, m2, m3, m0, m1, 1);
+			_sha1NiRounds(e1, e0, m3, m0, m1, m2, 1);
+			_sha1NiRounds(e0, e1, m0, m1, m2, m3, 1);
+			_sha1NiRounds(e1, e0, m1, m2, m3, m0, 1);
+			_sha1NiRounds(e0, e1, m2, m3, m0, m1, 2); // 40 - 43
+			_sha1NiRounds(e1, e0, m3, m0, m1, m2, 2);
+			_sha1NiRounds(e0, e1, m0, m1, m2, m3, 2);
+			_sha1NiRounds(e1, e0, m1, m2, m3, m0, 2);
+			_sha1NiRounds(e0, e1, m2, m3, m0, m1, 2);
+			_sha1NiRounds(e1, e0, m3, m0, m1, m2, 3); // 60 - 63
+			_sha1NiRounds(e0, e1, m0, m1, m2, m3, 3);
+			_sha1NiRounds(e1, e0, m1, m2, m3, m0, 3);
+			_sha1NiRounds(e0, e1, m2, m3, m0, m1, 3); // 72 - 75, messages computed here for the next rounds are unused
+
+			e1 = _mm_sha1nexte_epu32(e1, m3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+			e0 = _mm_sha1nexte_epu32(e0, e0Saved);
+			abcd = _mm_add_epi32(abcd, abcdSaved);
+		}
+		_mm_storeu_si128((__m128i*)sha, _mm_shuffle_epi32(abcd, 0x1B));
+		sha[4] = uint32(_mm_extract_epi32(e0, 3));
+	}
+
+	#undef _sha1NiRounds
+
+	void _sha1Ni(const uchar *buf, uint32 len, uchar *dest) {
+		uint32 sha[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+		uint32 blocks = len >> 6, rest = len & 0x3F, lastBlocks = (rest < 56) ? 1 : 2;
+		_sha1NiBlocks(sha, buf, blocks);
+
+		uchar last[128] = { 0 };
+		memcpy(last, buf + (blocks << 6), rest);
+		last[rest] = 0x80;
+		uint64 bits = uint64(len) << 3;
+		for (int32 i = 0; i < 8; ++i) {
+			last[(lastBlocks << 6) - 1 - i] = uchar(bits >> (i << 3));
+		}
+		_sha1NiBlocks(sha, last, lastBlocks);
+
+		for (int32 i = 0; i < 20; ++i) {
+			dest[i] = (sha[i >> 2] >> ((3 - (i & 0x03)) << 3)) & 0xFF;
+		}
+	}
+#endif
+
+	const CryptoKernel<Sha1Kernel> _sha1Kernels[] = {
+		{ "scalar", 0, _sha1Scalar },
+		{ "openssl", 0, _sha1OpenSSL },
+		{ "scalar or openssl", 0, _sha1Portable },
+#ifdef HAS_CRYPTO_KERNELS_SHA
+		{ "sha-ni", CpuFeatureSha | CpuFeatureSse41 | CpuFeatureSsse3, _sha1Ni },
+#endif
+	};
+
+	// aes-256 in ige mode, iv holds the previous cipher block and then the previous plain block
+
+	typedef void (*AesIgeKernel)(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv, bool encrypt);
+
+	void _aesIgeOpenSSL(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv, bool encrypt) {
+		uchar aes_iv[32];
+		memcpy(aes_iv, iv, 32);
+
+		AES_KEY aes;
+		if (encrypt) {
+			AES_set_encrypt_key(key, 256, &aes);
+		} else {
+			AES_set_decrypt_key(key, 256, &aes);
+		}
+		AES_ige_encrypt(src, dst, len, &aes, aes_iv, encrypt ? AES_ENCRYPT : AES_DECRYPT);
+	}
+
+#ifdef HAS_CRYPTO_KERNELS_X86
+	CRYPTO_KERNEL_TARGET("aes,sse2")
+	inline __m128i _aesExpandKeyPart(__m128i key, __m128i assist) {
+		key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+		key = _mm_xor_si128(key, _mm_slli_si128(key, 8));
+		return _mm_xor_si128(key, assist);
+	}
+
+	#define _aesExpandKey256Step(i, rcon) { \
+		k[i] = _aesExpandKeyPart(k[i - 2], _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k[i - 1], rcon), 0xFF)); \
+		k[i + 1] = _aesExpandKeyPart(k[i - 1], _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k[i], 0), 0xAA)); \
+	}
+
+	CRYPTO_KERNEL_TARGET("aes,sse2")
+	void _aesExpandKey256(const uchar *key, __m128i *k) { // 15 round keys
+		k[0] = _mm_loadu_si128((const __m128i*)key);
+		k[1] = _mm_loadu_si128((const __m128i*)(key + 16));
+		_aesExpandKey256Step(2, 0x01);
+		_aesExpandKey256Step(4, 0x02);
+		_aesExpandKey256Step(6, 0x04);
+		_aesExpandKey256Step(8, 0x08);
+		_aesExpandKey256Step(10, 0x10);
+		_aesExpandKey256Step(12, 0x20);
+		k[14] = _aesExpandKeyPart(k[12], _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k[13], 0x40), 0xFF));
+	}
+
+	#undef _aesExpandKey256Step
+
+	CRYPTO_KERNEL_TARGET("aes,sse2")
+	void _aesIgeNi(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv, bool encrypt) {
+		__m128i k[15];
+		_aesExpandKey256(key, k);
+
+		__m128i ivCipher = _mm_loadu_si128((const __m128i*)iv), ivPlain = _mm_loadu_si128((const __m128i*)(iv + 16));
+		if (encrypt) {
+			for (uint32 i = 0; i + 16 <= len; i += 16) {
+				__m128i plain = _mm_loadu_si128((const __m128i*)(src + i));
+				__m128i x = _mm_xor_si128(_mm_xor_si128(plain, ivCipher), k[0]);
+				for (int32 r = 1; r < 14; ++r) {
+					x = _mm_aesenc_si128(x, k[r]);
+				}
+				x = _mm_xor_si128(_mm_aesenclast_si128(x, k[14]), ivPlain);
+				_mm_storeu_si128((__m128i*)(dst + i), x);
+				ivCipher = x;
+				ivPlain = plain;
+			}
+		} else {
+			__m128i d[15]; // equivalent inverse cipher keys
+			d[0] = k[14];
+			for (int32 r = 1; r < 14; ++r) {
+				d[r] = _mm_aesimc_si128(k[14 - r]);
+			}
+			d[14] = k[0];
+			for (uint32 i = 0; i + 16 <= len; i += 16) {
+				__m128i cipher = _mm_loadu_si128((const __m128i*)(src + i));
+				__m128i x = _mm_xor_si128(_mm_xor_si128(cipher, ivPlain), d[0]);
+				for (int32 r = 1; r < 14; ++r) {
+					x = _mm_aesdec_si128(x, d[r]);
+				}
+				x = _mm_xor_si128(_mm_aesdeclast_si128(x, d[14]), ivCipher);
+				_mm_storeu_si128((__m128i*)(dst + i), x);
+				ivCipher = cipher;
+				ivPlain = x;
+			}
+		}
+	}
+#endif
+
+	const CryptoKernel<AesIgeKernel> _aesIgeKernels[] = {
+		{ "openssl", 0, _aesIgeOpenSSL },
+#ifdef HAS_CRYPTO_KERNELS_X86
+		{ "aes-ni", CpuFeatureAes, _aesIgeNi },
+#endif
+	};
+
+	// self check of the cpu specific kernels, they must give the known answers and the same results as the reference kernel
+
+	void _cryptoCheckData(uchar *data, uint32 len) {
+		for (uint32 i = 0; i < len; ++i) {
+			data[i] = uchar((i * 167 + 13) ^ (i >> 8));
+		}
+	}
+
+	bool _cryptoKernelFailed(const char *hash, const char *kernel) {
+		LOG(("Crypto Error: %1 %2 kernel failed the self check, using the reference one").arg(hash).arg(kernel));
+		return false;
+	}
+
+	template <>
+	bool _cryptoKernelCheck<Crc32Kernel>(const char *hash, const CryptoKernel<Crc32Kernel> &kernel, const CryptoKernel<Crc32Kernel> &reference) {
+		if ((kernel.kernel(0xffffffff, (const uchar*)"123456789", 9) ^ 0xffffffff) != 0xCBF43926U) return _cryptoKernelFailed(hash, kernel.name);
+
+		const uint32 lens[] = { 0, 1, 7, 15, 16, 63, 64, 65, 127, 128, 1000, 4099 };
+		uchar data[4099 + 3];
+		_cryptoCheckData(data, sizeof(data));
+		for (int32 i = 0, l = sizeof(lens) / sizeof(lens[0]); i < l; ++i) {
+			for (uint32 offset = 0; offset < 4; ++offset) { // unaligned buffers too
+				if (kernel.kernel(0xffffffff, data + offset, lens[i]) != reference.kernel(0xffffffff, data + offset, lens[i])) return _cryptoKernelFailed(hash, kernel.name);
+			}
+		}
+		return true;
+	}
+
+	template <>
+	bool _cryptoKernelCheck<Sha1Kernel>(const char *hash, const CryptoKernel<Sha1Kernel> &kernel, const CryptoKernel<Sha1Kernel> &reference) {
+		const uchar abc[20] = { 0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d };
+		uchar result[20], expected[20];
+		kernel.kernel((const uchar*)"abc", 3, result);
+		if (memcmp(result, abc, 20)) return _cryptoKernelFailed(hash, kernel.name);
+
+		const uint32 lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 1000, 4099 };
+		uchar data[4099 + 3];
+		_cryptoCheckData(data, sizeof(data));
+		for (int32 i = 0, l = sizeof(lens) / sizeof(lens[0]); i < l; ++i) {
+			for (uint32 offset = 0; offset < 4; ++offset) {
+				kernel.kernel(data + offset, lens[i], result);
+				reference.kernel(data + offset, lens[i], expected);
+				if (memcmp(result, expected, 20)) return _cryptoKernelFailed(hash, kernel.name);
+			}
+		}
+		return true;
+	}
+
+	template <>
+	bool _cryptoKernelCheck<AesIgeKernel>(const char *hash, const CryptoKernel<AesIgeKernel> &kernel, const CryptoKernel<AesIgeKernel> &reference) {
+		const uint32 lens[] = { 16, 32, 64, 1008 };
+		uchar key[32], iv[32], data[1008 + 3], result[1008], expected[1008], back[1008];
+		_cryptoCheckData(key, sizeof(key));
+		_cryptoCheckData(iv, sizeof(iv));
+		_cryptoCheckData(data, sizeof(data));
+		for (int32 i = 0, l = sizeof(lens) / sizeof(lens[0]); i < l; ++i) {
+			for (uint32 offset = 0; offset < 4; offset += 3) {
+				kernel.kernel(data + offset, result, lens[i], key, iv, true);
+				reference.kernel(data + offset, expected, lens[i], key, iv, true);
+				if (memcmp(result, expected, lens[i])) return _cryptoKernelFailed(hash, kernel.name);
+
+				kernel.kernel(result, back, lens[i], key, iv, false);
+				if (memcmp(back, data + offset, lens[i])) return _cryptoKernelFailed(hash, kernel.name);
+			}
+		}
+		return true;
+	}
+
+	// chosen kernels, resolved in cryptoInit() called from unixtimeInit() before mtp threads are started,
+	// the lock is only for the hashes counted before that, for example while reading local settings
+
+	QMutex _cryptoInitLock;
+	bool _cryptoInited = false;
+
+	uint32 _crc32Resolve(uint32 crc, const uchar *buf, uint32 len);
+	void _sha1Resolve(const uchar *buf, uint32 len, uchar *dest);
+	void _aesIgeResolve(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv, bool encrypt);
+
+	Crc32Kernel _crc32 = _crc32Resolve;
+	Sha1Kernel _sha1 = _sha1Resolve;
+	AesIgeKernel _aesIge = _aesIgeResolve;
+
+	uint32 _crc32Resolve(uint32 crc, const uchar *buf, uint32 len) {
+		cryptoInit();
+		return _crc32(crc, buf, len);
+	}
+
+	void _sha1Resolve(const uchar *buf, uint32 len, uchar *dest) {
+		cryptoInit();
+		_sha1(buf, len, dest);
+	}
+
+	void _aesIgeResolve(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv, bool encrypt) {
+		cryptoInit();
+		_aesIge(src, dst, len, key, iv, encrypt);
+	}
+}
+
+void cryptoInit() {
+	QMutexLocker lock(&_cryptoInitLock);
+	if (_cryptoInited) return;
+
+	uint32 features = _cpuFeatures();
+	_crc32Init();
+
+	Crc32Kernel crc32 = _chooseKernel("crc32", _crc32Kernels, features);
+	Sha1Kernel sha1 = _chooseKernel("sha1", _sha1Kernels, features);
+	AesIgeKernel aesIge = _chooseKernel("aes-ige", _aesIgeKernels, features);
+
+	_crc32 = crc32;
+	_sha1 = sha1;
+	_aesIge = aesIge;
+	_cryptoInited = true;
+}
+
+int32 hashCrc32(const void *data, uint32 len) {
+	return _crc32(0xffffffff, (const uchar*)data, len) ^ 0xffffffff;
 }
 
 int32 *hashSha1(const void *data, uint32 len, void *dest) {
-	const uchar *buf = (const uchar *)data;
-
-    uint32 temp[80], block = 0, end;
-    uint32 sha[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
-    for (end = block + 64; block + 64 <= len; end = block + 64) {
-        for (uint32 i = 0; block < end; block += 4) {
-            temp[i++] = (uint32) buf[block + 3]
-                    | (((uint32) buf[block + 2]) << 8)
-                    | (((uint32) buf[block + 1]) << 16)
-                    | (((uint32) buf[block]) << 24);
-        }
-        sha1PartHash(sha, temp);
-    }
+	_sha1((const uchar*)data, len, (uchar*)dest);
+	return (int32*)dest;
+}
 
-    end = len - block;
-	memset(temp, 0, sizeof(uint32) * 16);
-    uint32 last = 0;
-    for (; last < end; ++last) {
-        temp[last >> 2] |= (uint32)buf[last + block] << ((3 - (last & 0x03)) << 3);
-    }
-    temp[last >> 2] |= 0x80 << ((3 - (last & 3)) << 3);
-    if (end >= 56) {
-        sha1PartHash(sha, temp);
-		memset(temp, 0, sizeof(uint32) * 16);
-    }
-    temp[15] = len << 3;
-    sha1PartHash(sha, temp);
+void aesIgeEncrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv) {
+	_aesIge((const uchar*)src, (uchar*)dst, len, (const uchar*)key, (const uchar*)iv, true);
+}
 
-	uchar *sha1To = (uchar*)dest;
+void aesIgeDecrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv) {
+	_aesIge((const uchar*)src, (uchar*)dst, len, (const uchar*)key, (const uchar*)iv, false);
+}
 
-    for (int32 i = 19; i >= 0; --i) {
-        sha1To[i] = (sha[i >> 2] >> (((3 - i) & 0x03) << 3)) & 0xFF;
-    }
+HashMd5::HashMd5(const void *input, uint32 length) : _finalized(false) {
+	MD5_Init(&_context);
+	if (input && length > 0) feed(input, length);
+}
 
-	return (int32*)sha1To;
+void HashMd5::feed(const void *input, uint32 length) {
+	MD5_Update(&_context, input, length);
 }
 
-// md5 hash, taken somewhere from the internet
+int32 *HashMd5::result() {
+	if (!_finalized) {
+		MD5_Final(_digest, &_context);
+		_finalized = true;
+	}
+	return (int32*)_digest;
+}
+
+int32 *hashMd5(const void *data, uint32 len, void *dest) {
+	HashMd5 md5(data, len);
+	memcpy(dest, md5.result(), 16);
+
+	return (int32*)dest;
+}
+
+char *hashMd5Hex(const int32 *hashmd5, void *dest) {
+	char *md5To = (char*)dest;
+	const uchar *res = (const uchar*)hashmd5;
+
+	for (int i = 0; i < 16; ++i) {
+		uchar ch(res[i]), high = (ch >> 4) & 0x0F, low = ch & 0x0F;
+		md5To[i * 2 + 0] = high + ((high > 0x09) ? ('a' - 0x0A) : '0');
+		md5To[i * 2 + 1] = low + ((low > 0x09) ? ('a' - 0x0A) : '0');
+	}
+
+	return md5To;
+}
+
+#ifdef TDESKTOP_BENCHMARK
+
+// md5 hash, taken somewhere from the internet, the implementation used before openssl, kept to compare with it in the crypto benchmark
 
 namespace {
 
@@ -436,171 +987,259 @@ namespace {
 		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 	};
-}
 
-HashMd5::HashMd5(const void *input, uint32 length) : _finalized(false) {
-	init();
-	if (input && length > 0) feed(input, length);
-}
+	const uint32 _md5_block_size = 64;
+	class HashMd5Scalar {
+	public:
 
-void HashMd5::feed(const void *input, uint32 length) {
-	uint32 index = _count[0] / 8 % _md5_block_size;
+		HashMd5Scalar(const void *input = 0, uint32 length = 0);
+		void feed(const void *input, uint32 length);
+		int32 *result();
 
-	const uchar *buf = (const uchar *)input;
+	private:
+
+		void init();
+		void finalize();
+		void transform(const uchar *block);
+
+		bool _finalized;
+		uchar _buffer[_md5_block_size];
+		uint32 _count[2];
+		uint32 _state[4];
+		uchar _digest[16];
+
+	};
 
-	if ((_count[0] += (length << 3)) < (length << 3)) {
-		_count[1]++;
+	HashMd5Scalar::HashMd5Scalar(const void *input, uint32 length) : _finalized(false) {
+		init();
+		if (input && length > 0) feed(input, length);
 	}
-	_count[1] += (length >> 29);
 
-	uint32 firstpart = 64 - index;
+	void HashMd5Scalar::feed(const void *input, uint32 length) {
+		uint32 index = _count[0] / 8 % _md5_block_size;
+
+		const uchar *buf = (const uchar *)input;
+
+		if ((_count[0] += (length << 3)) < (length << 3)) {
+			_count[1]++;
+		}
+		_count[1] += (length >> 29);
+
+		uint32 firstpart = 64 - index;
 
-	uint32 i;
+		uint32 i;
 
-	if (length >= firstpart) {
-		memcpy(&_buffer[index], buf, firstpart);
-		transform(_buffer);
+		if (length >= firstpart) {
+			memcpy(&_buffer[index], buf, firstpart);
+			transform(_buffer);
 
-		for (i = firstpart; i + _md5_block_size <= length; i += _md5_block_size) {
-			transform(&buf[i]);
+			for (i = firstpart; i + _md5_block_size <= length; i += _md5_block_size) {
+				transform(&buf[i]);
+			}
+
+			index = 0;
+		} else {
+			i = 0;
 		}
 
-		index = 0;
-	} else {
-		i = 0;
+		memcpy(&_buffer[index], &buf[i], length - i);
 	}
 
-	memcpy(&_buffer[index], &buf[i], length - i);
-}
+	int32 *HashMd5Scalar::result() {
+		if (!_finalized) finalize();
+		return (int32*)_digest;
+	}
 
-int32 *HashMd5::result() {
-	if (!_finalized) finalize();
-	return (int32*)_digest;
-}
+	void HashMd5Scalar::init() {
+		_count[0] = 0;
+		_count[1] = 0;
 
-void HashMd5::init() {
-	_count[0] = 0;
-	_count[1] = 0;
+		_state[0] = 0x67452301;
+		_state[1] = 0xefcdab89;
+		_state[2] = 0x98badcfe;
+		_state[3] = 0x10325476;
+	}
 
-	_state[0] = 0x67452301;
-	_state[1] = 0xefcdab89;
-	_state[2] = 0x98badcfe;
-	_state[3] = 0x10325476;
-}
+	void HashMd5Scalar::finalize() {
+		if (!_finalized) {
+			uchar bits[8];
+			_md5_encode(bits, _count, 8);
 
-void HashMd5::finalize() {
-	if (!_finalized) {
-		uchar bits[8];
-		_md5_encode(bits, _count, 8);
+			uint32 index = _count[0] / 8 % 64, paddingLen = (index < 56) ? (56 - index) : (120 - index);
+			feed(_md5_padding, paddingLen);
+			feed(bits, 8);
 
-		uint32 index = _count[0] / 8 % 64, paddingLen = (index < 56) ? (56 - index) : (120 - index);
-		feed(_md5_padding, paddingLen);
-		feed(bits, 8);
+			_md5_encode(_digest, _state, 16);
 
-		_md5_encode(_digest, _state, 16);
+			_finalized = true;
+		}
+	}
 
-		_finalized = true;
+	void HashMd5Scalar::transform(const uchar *block) {
+		uint32 a = _state[0], b = _state[1], c = _state[2], d = _state[3], x[16];
+		_md5_decode(x, block, _md5_block_size);
+
+		_md5_FF(a, b, c, d, x[0] , 7 , 0xd76aa478);
+		_md5_FF(d, a, b, c, x[1] , 12, 0xe8c7b756);
+		_md5_FF(c, d, a, b, x[2] , 17, 0x242070db);
+		_md5_FF(b, c, d, a, x[3] , 22, 0xc1bdceee);
+		_md5_FF(a, b, c, d, x[4] , 7 , 0xf57c0faf);
+		_md5_FF(d, a, b, c, x[5] , 12, 0x4787c62a);
+		_md5_FF(c, d, a, b, x[6] , 17, 0xa8304613);
+		_md5_FF(b, c, d, a, x[7] , 22, 0xfd469501);
+		_md5_FF(a, b, c, d, x[8] , 7 , 0x698098d8);
+		_md5_FF(d, a, b, c, x[9] , 12, 0x8b44f7af);
+		_md5_FF(c, d, a, b, x[10], 17, 0xffff5bb1);
+		_md5_FF(b, c, d, a, x[11], 22, 0x895cd7be);
+		_md5_FF(a, b, c, d, x[12], 7 , 0x6b901122);
+		_md5_FF(d, a, b, c, x[13], 12, 0xfd987193);
+		_md5_FF(c, d, a, b, x[14], 17, 0xa679438e);
+		_md5_FF(b, c, d, a, x[15], 22, 0x49b40821);
+
+		_md5_GG(a, b, c, d, x[1] , 5 , 0xf61e2562);
+		_md5_GG(d, a, b, c, x[6] , 9 , 0xc040b340);
+		_md5_GG(c, d, a, b, x[11], 14, 0x265e5a51);
+		_md5_GG(b, c, d, a, x[0] , 20, 0xe9b6c7aa);
+		_md5_GG(a, b, c, d, x[5] , 5 , 0xd62f105d);
+		_md5_GG(d, a, b, c, x[10], 9 , 0x2441453);
+		_md5_GG(c, d, a, b, x[15], 14, 0xd8a1e681);
+		_md5_GG(b, c, d, a, x[4] , 20, 0xe7d3fbc8);
+		_md5_GG(a, b, c, d, x[9] , 5 , 0x21e1cde6);
+		_md5_GG(d, a, b, c, x[14], 9 , 0xc33707d6);
+		_md5_GG(c, d, a, b, x[3] , 14, 0xf4d50d87);
+		_md5_GG(b, c, d, a, x[8] , 20, 0x455a14ed);
+		_md5_GG(a, b, c, d, x[13], 5 , 0xa9e3e905);
+		_md5_GG(d, a, b, c, x[2] , 9 , 0xfcefa3f8);
+		_md5_GG(c, d, a, b, x[7] , 14, 0x676f02d9);
+		_md5_GG(b, c, d, a, x[12], 20, 0x8d2a4c8a);
+
+		_md5_HH(a, b, c, d, x[5] , 4 , 0xfffa3942);
+		_md5_HH(d, a, b, c, x[8] , 11, 0x8771f681);
+		_md5_HH(c, d, a, b, x[11], 16, 0x6d9d6122);
+		_md5_HH(b, c, d, a, x[14], 23, 0xfde5380c);
+		_md5_HH(a, b, c, d, x[1] , 4 , 0xa4beea44);
+		_md5_HH(d, a, b, c, x[4] , 11, 0x4bdecfa9);
+		_md5_HH(c, d, a, b, x[7] , 16, 0xf6bb4b60);
+		_md5_HH(b, c, d, a, x[10], 23, 0xbebfbc70);
+		_md5_HH(a, b, c, d, x[13], 4 , 0x289b7ec6);
+		_md5_HH(d, a, b, c, x[0] , 11, 0xeaa127fa);
+		_md5_HH(c, d, a, b, x[3] , 16, 0xd4ef3085);
+		_md5_HH(b, c, d, a, x[6] , 23, 0x4881d05);
+		_md5_HH(a, b, c, d, x[9] , 4 , 0xd9d4d039);
+		_md5_HH(d, a, b, c, x[12], 11, 0xe6db99e5);
+		_md5_HH(c, d, a, b, x[15], 16, 0x1fa27cf8);
+		_md5_HH(b, c, d, a, x[2] , 23, 0xc4ac5665);
+
+		_md5_II(a, b, c, d, x[0] , 6 , 0xf4292244);
+		_md5_II(d, a, b, c, x[7] , 10, 0x432aff97);
+		_md5_II(c, d, a, b, x[14], 15, 0xab9423a7);
+		_md5_II(b, c, d, a, x[5] , 21, 0xfc93a039);
+		_md5_II(a, b, c, d, x[12], 6 , 0x655b59c3);
+		_md5_II(d, a, b, c, x[3] , 10, 0x8f0ccc92);
+		_md5_II(c, d, a, b, x[10], 15, 0xffeff47d);
+		_md5_II(b, c, d, a, x[1] , 21, 0x85845dd1);
+		_md5_II(a, b, c, d, x[8] , 6 , 0x6fa87e4f);
+		_md5_II(d, a, b, c, x[15], 10, 0xfe2ce6e0);
+		_md5_II(c, d, a, b, x[6] , 15, 0xa3014314);
+		_md5_II(b, c, d, a, x[13], 21, 0x4e0811a1);
+		_md5_II(a, b, c, d, x[4] , 6 , 0xf7537e82);
+		_md5_II(d, a, b, c, x[11], 10, 0xbd3af235);
+		_md5_II(c, d, a, b, x[2] , 15, 0x2ad7d2bb);
+		_md5_II(b, c, d, a, x[9] , 21, 0xeb86d391);
+
+		_state[0] += a;
+		_state[1] += b;
+		_state[2] += c;
+		_state[3] += d;
 	}
 }
 
-void HashMd5::transform(const uchar *block) {
-	uint32 a = _state[0], b = _state[1], c = _state[2], d = _state[3], x[16];
-	_md5_decode(x, block, _md5_block_size);
-
-	_md5_FF(a, b, c, d, x[0] , 7 , 0xd76aa478);
-	_md5_FF(d, a, b, c, x[1] , 12, 0xe8c7b756);
-	_md5_FF(c, d, a, b, x[2] , 17, 0x242070db);
-	_md5_FF(b, c, d, a, x[3] , 22, 0xc1bdceee);
-	_md5_FF(a, b, c, d, x[4] , 7 , 0xf57c0faf);
-	_md5_FF(d, a, b, c, x[5] , 12, 0x4787c62a);
-	_md5_FF(c, d, a, b, x[6] , 17, 0xa8304613);
-	_md5_FF(b, c, d, a, x[7] , 22, 0xfd469501);
-	_md5_FF(a, b, c, d, x[8] , 7 , 0x698098d8);
-	_md5_FF(d, a, b, c, x[9] , 12, 0x8b44f7af);
-	_md5_FF(c, d, a, b, x[10], 17, 0xffff5bb1);
-	_md5_FF(b, c, d, a, x[11], 22, 0x895cd7be);
-	_md5_FF(a, b, c, d, x[12], 7 , 0x6b901122);
-	_md5_FF(d, a, b, c, x[13], 12, 0xfd987193);
-	_md5_FF(c, d, a, b, x[14], 17, 0xa679438e);
-	_md5_FF(b, c, d, a, x[15], 22, 0x49b40821);
-
-	_md5_GG(a, b, c, d, x[1] , 5 , 0xf61e2562);
-	_md5_GG(d, a, b, c, x[6] , 9 , 0xc040b340);
-	_md5_GG(c, d, a, b, x[11], 14, 0x265e5a51);
-	_md5_GG(b, c, d, a, x[0] , 20, 0xe9b6c7aa);
-	_md5_GG(a, b, c, d, x[5] , 5 , 0xd62f105d);
-	_md5_GG(d, a, b, c, x[10], 9 , 0x2441453);
-	_md5_GG(c, d, a, b, x[15], 14, 0xd8a1e681);
-	_md5_GG(b, c, d, a, x[4] , 20, 0xe7d3fbc8);
-	_md5_GG(a, b, c, d, x[9] , 5 , 0x21e1cde6);
-	_md5_GG(d, a, b, c, x[14], 9 , 0xc33707d6);
-	_md5_GG(c, d, a, b, x[3] , 14, 0xf4d50d87);
-	_md5_GG(b, c, d, a, x[8] , 20, 0x455a14ed);
-	_md5_GG(a, b, c, d, x[13], 5 , 0xa9e3e905);
-	_md5_GG(d, a, b, c, x[2] , 9 , 0xfcefa3f8);
-	_md5_GG(c, d, a, b, x[7] , 14, 0x676f02d9);
-	_md5_GG(b, c, d, a, x[12], 20, 0x8d2a4c8a);
-
-	_md5_HH(a, b, c, d, x[5] , 4 , 0xfffa3942);
-	_md5_HH(d, a, b, c, x[8] , 11, 0x8771f681);
-	_md5_HH(c, d, a, b, x[11], 16, 0x6d9d6122);
-	_md5_HH(b, c, d, a, x[14], 23, 0xfde5380c);
-	_md5_HH(a, b, c, d, x[1] , 4 , 0xa4beea44);
-	_md5_HH(d, a, b, c, x[4] , 11, 0x4bdecfa9);
-	_md5_HH(c, d, a, b, x[7] , 16, 0xf6bb4b60);
-	_md5_HH(b, c, d, a, x[10], 23, 0xbebfbc70);
-	_md5_HH(a, b, c, d, x[13], 4 , 0x289b7ec6);
-	_md5_HH(d, a, b, c, x[0] , 11, 0xeaa127fa);
-	_md5_HH(c, d, a, b, x[3] , 16, 0xd4ef3085);
-	_md5_HH(b, c, d, a, x[6] , 23, 0x4881d05);
-	_md5_HH(a, b, c, d, x[9] , 4 , 0xd9d4d039);
-	_md5_HH(d, a, b, c, x[12], 11, 0xe6db99e5);
-	_md5_HH(c, d, a, b, x[15], 16, 0x1fa27cf8);
-	_md5_HH(b, c, d, a, x[2] , 23, 0xc4ac5665);
-
-	_md5_II(a, b, c, d, x[0] , 6 , 0xf4292244);
-	_md5_II(d, a, b, c, x[7] , 10, 0x432aff97);
-	_md5_II(c, d, a, b, x[14], 15, 0xab9423a7);
-	_md5_II(b, c, d, a, x[5] , 21, 0xfc93a039);
-	_md5_II(a, b, c, d, x[12], 6 , 0x655b59c3);
-	_md5_II(d, a, b, c, x[3] , 10, 0x8f0ccc92);
-	_md5_II(c, d, a, b, x[10], 15, 0xffeff47d);
-	_md5_II(b, c, d, a, x[1] , 21, 0x85845dd1);
-	_md5_II(a, b, c, d, x[8] , 6 , 0x6fa87e4f);
-	_md5_II(d, a, b, c, x[15], 10, 0xfe2ce6e0);
-	_md5_II(c, d, a, b, x[6] , 15, 0xa3014314);
-	_md5_II(b, c, d, a, x[13], 21, 0x4e0811a1);
-	_md5_II(a, b, c, d, x[4] , 6 , 0xf7537e82);
-	_md5_II(d, a, b, c, x[11], 10, 0xbd3af235);
-	_md5_II(c, d, a, b, x[2] , 15, 0x2ad7d2bb);
-	_md5_II(b, c, d, a, x[9] , 21, 0xeb86d391);
-
-	_state[0] += a;
-	_state[1] += b;
-	_state[2] += c;
-	_state[3] += d;
+namespace {
+	template <typename Kernel>
+	bool _cryptoKernelSupported(const CryptoKernel<Kernel> &kernel, uint32 features) {
+		return (kernel.features & features) == kernel.features;
+	}
+
+	void _cryptoBenchmarkLog(const char *hash, const char *kernel, uint32 size, uint64 total, qint64 nsecs) {
+		float64 speed = float64(total) * 1000000000. / (float64(qMax(nsecs, qint64(1))) * 1024. * 1024.);
+		LOG(("Crypto Benchmark: %1 %2, %3 byte buffers, %4 MB/s").arg(hash).arg(kernel).arg(size).arg(speed, 0, 'f', 1));
+	}
 }
 
-int32 *hashMd5(const void *data, uint32 len, void *dest) {
-	HashMd5 md5(data, len);
-	memcpy(dest, md5.result(), 16);
+void benchmarkCrypto() {
+	const uint32 sizes[] = { 64, 512 * 1024 }, total = 64 * 1024 * 1024;
+	const int32 sizesCount = sizeof(sizes) / sizeof(sizes[0]);
 
-	return (int32*)dest;
-}
+	cryptoInit();
+	uint32 features = _cpuFeatures(), check = 0;
 
-char *hashMd5Hex(const int32 *hashmd5, void *dest) {
-	char *md5To = (char*)dest;
-	const uchar *res = (const uchar*)hashmd5;
+	QByteArray input(sizes[sizesCount - 1], Qt::Uninitialized), output(sizes[sizesCount - 1], Qt::Uninitialized);
+	memset_rand(input.data(), input.size());
+	const uchar *src = (const uchar*)input.constData();
+	uchar *dst = (uchar*)output.data(), key[32], iv[32], hash[20];
+	memset_rand(key, sizeof(key));
+	memset_rand(iv, sizeof(iv));
 
-	for (int i = 0; i < 16; ++i) {
-		uchar ch(res[i]), high = (ch >> 4) & 0x0F, low = ch & 0x0F;
-		md5To[i * 2 + 0] = high + ((high > 0x09) ? ('a' - 0x0A) : '0');
-		md5To[i * 2 + 1] = low + ((low > 0x09) ? ('a' - 0x0A) : '0');
-	}
+	QElapsedTimer timer;
+	for (int32 s = 0; s < sizesCount; ++s) {
+		uint32 size = sizes[s], count = total / size;
 
-	return md5To;
+		for (int32 i = 0, l = sizeof(_crc32Kernels) / sizeof(_crc32Kernels[0]); i < l; ++i) {
+			if (!_cryptoKernelSupported(_crc32Kernels[i], features)) continue;
+
+			timer.start();
+			for (uint32 j = 0; j < count; ++j) {
+				check ^= _crc32Kernels[i].kernel(0xffffffff, src, size);
+			}
+			_cryptoBenchmarkLog("crc32", _crc32Kernels[i].name, size, total, timer.nsecsElapsed());
+		}
+
+		for (int32 i = 0, l = sizeof(_sha1Kernels) / sizeof(_sha1Kernels[0]); i < l; ++i) {
+			if (!_cryptoKernelSupported(_sha1Kernels[i], features)) continue;
+
+			timer.start();
+			for (uint32 j = 0; j < count; ++j) {
+				_sha1Kernels[i].kernel(src, size, hash);
+				check ^= *(uint32*)hash;
+			}
+			_cryptoBenchmarkLog("sha1", _sha1Kernels[i].name, size, total, timer.nsecsElapsed());
+		}
+
+		timer.start();
+		for (uint32 j = 0; j < count; ++j) {
+			check ^= *HashMd5Scalar(src, size).result();
+		}
+		_cryptoBenchmarkLog("md5", "scalar", size, total, timer.nsecsElapsed());
+
+		timer.start();
+		for (uint32 j = 0; j < count; ++j) {
+			check ^= *HashMd5(src, size).result();
+		}
+		_cryptoBenchmarkLog("md5", "openssl", size, total, timer.nsecsElapsed());
+
+		for (int32 i = 0, l = sizeof(_aesIgeKernels) / sizeof(_aesIgeKernels[0]); i < l; ++i) {
+			if (!_cryptoKernelSupported(_aesIgeKernels[i], features)) continue;
+
+			timer.start();
+			for (uint32 j = 0; j < count; ++j) {
+				_aesIgeKernels[i].kernel(src, dst, size, key, iv, true);
+				check ^= *(uint32*)dst;
+			}
+			_cryptoBenchmarkLog("aes-ige encrypt", _aesIgeKernels[i].name, size, total, timer.nsecsElapsed());
+
+			timer.start();
+			for (uint32 j = 0; j < count; ++j) {
+				_aesIgeKernels[i].kernel(src, dst, size, key, iv, false);
+				check ^= *(uint32*)dst;
+			}
+			_cryptoBenchmarkLog("aes-ige decrypt", _aesIgeKernels[i].name, size, total, timer.nsecsElapsed());
+		}
+	}
+	LOG(("Crypto Benchmark: done, check %1").arg(check));
 }
 
+#endif
+
 void memset_rand(void *data, uint32 len) {
     _msInitialize();
 	RAND_bytes((uchar*)data, len);
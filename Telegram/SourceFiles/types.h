@@ -75,6 +75,7 @@ class MTPint;
 int32 myunixtime();
 void unixtimeInit();
 void unixtimeSet(int32 servertime, bool force = false);
+void unixtimeRestore(int32 delta); // saved delta from the last launch, replaced by the first server time received
 int32 unixtime();
 int32 fromServerTime(const MTPint &serverTime);
 uint64 msgid();
@@ -99,8 +100,8 @@ inline void mylocaltime(struct tm * _Tm, const time_t * _Time) {
 }
 
 uint64 getms();
+uint64 getus(); // same as getms(), but in microseconds
 
-const static uint32 _md5_block_size = 64;
 class HashMd5 {
 public:
 
@@ -110,14 +111,8 @@ public:
 
 private:
 
-	void init();
-	void finalize();
-	void transform(const uchar *block);
-
 	bool _finalized;
-	uchar _buffer[_md5_block_size];
-	uint32 _count[2];
-	uint32 _state[4];
+	MD5_CTX _context;
 	uchar _digest[16];
 
 };
@@ -130,6 +125,14 @@ inline char *hashMd5Hex(const void *data, uint32 len, void *dest) { // dest = pt
 	return hashMd5Hex(HashMd5(data, len).result(), dest);
 }
 
+void aesIgeEncrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv); // key and iv are 32 bytes, len is a multiple of 16
+void aesIgeDecrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv);
+void cryptoInit(); // chooses the crc32, sha1 and aes kernels once, called from unixtimeInit() before other threads use them
+
+#ifdef TDESKTOP_BENCHMARK
+void benchmarkCrypto(); // compares crc32, sha1, md5 and aes kernels supported by the cpu with the old ones, result goes to log
+#endif
+
 void memset_rand(void *data, uint32 len);
 
 template <typename T>
@@ -223,6 +226,12 @@ enum DataBlockId {
 	dbiNotifyView = 28,
 	dbiSendToMenu = 29,
 	dbiCompressPastedImage = 30,
+	dbiSessionState = 31,
+	dbiUnixtimeDelta = 32,
+	dbiPrepareDcAuth = 33,
+	dbiDcEndpoint = 34,
+	dbiHistoryLayoutBudget = 35,
+	dbiUploadBytesInFlight = 36,
 
 	dbiEncryptedWithSalt = 333,
 	dbiEncrypted = 444,
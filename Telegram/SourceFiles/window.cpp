@@ -191,7 +191,7 @@ void NotifyWindow::updateNotifyDisplay() {
 			}
 		}
 
-		QDateTime now(QDateTime::currentDateTime()), lastTime(item->date);
+		QDateTime now(QDateTime::currentDateTime()), lastTime(item->dateTime());
 		QDate nowDate(now.date()), lastDate(lastTime.date());
 		QString dt = lastTime.toString(qsl("hh:mm"));
 		int32 dtWidth = st::dlgHistFont->m.width(dt);